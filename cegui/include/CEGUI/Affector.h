@@ -32,6 +32,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/KeyFrame.h"
 #include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -238,6 +239,13 @@ public:
     */
     void apply(AnimationInstance* instance);
 
+    /*!
+    \brief
+        Internal method, notifies this affector that the value or source
+        property of one of its key frames has changed
+    */
+    void notifyKeyFrameValueChanged();
+
     /*!
     \brief
         Writes an xml representation of this Affector to \a out_stream.
@@ -262,6 +270,29 @@ private:
      * won't do anything!)
      */
     KeyFrameMap d_keyFrames;
+
+    typedef std::vector<KeyFrame*> KeyFrameList;
+    //! the key frames sorted by position, for binary searching in apply
+    KeyFrameList d_sortedKeyFrames;
+    /** key frame values parsed by the interpolator, nullptr if they have to be
+     * applied as strings
+     */
+    TypedKeyFrames* d_typedKeyFrames;
+    //! whether d_typedKeyFrames is up to date with the key frames
+    bool d_typedKeyFramesValid;
+    /** identifies the target property, interpolator and application method
+     * of this affector, for AnimationInstance to cache the resolved property
+     */
+    unsigned int d_revision;
+
+    //! rebuilds d_sortedKeyFrames after key frames were added, moved or removed
+    void updateSortedKeyFrames();
+    //! returns the up to date parsed key frame values, nullptr if there are none
+    TypedKeyFrames* getTypedKeyFrames();
+    //! returns the property of the instance target to apply natively to, or nullptr
+    Property* getNativeTargetProperty(AnimationInstance* instance);
+    //! invalidates the parsed key frame values and the resolved properties
+    void invalidateTypedKeyFrames(bool revise);
 };
 
 } // End of  CEGUI namespace section
@@ -401,6 +401,32 @@ public:
 	*/
     void apply();
 
+    /*!
+    \brief
+        Internal method, retrieves the property of the target that given
+        affector resolved for applying native values
+
+    \param property
+        Receives the cached property, nullptr if the affector has to apply
+        its values as strings.
+
+    \return
+        false if nothing is cached for the given revision of the affector
+    */
+    bool getCachedAffectorProperty(const Affector* affector,
+                                   unsigned int revision,
+                                   Property*& property) const;
+
+    /*!
+    \brief
+        Internal method, caches the property of the target that given affector
+        resolved for applying native values, until the target changes, gains
+        or loses properties, a look'n'feel is replaced or the animation is
+        started again
+    */
+    void cacheAffectorProperty(const Affector* affector, unsigned int revision,
+                               Property* property);
+
 private:
     //! this is called when animation starts
     void onAnimationStarted();
@@ -456,6 +482,23 @@ private:
      */
     PropertyValueMap d_savedPropertyValues;
 
+    //! a target property resolved by an affector
+    struct AffectorProperty
+    {
+        const Affector* d_affector;
+        unsigned int d_revision;
+        //! property revision of the target the property was resolved in.
+        std::uint32_t d_targetRevision;
+        //! WidgetLookManager revision, property definitions die with their look.
+        std::uint32_t d_lookRevision;
+        Property* d_property;
+    };
+    typedef std::vector<AffectorProperty> AffectorPropertyList;
+    /** target properties resolved by the affectors, there are few affectors
+     * per animation so this is searched linearly
+     */
+    AffectorPropertyList d_affectorProperties;
+
     typedef std::vector<Event::Connection> ConnectionTracker;
     //! tracks auto event connections we make.
     ConnectionTracker d_autoConnections;
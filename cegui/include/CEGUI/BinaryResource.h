@@ -0,0 +1,148 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Defines the binary form of the XML based resource files
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIBinaryResource_h_
+#define _CEGUIBinaryResource_h_
+
+#include "CEGUI/XMLHandler.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Reads resources stored in the binary form of the XML based files
+    (schemes, imagesets, looknfeels, fonts, layouts...).
+
+    A binary resource is the sequence of element starts, element ends and
+    texts that parsing the XML file reports to an XMLHandler, with every
+    distinct string stored once in a table. Loading one replays that
+    sequence to the handler, so any handler accepts binary resources and no
+    XML is tokenised. XMLParser::parseXMLFile recognises them by their
+    header, whatever their file name, and bypasses the XMLParser module.
+
+    The data is read in place, using offsets only, so it can come from a
+    memory mapped file. All integers are unsigned 32 bit little endian:
+    - the 8 byte Magic, then the version, the string count N, the size of
+      the string data and the size of the event data;
+    - N + 1 offsets of the UTF-8 strings into the string data;
+    - the string data;
+    - the events: a byte for the type, followed by the string index of the
+      element name, the attribute count and the indices of each attribute
+      name and value for an element start, the index of the element name for
+      an element end and the index of the text for a text.
+
+    BinaryResourceWriter produces them, and the CEGUIBinaryResourceConverter
+    tool converts files.
+*/
+class CEGUIEXPORT BinaryResource
+{
+public:
+    //! The bytes the data starts with.
+    static const char Magic[8];
+    //! The version of the format written and the only one read.
+    static const std::uint32_t Version;
+
+    //! The types of the recorded events.
+    enum class EventType : std::uint8_t
+    {
+        ElementStart = 1,
+        ElementEnd = 2,
+        Text = 3
+    };
+
+    //! Return whether the data holds a binary resource.
+    static bool isBinaryResource(const std::uint8_t* data, size_t size);
+
+    /*!
+    \brief
+        Replay the binary resource in the given data to a handler.
+
+    \exception InvalidRequestException
+        Thrown if the data is not a binary resource of the supported version
+        or is corrupt.
+    */
+    static void parse(XMLHandler& handler, const std::uint8_t* data,
+                      size_t size);
+};
+
+/*!
+\brief
+    XMLHandler recording what it is given as a binary resource.
+
+    Parse an XML file with an instance of this handler, then write the
+    result of getData to get the binary form of the file.
+*/
+class CEGUIEXPORT BinaryResourceWriter : public XMLHandler
+{
+public:
+    BinaryResourceWriter();
+
+    const String& getDefaultResourceGroup() const override;
+    void elementStart(const String& element,
+                      const XMLAttributes& attributes) override;
+    void elementEnd(const String& element) override;
+    void text(const String& text) override;
+
+    //! Return the binary resource recorded so far.
+    std::vector<std::uint8_t> getData() const;
+
+    //! Forget everything recorded so far.
+    void reset();
+
+protected:
+    //! return the index of the string in the table, adding it if needed.
+    std::uint32_t internString(const String& str);
+    //! record the text received since the last element start or end.
+    void flushText();
+    void writeUint32(std::uint32_t value);
+
+    //! index of each string in the table.
+    std::unordered_map<String, std::uint32_t> d_stringIndices;
+    //! the strings of the table, encoded as UTF-8.
+    std::vector<std::string> d_strings;
+    std::vector<std::uint8_t> d_events;
+    //! consecutive texts are recorded as one.
+    String d_pendingText;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIBinaryResource_h_
@@ -30,6 +30,8 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/SubscriberSlot.h"
 
+#include <cstdint>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -129,6 +131,7 @@ private:
     Group d_group;                  //! The group the slot subscription used.
     SubscriberSlot* d_subscriber;   //! The actual slot object.
     Event* d_event;                 //! The event to which the slot was attached
+    std::uint64_t d_serial;         //! Order in which the subscription was made
 };
 
 } // End of  CEGUI namespace section
@@ -38,6 +38,7 @@
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/BasicRenderedStringParser.h"
 #include "CEGUI/BidiVisualMapping.h"
+#include "CEGUI/BinaryResource.h"
 #include "CEGUI/BoundSlot.h"
 #include "CEGUI/CentredRenderedString.h"
 #include "CEGUI/Clipboard.h"
@@ -74,6 +75,7 @@
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/JustifiedRenderedString.h"
 #include "CEGUI/KeyFrame.h"
+#include "CEGUI/LayoutPrototype.h"
 #include "CEGUI/LeftAlignedRenderedString.h"
 #include "CEGUI/LinkedEvent.h"
 #include "CEGUI/Logger.h"
@@ -99,6 +101,7 @@
 #include "CEGUI/RenderingSurface.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/RenderQueue.h"
+#include "CEGUI/RenderStats.h"
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RightAlignedRenderedString.h"
 #include "CEGUI/Scheme.h"
@@ -33,6 +33,10 @@
 #include <vector>
 #include <fstream>
 #include <sstream>
+#include <ctime>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -48,6 +52,11 @@ namespace CEGUI
     If you want to redirect CEGUI logs to some place other than a text file,
     implement your own Logger implementation and create a object of the
     Logger type before creating the CEGUI::System singleton.
+
+    By default each event is written and flushed to the log file by the
+    thread that logged it. With asynchronous writing enabled, events are
+    only queued by the logging thread; a background thread formats and
+    writes them in batches, flushing the file once per batch.
 */
 class CEGUIEXPORT DefaultLogger : public Logger
 {
@@ -59,7 +68,50 @@ public:
     void logEvent(const String& message, LoggingLevel level = LoggingLevel::Standard) override;
     void setLogFilename(const String& filename, bool append = false) override;
 
+    /*!
+    \brief
+        Set whether log events are written to the file by a background thread.
+
+        Disabling asynchronous writing blocks until all queued events have
+        been written.
+
+    \param enabled
+        - true to queue events and write them from a background thread.
+        - false to write and flush each event as it is logged.
+    */
+    void setAsynchronousWriting(bool enabled);
+
+    //! Return whether log events are written by a background thread.
+    bool isAsynchronousWriting() const { return d_asyncWriting; }
+
+    /*!
+    \brief
+        Block until all queued log events have been written to the file.
+        Does nothing when asynchronous writing is disabled.
+    */
+    void flush();
+
 protected:
+    //! A log event waiting to be written by the background thread.
+    struct QueuedEvent
+    {
+        std::time_t d_time;
+        LoggingLevel d_level;
+        String d_message;
+    };
+    typedef std::vector<QueuedEvent> EventQueue;
+
+    //! Format an event into d_workstream. Returns false if it has no valid time.
+    bool formatEvent(std::time_t time, LoggingLevel level, const String& message);
+    //! Write d_workstream to the system log where the platform has one.
+    void writeToSystemLog(LoggingLevel level);
+    //! Start the background writing thread.
+    void startWriterThread();
+    //! Write all queued events and stop the background writing thread.
+    void stopWriterThread();
+    //! Entry point of the background writing thread.
+    void writerThreadMain();
+
     //! Stream used to implement the logger
     std::ofstream d_ostream;
     //! Used to build log entry strings. 
@@ -71,6 +123,23 @@ protected:
     Cache d_cache;
     //! true while log entries are being cached (prior to logfile creation)
     bool d_caching;
+
+    //! true if events are written by d_writerThread.
+    bool d_asyncWriting;
+    //! Thread writing the queued events to d_ostream.
+    std::thread d_writerThread;
+    //! Protects d_queue, d_writing and d_stopWriter.
+    std::mutex d_queueMutex;
+    //! Signalled when events are queued or the writer should stop.
+    std::condition_variable d_queueNotEmpty;
+    //! Signalled when the writer has written everything that was queued.
+    std::condition_variable d_queueDrained;
+    //! Events waiting to be written.
+    EventQueue d_queue;
+    //! true while the writer is writing a batch taken from d_queue.
+    bool d_writing;
+    //! true to make the writer thread exit once d_queue is empty.
+    bool d_stopWriter;
 };
 
 }
@@ -32,6 +32,7 @@
 #include "CEGUI/SubscriberSlot.h"
 #include "CEGUI/RefCounted.h"
 
+#include <cstdint>
 #include <map>
 
 #if defined(_MSC_VER)
@@ -198,6 +199,25 @@ public:
     */
     void operator()(EventArgs& args);
 
+    //! Return the number of subscriptions to the Event.
+    size_t getConnectionCount() const { return d_slots.size(); }
+
+    /*!
+    \brief
+        Return the serial number the next subscription to any Event gets.
+
+        Subscriptions are numbered in the order they are made, so a value
+        returned here separates the subscriptions made before from those made
+        after.
+    */
+    static std::uint64_t getNextSubscriptionSerial() { return s_nextSubscriptionSerial; }
+
+    //! Return the number of subscriptions made before the given serial number.
+    size_t getConnectionCountBefore(std::uint64_t serial) const;
+
+    //! Disconnect the subscriptions made from the given serial number on.
+    void disconnectSubscriptionsFrom(std::uint64_t serial);
+
 
 protected:
     friend void CEGUI::BoundSlot::disconnect();
@@ -223,6 +243,9 @@ protected:
     typedef std::multimap<Group, Connection, std::less<Group> > SlotContainer;
     SlotContainer d_slots;  //!< Collection holding ref-counted bound slots
     const String d_name;    //!< Name of this event
+
+    //! Serial number of the next subscription to any Event.
+    static std::uint64_t s_nextSubscriptionSerial;
 };
 
 } // End of  CEGUI namespace section
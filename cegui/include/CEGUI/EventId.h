@@ -0,0 +1,91 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Defines the interned identifier used to look up events
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIEventId_h_
+#define _CEGUIEventId_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include <cstdint>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Interned identifier of an event name.
+
+    Every distinct name is assigned a small integer the first time an EventId
+    is constructed for it, so that EventSet can look events up and compare
+    them without hashing or comparing strings. Event names used repeatedly,
+    such as the static Window::Event* members, should be held as EventId
+    objects so the interning cost is paid only once.
+
+    Interned names are never released, so EventId should not be created for
+    names generated at runtime in an unbounded fashion.
+*/
+class CEGUIEXPORT EventId
+{
+public:
+    //! Constructs an invalid EventId, which matches no event.
+    EventId() :
+        d_value(0)
+    {}
+
+    //! Constructs the EventId for \a name, interning the name if needed.
+    explicit EventId(const String& name);
+
+    /*!
+    \brief
+        Returns the EventId for \a name if it was already interned, or an
+        invalid EventId otherwise. This never interns the name.
+    */
+    static EventId find(const String& name);
+
+    //! Returns whether this EventId identifies a name.
+    bool isValid() const { return d_value != 0; }
+
+    //! Returns the integer identifying the name, 0 for an invalid EventId.
+    std::uint32_t getValue() const { return d_value; }
+
+    //! Returns the name this EventId was created for.
+    const String& getName() const;
+
+    //! Allows an EventId to be used wherever the event name is expected.
+    operator const String&() const { return getName(); }
+
+    bool operator==(const EventId& other) const { return d_value == other.d_value; }
+    bool operator!=(const EventId& other) const { return d_value != other.d_value; }
+    bool operator<(const EventId& other) const { return d_value < other.d_value; }
+
+private:
+    std::uint32_t d_value;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIEventId_h_
@@ -32,8 +32,10 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/String.h"
 #include "CEGUI/Event.h"
+#include "CEGUI/EventId.h"
 #include "CEGUI/IteratorBase.h"
 #include <unordered_map>
+#include <vector>
 
 #include <iostream>
 
@@ -292,6 +294,48 @@ public:
                                              Event::Group group,
                                              Event::Subscriber subscriber);
 
+    /*!
+    \brief
+        Subscribes a handler to the Event identified by \a id.  If the Event
+        is not yet present in the EventSet, it is created and added.
+
+    \param id
+        EventId identifying the Event to subscribe to.
+
+    \param subscriber
+        Function or object that is to be subscribed to the Event.
+
+    \return
+        Connection object that can be used to check the status of the Event
+        connection and to disconnect (unsubscribe) from the Event.
+    */
+    Event::Connection subscribeEvent(const EventId& id,
+                                     Event::Subscriber subscriber);
+
+    /*!
+    \brief
+        Subscribes a handler to the specified group of the Event identified by
+        \a id.  If the Event is not yet present in the EventSet, it is created
+        and added.
+
+    \param id
+        EventId identifying the Event to subscribe to.
+
+    \param group
+        Group which is to be subscribed to.  Subscription groups are called in
+        ascending order.
+
+    \param subscriber
+        Function or object that is to be subscribed to the Event.
+
+    \return
+        Connection object that can be used to check the status of the Event
+        connection and to disconnect (unsubscribe) from the Event.
+    */
+    Event::Connection subscribeEvent(const EventId& id,
+                                     Event::Group group,
+                                     Event::Subscriber subscriber);
+
     /*!
     \copydoc EventSet::subscribeEvent
     
@@ -376,6 +420,31 @@ public:
     virtual void fireEvent(const String& name, EventArgs& args,
                            const String& eventNamespace = "");
 
+    /*!
+    \brief
+        Fires the Event identified by \a id passing the given EventArgs
+        object.
+
+        This is the fast path for firing events: the Event is found by
+        comparing integers, and the GlobalEventSet is skipped entirely when
+        none of its events share the name of the fired one.
+
+    \param id
+        EventId identifying the Event that is to be fired (triggered)
+
+    \param args
+        The EventArgs (or derived) object that is to be bassed to each
+        subscriber of the Event.  Once all subscribers
+        have been called the 'handled' field of the event is updated
+        appropriately.
+
+    \param eventNamespace
+        String object describing the global event namespace prefix for this
+        event.
+    */
+    void fireEvent(const EventId& id, EventArgs& args,
+                   const String& eventNamespace = "");
+
 
     /*!
     \brief
@@ -423,8 +492,15 @@ public:
     Event* getEventObject(const String& name, bool autoAdd = false);
 
 protected:
+    //! Return a pointer to the Event object identified by \a id, or 0.
+    Event* getEventObjectById(const EventId& id) const;
+
     //! Implementation event firing member
     void fireEvent_impl(const String& name, EventArgs& args);
+    //! Implementation event firing member
+    void fireEvent_impl(const EventId& id, EventArgs& args);
+    //! Called whenever an Event object has been added to the set.
+    virtual void onEventAdded(Event& event);
     //! Helper to return the script module pointer or throw.
     ScriptModule* getScriptModule() const;
 
@@ -435,6 +511,10 @@ protected:
     typedef std::unordered_map<String, Event*> EventMap;
     EventMap    d_events;
 
+    typedef std::vector<std::pair<std::uint32_t, Event*> > EventIdVector;
+    //! The events of d_events, sorted by the value of their EventId.
+    EventIdVector d_eventsById;
+
     bool d_muted;    //!< true if events for this EventSet have been muted.
 
 public:
@@ -335,7 +335,31 @@ public:
 
     \see getTextAdvance
     */
-    float getTextExtent(const String& text) const;
+    float getTextExtent(const String& text) const
+    { return getTextExtent(text, 0, String::npos); }
+
+    /*!
+    \brief
+        Return the pixel width of a part of the specified text if rendered
+        with this Font, without copying that part out of \a text.
+
+    \param text
+        String object containing the text.
+
+    \param start
+        Index of the first code unit of the part to measure.
+
+    \param length
+        Number of code units in the part to measure. The part ends at the end
+        of \a text when this goes beyond it.
+
+    \return
+        Number of pixels that the part of \a text will occupy when rendered
+        with this Font.
+
+    \see getTextExtent(const String&) const
+    */
+    float getTextExtent(const String& text, size_t start, size_t length) const;
 
     /*!
     \brief
@@ -371,7 +395,30 @@ public:
 
     \see getTextExtent
     */
-    float getTextAdvance(const String& text) const;
+    float getTextAdvance(const String& text) const
+    { return getTextAdvance(text, 0, String::npos); }
+
+    /*!
+    \brief
+        Return pixel advance of a part of the specified text when rendered
+        with this Font, without copying that part out of \a text.
+
+    \param text
+        String object containing the text.
+
+    \param start
+        Index of the first code unit of the part to measure.
+
+    \param length
+        Number of code units in the part to measure. The part ends at the end
+        of \a text when this goes beyond it.
+
+    \return
+        pixel advance of the part of \a text when rendered with this Font.
+
+    \see getTextAdvance(const String&) const
+    */
+    float getTextAdvance(const String& text, size_t start, size_t length) const;
 
     /*!
     \brief
@@ -491,12 +538,30 @@ protected:
         ImageRenderSettings imgRenderSettings,
         glm::vec2& glyph_pos) const;
 
+    /*!
+    \brief
+        The GeometryBuffers created while laying out a string, one per glyph
+        texture, along with the texture each of them draws from.
+
+        Glyphs are looked up by their texture directly rather than by querying
+        the shader parameters of every buffer, which matters for long texts
+        spread over several atlas pages.
+    */
+    struct GlyphGeometryBatches
+    {
+        //! The buffers, in the order they were created.
+        std::vector<GeometryBuffer*> d_buffers;
+        //! The texture used by the buffer at the same index in d_buffers.
+        std::vector<const Texture*> d_textures;
+    };
+
     /*! 
     \brief
-        Adds the render geometry data to the supplied vector. A new GeometryBuffer
-        might be added if necessary or data might be added to an existing one.
+        Adds the render geometry data of a glyph to the batch drawing from the
+        glyph's texture. A new GeometryBuffer is created if there is no such
+        batch yet.
     */
-    void addGlyphRenderGeometry(std::vector<GeometryBuffer*> &textGeometryBuffers,
+    void addGlyphRenderGeometry(GlyphGeometryBatches& batches,
                                 const Image* image, ImageRenderSettings &imgRenderSettings,
                                 const Rectf* clip_rect, const ColourRect& colours) const;
 
@@ -511,15 +576,6 @@ protected:
             colours, space_extra, imgRenderSettings, glyphPos);
     }
 
-    /*!
-    \brief
-        Checks if the supplied GeometryBuffers contain a GeometryBuffer using the same Image.
-        If this is the case, the first found Geometrybuffer will be returned, otherwise 
-        a nullptr will be returned.
-    */
-    static GeometryBuffer* findCombinableBuffer(const std::vector<GeometryBuffer*>& geomBuffers,
-        const Image* image);
-
     /*!
     \brief
         Tries to find the FontGlyph for the supplied codepoint. Before returning it,
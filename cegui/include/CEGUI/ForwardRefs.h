@@ -41,6 +41,8 @@ class AnimationInstance;
 class AnimationManager;
 class BasicRenderedStringParser;
 class BidiVisualMapping;
+class BinaryResource;
+class BinaryResourceWriter;
 class CentredRenderedString;
 class Clipboard;
 class Colour;
@@ -74,6 +76,7 @@ class InputAggregator;
 class InputEvent;
 class JustifiedRenderedString;
 class KeyFrame;
+class LayoutPrototype;
 class LeftAlignedRenderedString;
 class LinkedEvent;
 class LinkedEventArgs;
@@ -82,6 +85,7 @@ class Cursor;
 class NamedElement;
 class NamedElementEventArgs;
 class NativeClipboardProvider;
+class PreparedPropertyValue;
 class Property;
 template<typename T> class PropertyHelper;
 class PropertyReceiver;
@@ -102,6 +106,7 @@ struct RenderingContext;
 class RenderingSurface;
 class RenderingWindow;
 class RenderQueue;
+class RenderStats;
 class RenderTarget;
 class ResourceEventSet;
 class ResourceProvider;
@@ -119,6 +124,7 @@ class System;
 class Texture;
 class TextureTarget;
 class TextUtils;
+class TypedKeyFrames;
 class UBox;
 class UDim;
 class UVector2;
@@ -35,6 +35,9 @@
 #include "CEGUI/FontSizeUnit.h"
 #include "CEGUI/FreeTypeFontGlyph.h"
 #include "CEGUI/FreeTypeFontLayer.h"
+#include "CEGUI/GlyphAtlas.h"
+
+#include <list>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -201,68 +204,138 @@ public:
     //! Returns the Freetype font face
     const FT_Face& getFontFace() const;
 
-    //! Returns the initial size to be used for any new glyph atlas texture.
+    /*!
+    \brief
+        Returns the size of the pages of the glyph atlas created by this font.
+        A value of 0 means the size is chosen based on the font height.
+    */
+    int getGlyphAtlasPageSize() const;
+
+    /*!
+    \brief
+        Sets the size of the pages of the glyph atlas created by this font, or
+        0 to choose it based on the font height. This has no effect on a
+        shared atlas set via setGlyphAtlas.
+    */
+    void setGlyphAtlasPageSize(int size);
+
+    /*!
+    \deprecated
+        Use getGlyphAtlasPageSize instead; this will be removed in the next
+        release.
+    */
     int getInitialGlyphAtlasSize() const;
 
-    //! Sets the initial size to be used for any new glyph atlas texture.
+    /*!
+    \deprecated
+        Use setGlyphAtlasPageSize instead; this will be removed in the next
+        release.
+    */
     void setInitialGlyphAtlasSize(int val);
 
-protected:
     /*!
-        A data structure containing info about one horizontal line inside
-        a glyph atlas. The data is used when deciding where to place a new glyph.
+    \brief
+        Sets the atlas the glyph images of this font are packed into, which
+        allows several fonts to share their glyph textures.
+
+    \param atlas
+        The atlas to use, which must outlive the font, or nullptr to have the
+        font create and own an atlas of its own. All glyphs are rendered again.
     */
-    struct TextureGlyphLine
-    {
-        TextureGlyphLine()
-        {
-        }
+    void setGlyphAtlas(GlyphAtlas* atlas);
 
-        TextureGlyphLine(int lastPosX, int lastPosY, int maximumExtentY)
-            : d_lastXPos(lastPosX)
-            , d_lastYPos(lastPosY)
-            , d_maximumExtentY(maximumExtentY)
-        {
-        }
+    //! Returns the atlas the glyph images of this font are packed into.
+    GlyphAtlas* getGlyphAtlas() const;
 
-        //! The x position where we last ended drawing (including padding)
-        mutable int d_lastXPos = 0;
-        //! The y position where we last ended drawing (including padding)
-        mutable int d_lastYPos = 0;
-        //! The maximum extent that a glyph of this line can take in the y-dimension
-        //! If the line is the last line, this value may increase while rendering to the line
-        mutable int d_maximumExtentY = 0;
-    };
+    /*!
+    \brief
+        Returns the maximum number of strings whose laid out glyphs are kept
+        by the font, so that redrawing them skips the per character work.
+    */
+    size_t getShapedRunCacheCapacity() const;
+
+    /*!
+    \brief
+        Sets the maximum number of strings whose laid out glyphs are kept by
+        the font. When the cache is full, the least recently drawn string makes
+        room for a new one; a capacity of 0 disables it.
+    */
+    void setShapedRunCacheCapacity(size_t capacity);
+
+    //! Returns the number of strings currently held in the shaped run cache.
+    size_t getShapedRunCacheSize() const;
+
+    //! Discards all the laid out strings held by the shaped run cache.
+    void clearShapedRunCache();
+
+protected:
 
     //! Type for mapping codepoints to the corresponding Freetype Font glyphs
     typedef std::unordered_map<char32_t, FreeTypeFontGlyph*> CodePointToGlyphMap;
     //! Type for mapping Freetype indices to the corresponding Freetype Font glyphs
     typedef std::unordered_map<FT_UInt, char32_t> IndexToCodePointMap;
 
-    /*!
-    \brief
-        Updates a part of the buffer data, which equates to a sub-image inside the 
-        texture the buffer data represents, based on the supplied subimage data.
+    //! A glyph of a laid out string, with kerning or shaping already applied.
+    struct ShapedGlyph
+    {
+        //! The glyph to draw.
+        const FreeTypeFontGlyph* d_glyph;
+        //! Horizontal move of the pen before drawing (kerning, hinting deltas).
+        float d_penAdjustment;
+        //! Offset of the glyph image from the pen position, from shaping.
+        glm::vec2 d_offset;
+        //! Horizontal move of the pen after drawing.
+        float d_advance;
+        //! Whether this is a space, which is widened for justified text.
+        bool d_isSpace;
+    };
 
-    \param bitmapWidth
-        Width of the source subimage
+    //! The glyphs of a laid out string, independent of position and layer.
+    struct ShapedRun
+    {
+        std::vector<ShapedGlyph> d_glyphs;
+    };
 
-    \param bitmapHeight
-        Height of the source subimage
+    //! Identifies a laid out string: its text and how it was shaped.
+    struct ShapedRunKey
+    {
+        String d_text;
+        DefaultParagraphDirection d_paragraphDir;
+        bool d_shapedUsingRaqm;
 
-    \param subImageData
-        The pixel data of the subimage 
-    */
-    void updateTextureBufferSubImage(argb_t* buffer, unsigned int bitmapWidth,
-        unsigned int bitmapHeight, const std::vector<argb_t>& subImageData) const;
+        bool operator==(const ShapedRunKey& other) const
+        {
+            return d_paragraphDir == other.d_paragraphDir &&
+                d_shapedUsingRaqm == other.d_shapedUsingRaqm &&
+                d_text == other.d_text;
+        }
+    };
+
+    //! Hash function for ShapedRunKey.
+    struct ShapedRunKeyHash
+    {
+        size_t operator()(const ShapedRunKey& key) const
+        {
+            return std::hash<String>()(key.d_text) ^
+                (static_cast<size_t>(key.d_paragraphDir) << 1) ^
+                static_cast<size_t>(key.d_shapedUsingRaqm);
+        }
+    };
+
+    //! Keys of the cached runs, from the most to the least recently drawn.
+    typedef std::list<const ShapedRunKey*> ShapedRunUseList;
+
+    //! A cached run and its place in the ShapedRunUseList.
+    struct ShapedRunCacheEntry
+    {
+        ShapedRun d_run;
+        ShapedRunUseList::iterator d_use;
+    };
+
+    //! Type for mapping strings to their laid out glyphs
+    typedef std::unordered_map<ShapedRunKey, ShapedRunCacheEntry,
+        ShapedRunKeyHash> ShapedRunCache;
 
-    /*
-    \brief
-        Changes the size of the texture and updates the data in it based on the old
-        texture's data. The size must be larger than the original one.
-     */
-    void resizeAndUpdateTexture(Texture* texture, int newSize) const;
-    void createTextureSpaceForGlyphRasterisation(Texture* texture, int glyphWidth, int glyphHeight) const;
    //! Register all properties of this class.
     void addFreeTypeFontProperties();
     //! Free all allocated font data.
@@ -287,22 +360,10 @@ protected:
         int glyphLeft, int glyphTop, int glyphWidth, int glyphHeight,
         unsigned int layer) const;
     
-    //! Helper functions for rasterisation
-    void addRasterisedGlyphToTextureAndSetupGlyphImage(
-        FreeTypeFontGlyph* glyph, Texture* texture,
-        FT_Bitmap& glyphBitmap, int glyphLeft, int glyphTop,
-        int glyphWidth, int glyphHeight, unsigned int layer,
-        const TextureGlyphLine& glyphTexLine) const;
-
-    void findFittingSpotInGlyphTextureLines(int glyphWidth, int glyphHeight,
-        bool &fittingLineWasFound, size_t &fittingLineIndex) const;
-
-    //! Adds a new glyph atlas line if the glyph would fit into there.
-    bool addNewLineIfFitting(unsigned int glyphHeight, unsigned int glyphWidth,
-        size_t & fittingLineIndex) const;
-
-    void createGlyphAtlasTexture() const;
-    static std::vector<argb_t> createGlyphTextureData(FT_Bitmap& glyph_bitmap);
+    //! Returns the glyph atlas, creating the font's own one if needed.
+    GlyphAtlas& getOrCreateGlyphAtlas() const;
+    //! Returns the coverage of the glyph bitmap, one byte per pixel.
+    static std::vector<std::uint8_t> createGlyphTextureData(FT_Bitmap& glyph_bitmap);
 
     //! Converts the FreeTypeLineCap to the assocated freetype library data type value
     static FT_Stroker_LineCap getLineCap(FreeTypeLineCap line_cap);
@@ -341,6 +402,25 @@ protected:
         float space_extra, ImageRenderSettings imgRenderSettings,
         glm::vec2& penPosition) const;
 
+    /*!
+    \brief
+        Returns the laid out glyphs of \a text from the shaped run cache,
+        shaping the text and adding it to the cache if needed.
+
+        The returned run stays valid until the next call.
+    */
+    const ShapedRun& getShapedRun(const String& text,
+        DefaultParagraphDirection defaultParagraphDir, bool use_raqm) const;
+
+    //! Lays out \a text using the glyph advances and kerning of the face.
+    void shapeUsingFreetype(const String& text, ShapedRun& run) const;
+
+#ifdef CEGUI_USE_RAQM
+    //! Lays out \a text using raqm, which handles bidi text and shaping.
+    void shapeUsingRaqm(const String& text,
+        DefaultParagraphDirection defaultParagraphDir, ShapedRun& run) const;
+#endif
+
     //! If non-zero, the overridden line spacing that we're to report.
     float d_specificLineSpacing;
     //! Specified font size for this font.
@@ -353,32 +433,33 @@ protected:
     FT_Face d_fontFace;
     //! Font file data
     RawDataContainer d_fontData;
-    //! Type definition for TextureVector.
-    typedef std::vector<Texture*> TextureVector;
-
     typedef std::vector<BitmapImage*> ImageVector;
     //! collection of images defined for this font.
     mutable ImageVector d_glyphImages;
 
-    //! Textures that hold the glyph imagery for this font.
-    mutable TextureVector d_glyphTextures;
-
     //! Contains mappings from code points to Font glyphs
     mutable CodePointToGlyphMap d_codePointToGlyphMap;
     //! Contains mappings from freetype indices to Font glyphs
     mutable IndexToCodePointMap d_indexToGlyphMap;
 
-    //! The size with which new texture atlases for glyphs are going to be initialised
-    int d_initialGlyphAtlasSize = 32;
-    //! The size of the last texture that has been created
-    mutable int d_lastTextureSize = 0;
-    //! Memory buffer for rendering the glyphs, this contains the data of the latest texture
-    mutable std::vector<argb_t> d_lastTextureBuffer;
-    //! Contains information about the extents of each line of glyphs of the latest texture
-    mutable std::vector<TextureGlyphLine> d_textureGlyphLines;
+    //! Size of the pages of the font's own glyph atlas, 0 for automatic.
+    int d_glyphAtlasPageSize = 0;
+    //! The atlas holding the glyph imagery for this font.
+    mutable GlyphAtlas* d_glyphAtlas = nullptr;
+    //! Whether d_glyphAtlas was created by, and is owned by, this font.
+    mutable bool d_ownsGlyphAtlas = false;
 
     //! collection of outline image layers defined for this font.
     mutable FreeTypeFontLayerVector d_fontLayers;
+
+    //! Laid out glyphs of recently drawn strings.
+    mutable ShapedRunCache d_shapedRunCache;
+    //! Order in which the entries of d_shapedRunCache were last drawn.
+    mutable ShapedRunUseList d_shapedRunUses;
+    //! Maximum number of entries in d_shapedRunCache.
+    size_t d_shapedRunCacheCapacity = 512;
+    //! Holds the run being drawn when the cache is disabled.
+    mutable ShapedRun d_uncachedShapedRun;
 };
 
 } // End of  CEGUI namespace section
@@ -91,6 +91,13 @@ public:
     ~GUIContext();
 
     Window* getRootWindow() const;
+
+    /*!
+    \brief
+        Returns the rendering statistics. These are collected by the System
+        and cover all contexts drawn in a frame.
+    */
+    RenderStats& getRenderStats() const;
     void setRootWindow(Window* new_root);
 
     /*!
@@ -115,6 +122,49 @@ public:
     bool isDirty() const { return d_dirtyDrawModeMask != 0; }
     std::uint32_t getDirtyDrawModeMask() const { return d_dirtyDrawModeMask; }
 
+    /*!
+    \brief
+        Set whether windows of this context defer the layout of their
+        children and the update of their screen area when moved or sized.
+
+        With deferred layout enabled, any number of area changes made to the
+        windows of this context are coalesced and performed by a single top
+        down pass, which runs before drawing and hit-testing the context or
+        when flushLayout is called. Until then, the screen areas and sizes of
+        the children of a moved or sized window are those of the last pass;
+        code that needs them must call flushLayout first.
+
+        Deferred layout is disabled by default. Disabling it flushes any
+        pending layout.
+    */
+    void setDeferredLayoutEnabled(bool enabled);
+
+    //! Return whether windows of this context defer their layout.
+    bool isDeferredLayoutEnabled() const { return d_deferredLayoutEnabled; }
+
+    /*!
+    \brief
+        Perform the layout deferred by the windows of this context, so that
+        all window areas are up to date.
+
+    \see setDeferredLayoutEnabled
+    */
+    void flushLayout() const;
+
+    //! Return whether the context is performing the deferred layout.
+    bool isFlushingLayout() const { return d_flushingLayout; }
+
+    /*!
+    \brief
+        Internal function to notify the context that a window deferred its
+        layout.
+
+    \note
+        This function is called internally by Window, and should not be called
+        by client code.
+    */
+    void markLayoutDirty() const { d_layoutDirty = true; }
+
     /*!
     \brief
         Retrieves Cursor used in this GUIContext
@@ -306,6 +356,13 @@ protected:
 
     //! the window navigator (if any) used to navigate the GUI
     WindowNavigator* d_windowNavigator;
+
+    //! whether windows of this context defer their layout
+    bool d_deferredLayoutEnabled = false;
+    //! true when some window of this context has deferred its layout
+    mutable bool d_layoutDirty = false;
+    //! true while flushLayout runs
+    mutable bool d_flushingLayout = false;
 };
 
 }
@@ -279,6 +279,47 @@ public:
     */
     virtual void appendGeometry(const TexturedColouredVertex* vertex_array, std::size_t vertex_count);
 
+    /*!
+    \brief
+        Grows the buffer by a number of vertices with texture coordinate and colour
+        attributes and returns a pointer to the first of them, so that the caller
+        can write the vertex data directly into the storage of the GeometryBuffer.
+        endAppendGeometry must be called once all vertices have been written.
+
+    \param vertex_count
+        The number of vertices that are to be added to the GeometryBuffer.
+
+    \return
+        Pointer to the first of the \a vertex_count newly added vertices. The
+        pointer is only valid until the vertex data of this GeometryBuffer is
+        modified again.
+    */
+    TexturedColouredVertex* beginAppendTexturedGeometry(std::size_t vertex_count);
+
+    /*!
+    \brief
+        Grows the buffer by a number of vertices with colour attributes and returns
+        a pointer to the first of them, so that the caller can write the vertex
+        data directly into the storage of the GeometryBuffer. endAppendGeometry
+        must be called once all vertices have been written.
+
+    \param vertex_count
+        The number of vertices that are to be added to the GeometryBuffer.
+
+    \return
+        Pointer to the first of the \a vertex_count newly added vertices. The
+        pointer is only valid until the vertex data of this GeometryBuffer is
+        modified again.
+    */
+    ColouredVertex* beginAppendColouredGeometry(std::size_t vertex_count);
+
+    /*!
+    \brief
+        Finishes an append operation that was started with
+        beginAppendTexturedGeometry or beginAppendColouredGeometry.
+    */
+    void endAppendGeometry();
+
     /*!
     \brief
         A helper function that sets a texture parameter of the RenderMaterial of this
@@ -509,6 +550,21 @@ public:
 protected:  
     GeometryBuffer(RefCounted<RenderMaterial> renderMaterial);
 
+    /*!
+    \brief
+        Grows the vertex data by the given number of floats and returns a
+        pointer to the first of the new elements.
+    */
+    float* growVertexData(std::size_t element_count);
+
+    /*!
+    \brief
+        Called whenever vertex data was appended to this GeometryBuffer.
+        Renderer specific buffers override this to update their hardware
+        buffers.
+    */
+    virtual void onGeometryAppended();
+
     //! Reference to the RenderMaterial used for this GeometryBuffer
     RefCounted<RenderMaterial>  d_renderMaterial;
 
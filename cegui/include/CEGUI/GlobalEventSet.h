@@ -93,6 +93,24 @@ public:
 		Nothing.
 	*/
     void fireEvent(const String& name, EventArgs& args, const String& eventNamespace = "") override;
+
+	/*!
+	\brief
+		Return whether any Event in the set, whatever its namespace, is named
+		as the event identified by \a id.  This is a cheap test used to avoid
+		building the namespaced name of events nobody subscribed to globally.
+	*/
+    bool isEventNameUsed(const EventId& id) const
+    {
+        return id.getValue() < d_usedEventNames.size() &&
+            d_usedEventNames[id.getValue()];
+    }
+
+protected:
+    void onEventAdded(Event& event) override;
+
+    //! Flags, indexed by EventId value, of the names used by the events.
+    std::vector<bool> d_usedEventNames;
 };
 
 } // End of  CEGUI namespace section
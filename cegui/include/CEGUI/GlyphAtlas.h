@@ -0,0 +1,188 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Defines a paged texture atlas holding rasterised glyphs
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGlyphAtlas_h_
+#define _CEGUIGlyphAtlas_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Texture.h"
+#include <vector>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class TextureAtlasAllocator;
+
+/*!
+\brief
+    A set of textures ("pages") of fixed size into which glyph images are
+    packed.
+
+    When no page has room for a new glyph, a new page is added; existing
+    pages are never resized, so glyphs that were already placed, and the
+    geometry referencing them, stay valid.
+
+    A GlyphAtlas may be shared by several fonts, including different sizes of
+    the same face, to reduce the number of partially filled textures. Space
+    is only given back when the atlas is cleared, so fonts whose glyphs are
+    regenerated often are better served by an atlas of their own.
+
+    The pages store a single alpha byte per pixel when the renderer supports
+    Texture::PixelFormat::Alpha, and fall back to RGBA otherwise. Glyphs are
+    always supplied as coverage values through blitCoverage, which converts
+    them to the format of the pages.
+
+    The placement of glyphs within a page is delegated to a
+    TextureAtlasAllocator; override createAllocator to use a different
+    packing strategy.
+*/
+class CEGUIEXPORT GlyphAtlas
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param name
+        Prefix for the names of the textures created for the pages.
+
+    \param page_size
+        Width and height, in pixels, of the pages.
+    */
+    GlyphAtlas(const String& name, int page_size);
+
+    virtual ~GlyphAtlas();
+
+    /*!
+    \brief
+        Reserves an area of the given size in one of the pages, adding a new
+        page if needed.
+
+    \param width
+        Width of the area, in pixels.
+
+    \param height
+        Height of the area, in pixels.
+
+    \param x
+        Receives the left edge of the reserved area within the page.
+
+    \param y
+        Receives the top edge of the reserved area within the page.
+
+    \return
+        The texture of the page in which the area was reserved.
+
+    \exception InvalidRequestException
+        thrown if the area does not fit into the largest texture supported
+        by the renderer.
+    */
+    Texture& allocate(int width, int height, int& x, int& y);
+
+    /*!
+    \brief
+        Writes glyph coverage values into an area of a page.
+
+    \param page
+        The page texture, as returned by allocate.
+
+    \param coverage
+        One byte per pixel, row by row without padding, 0 meaning transparent
+        and 255 fully covered.
+
+    \param area
+        The area of the page to write to.
+    */
+    void blitCoverage(Texture& page, const std::uint8_t* coverage,
+                      const Rectf& area) const;
+
+    /*!
+    \brief
+        Returns the pixel format of the pages.
+
+        This is only decided when the first page is created and is
+        Texture::PixelFormat::Rgba until then.
+    */
+    Texture::PixelFormat getPixelFormat() const { return d_pixelFormat; }
+
+    //! Destroys all the pages and their textures.
+    void clear();
+
+    //! Returns the number of pages.
+    size_t getPageCount() const { return d_pages.size(); }
+
+    //! Returns the texture of the page at \a index.
+    Texture& getPageTexture(size_t index) const;
+
+    //! Returns the size of newly created pages.
+    int getPageSize() const { return d_pageSize; }
+
+    //! Sets the size of the pages created from now on.
+    void setPageSize(int page_size);
+
+    //! Returns the fraction of the area of all the pages that is in use.
+    float getOccupancy() const;
+
+protected:
+    //! A texture together with the allocator managing its area.
+    struct Page
+    {
+        Texture* d_texture;
+        TextureAtlasAllocator* d_allocator;
+    };
+
+    //! Creates the allocator for a new page of the given size.
+    virtual TextureAtlasAllocator* createAllocator(int width, int height) const;
+
+    //! Creates an empty page of the given size and adds it to d_pages.
+    Page& addPage(int size);
+
+    //! Prefix of the names of the page textures.
+    String d_name;
+    //! Size of newly created pages.
+    int d_pageSize;
+    //! Number of pages created so far, used to give textures unique names.
+    unsigned int d_createdPageCount;
+    //! Pixel format of the pages.
+    Texture::PixelFormat d_pixelFormat;
+    //! The pages, oldest first.
+    std::vector<Page> d_pages;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIGlyphAtlas_h_
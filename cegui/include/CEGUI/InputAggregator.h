@@ -35,8 +35,12 @@
 #include "CEGUI/InjectedInputReceiver.h"
 #include "CEGUI/InputEventReceiver.h"
 #include "CEGUI/SemanticInputEvent.h"
+#include "CEGUI/SimpleTimer.h"
 
+#include <atomic>
 #include <cstdint>
+#include <thread>
+#include <vector>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -72,6 +76,8 @@ public:
     static const float DefaultMouseButtonClickTimeout;
     static const float DefaultMouseButtonMultiClickTimeout;
     static const Sizef DefaultMouseButtonMultiClickTolerance;
+    //! Number of inputs the injecting thread can queue between two processQueuedInput calls.
+    static const size_t InputQueueCapacity;
 
     /** Name of Event fired when the mouse click timeout is changed.
      * Handlers are passed a const reference to a GUIContextEventArgs struct.
@@ -194,7 +200,52 @@ public:
         actions on keydown.
      */
     void setModifierKeys(bool shift_down, bool alt_down, bool ctrl_down);
-    
+
+    /*!
+    \brief
+        Set whether the injected input is queued instead of being translated
+        and passed to the InputEventReceiver immediately.
+
+        While queueing, the inject functions may be called from one thread
+        other than the GUI thread, the one that enabled the queueing. That
+        thread only records the raw input in a lock-free queue, returning
+        false if the queue is full and the input was dropped. The input
+        injected from the GUI thread, including the input injected by event
+        handlers while the queue is processed, is kept apart from it.
+        processQueuedInput then translates all of it on the GUI thread,
+        usually once per frame before the GUI is updated, so the pointer
+        position, the click tracking and the key states are never touched by
+        the injecting thread.
+
+        Queueing has to be enabled before the injecting thread starts, and may
+        only be disabled from the GUI thread once it has stopped injecting.
+        Disabling the queueing processes the input that is still queued.
+    */
+    void setInputQueueingEnabled(bool enabled);
+
+    //! Return whether the injected input is queued.
+    bool isInputQueueingEnabled() const { return d_inputQueueingEnabled; }
+
+    /*!
+    \brief
+        Translate the queued input and pass the resulting events to the
+        InputEventReceiver. Must be called from the GUI thread.
+
+        The input of each thread is translated in the order it was injected,
+        that of the GUI thread first. Consecutive cursor moves are merged into
+        a single one to the final position, and consecutive mouse wheel
+        changes into a single one of the summed amount, so that a frame does
+        not hit-test every intermediate position. Clicks are still detected
+        using the times the input was injected at.
+
+        Input injected by the event handlers during the call waits for the
+        next one.
+
+    \return
+        The number of inputs translated, after merging.
+    */
+    size_t processQueuedInput();
+
     /************************************************************************/
     /* InjectedInputReceiver interface implementation                       */
     /************************************************************************/
@@ -242,6 +293,58 @@ protected:
     void recomputeMultiClickAbsoluteTolerance();
     virtual bool onDisplaySizeChanged(const EventArgs& args);
 
+    //! Pass a generated input event to the InputEventReceiver.
+    bool dispatchInputEvent(const InputEvent& event);
+
+    //! Kinds of raw input that can wait in the input queue.
+    enum class QueuedInputType
+    {
+        MousePosition,
+        MouseMove,
+        MouseLeaves,
+        MouseButtonDown,
+        MouseButtonUp,
+        MouseButtonClick,
+        MouseButtonDoubleClick,
+        MouseButtonTripleClick,
+        MouseWheelChange,
+        KeyDown,
+        KeyUp,
+        Char,
+        CopyRequest,
+        CutRequest,
+        PasteRequest
+    };
+
+    //! A raw input waiting in the input queue to be translated.
+    struct QueuedInput
+    {
+        QueuedInputType d_type;
+        //! position, move delta or wheel delta (in d_x).
+        float d_x;
+        float d_y;
+        //! mouse button, scan code or code point.
+        std::uint32_t d_code;
+        //! when the input was injected.
+        SimpleTimer::timePoint d_time;
+    };
+
+    //! Return whether an inject function called now has to queue its input.
+    bool isInputQueued() const;
+    /*!
+    \brief
+        Add a raw input to the queue of the calling thread.
+
+    \return
+        false if the queue was full and the input was dropped.
+    */
+    bool queueInput(QueuedInputType type, float x = 0.0f, float y = 0.0f,
+                    std::uint32_t code = 0);
+    //! Translate queued inputs on the GUI thread, merging moves and wheel changes.
+    size_t translateQueuedInput(const std::vector<QueuedInput>& inputs);
+    //! Return the time at which the input being translated was injected.
+    SimpleTimer::timePoint getInputTime() const;
+
     Event::Connection d_displaySizeChangedConnection;
 
     InputEventReceiver* d_inputReceiver;
@@ -268,6 +371,27 @@ protected:
     //! Mapping from a key to its semantic value
     SemanticValue d_keyValuesMappings[UCHAR_MAX]; 
     bool d_keysPressed[UCHAR_MAX];
+
+    //! whether the injected input is queued.
+    bool d_inputQueueingEnabled;
+    //! the GUI thread, which enabled the queueing and processes the queue.
+    std::thread::id d_inputQueueConsumer;
+    //! ring buffer of the input queued by the injecting thread.
+    std::vector<QueuedInput> d_inputQueue;
+    //! count of the inputs taken from the ring buffer, only advanced by processQueuedInput.
+    std::atomic<size_t> d_inputQueueHead;
+    //! count of the inputs added to the ring buffer, only advanced by the injecting thread.
+    std::atomic<size_t> d_inputQueueTail;
+    //! input queued by the GUI thread, kept out of the single producer ring buffer.
+    std::vector<QueuedInput> d_guiThreadInput;
+    //! inputs being translated by processQueuedInput, reused between calls.
+    std::vector<QueuedInput> d_translatedInput;
+    //! whether processQueuedInput is running, so that it is not re-entered.
+    bool d_processingQueuedInput;
+    //! whether a queued input is being translated, as opposed to being injected.
+    bool d_translatingQueuedInput;
+    //! when the queued input being translated was injected.
+    SimpleTimer::timePoint d_queuedInputTime;
 };
 
 } // End of  CEGUI namespace section
@@ -36,6 +36,52 @@
 namespace CEGUI
 {
 
+/*!
+\brief
+    Key frame values of an Affector, parsed by an Interpolator to the type it
+    interpolates.
+
+    This allows the Affector to apply values to a TypedProperty of that type
+    natively, skipping the formatting and parsing of strings in every step.
+
+\see
+    Interpolator::createTypedKeyFrames
+*/
+class CEGUIEXPORT TypedKeyFrames
+{
+public:
+    virtual ~TypedKeyFrames() {}
+
+    /*!
+    \brief
+        Returns whether the values can be applied natively to given property
+    */
+    virtual bool isApplicableTo(const Property& property) const = 0;
+
+    /*!
+    \brief
+        Applies the value interpolated between two key frames to the target of
+        given animation instance.
+
+    \param property
+        Property of the target to set, isApplicableTo must have returned true
+        for it.
+
+    \param left
+        Index of the key frame to interpolate from.
+
+    \param right
+        Index of the key frame to interpolate to.
+
+    \param base
+        Saved base value when the values are applied relatively, nullptr when
+        they are applied as absolutes.
+    */
+    virtual void apply(AnimationInstance& instance, Property& property,
+                       size_t left, size_t right, float position,
+                       const String* base) = 0;
+};
+
 /*!
 \brief
     Defines a 'interpolator' class
@@ -85,6 +131,20 @@ public:
             const String& value1,
             const String& value2,
             float position) = 0;
+
+    /*!
+    \brief
+        Creates the values of the key frames of given affector parsed for
+        native application, or returns nullptr if this interpolator only works
+        on strings, which is what the default implementation does.
+
+        Key frame values are only used for absolute and relative application,
+        relative multiply application always goes through the string methods.
+    */
+    virtual TypedKeyFrames* createTypedKeyFrames(const Affector& /*affector*/)
+    {
+        return nullptr;
+    }
 };
 
 } // End of  CEGUI namespace section
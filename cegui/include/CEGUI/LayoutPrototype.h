@@ -0,0 +1,112 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Defines a parsed layout that windows can be created from
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUILayoutPrototype_h_
+#define _CEGUILayoutPrototype_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    A gui-layout parsed once, from which any number of identical window
+    hierarchies can then be created.
+
+    Creating windows from a prototype gives the same result as loading the
+    layout with WindowManager::loadLayoutFromFile, without parsing the XML
+    again. Property values are interpreted the first time they are set and
+    then set in their native type on every further instance, as long as the
+    windows created resolve the property to the same Property object.
+
+    Unlike WindowManager::loadLayoutFromFile, no PropertyCallback can be
+    used, and imported layouts are read when the prototype is loaded.
+*/
+class CEGUIEXPORT LayoutPrototype
+{
+public:
+    LayoutPrototype();
+    ~LayoutPrototype();
+
+    /*!
+    \brief
+        Load the prototype from a gui-layout file, replacing any previously
+        loaded one.
+
+    \param filename
+        String object holding the filename of the layout to be loaded.
+
+    \param resourceGroup
+        Resource group identifier to be passed to the resource provider when
+        loading the layout file.
+    */
+    void loadFromFile(const String& filename, const String& resourceGroup = "");
+
+    //! Load the prototype from a RawDataContainer holding a gui-layout.
+    void loadFromContainer(const RawDataContainer& source);
+
+    //! Load the prototype from a string holding a gui-layout.
+    void loadFromString(const String& source);
+
+    //! Return whether a layout has been loaded into the prototype.
+    bool isLoaded() const { return d_root != nullptr; }
+
+    /*!
+    \brief
+        Create a new window hierarchy from the prototype.
+
+    \return
+        The root window of the created hierarchy, which the caller must
+        destroy through the WindowManager as with a loaded layout.
+
+    \exception InvalidRequestException
+        Thrown if no layout is loaded or if one of the windows could not be
+        created; any window created so far is destroyed.
+    */
+    Window* instantiate() const;
+
+private:
+    struct WindowNode;
+    class LayoutHandler;
+
+    LayoutPrototype(const LayoutPrototype&);
+    LayoutPrototype& operator=(const LayoutPrototype&);
+
+    //! set the values recorded in a node on a window, creating its children.
+    void initialiseWindow(const WindowNode& node, Window& window) const;
+
+    //! replace the loaded prototype with the one built by the handler.
+    void setRoot(WindowNode* root);
+
+    WindowNode* d_root;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUILayoutPrototype_h_
@@ -104,6 +104,22 @@ public:
 	LoggingLevel	getLoggingLevel(void) const		{return d_level;}
 
 
+    /*!
+    \brief
+        Return whether messages of the given level pass the current logging
+        level.  Callers that build expensive messages should check this first
+        (or use the CEGUI_LOG macro), so that filtered messages cost nothing.
+
+    \param level
+        LoggingLevel of the message that is about to be logged.
+
+    \return
+        - true if a message of \a level would be logged.
+        - false if it would be discarded.
+    */
+    bool isLoggingLevelEnabled(LoggingLevel level) const {return level <= d_level;}
+
+
 	/*!
 	\brief
 		Add an event to the log.
@@ -138,6 +154,19 @@ public:
      */
     virtual void setLogFilename(const String& filename, bool append = false) = 0;
 
+    /*!
+    \brief
+        Returns the hexadecimal representation of a memory address, as used in
+        the log messages about the creation and destruction of objects.
+
+    \param address
+        The address to be represented.
+
+    \return
+        String containing the address, such as "0x7f3a2c001e40".
+    */
+    static String addressToString(const void* address);
+
 protected:
 	LoggingLevel	d_level;		//!< Holds current logging level
 
@@ -150,12 +179,25 @@ private:
 
 };
 
+/*************************************************************************
+	This macro logs a message only if its level passes the current logging
+	level; the \a message expression is not evaluated otherwise, so building
+	the string costs nothing for filtered messages.
+*************************************************************************/
+#define CEGUI_LOG( level, message ) \
+    do \
+    { \
+        CEGUI::Logger& cegui_log_logger_ = CEGUI::Logger::getSingleton(); \
+        if (cegui_log_logger_.isLoggingLevelEnabled(level)) \
+            cegui_log_logger_.logEvent((message), (level)); \
+    } while (false)
+
 /*************************************************************************
 	This macro is used for 'LoggingLevel::Insane' level logging so that those items are
 	excluded from non-debug builds
 *************************************************************************/
 #if defined(DEBUG) || defined (_DEBUG)
-#	define CEGUI_LOGINSANE( message ) CEGUI::Logger::getSingleton().logEvent((message), CEGUI::LoggingLevel::Insane);
+#	define CEGUI_LOGINSANE( message ) CEGUI_LOG(CEGUI::LoggingLevel::Insane, (message));
 #else
 #	define CEGUI_LOGINSANE( message ) (void)0
 #endif
@@ -50,6 +50,26 @@ public:
 };
 
 
+/*!
+\brief
+    A property value parsed once, which can then be set on any number of
+    receivers of the Property that prepared it without being parsed again.
+
+\see Property::prepareValue
+*/
+class CEGUIEXPORT PreparedPropertyValue
+{
+public:
+    virtual ~PreparedPropertyValue() {}
+
+    //! Set the value on the given receiver.
+    virtual void apply(PropertyReceiver* receiver) const = 0;
+
+    //! Return whether the given receiver currently has this value.
+    virtual bool isApplied(const PropertyReceiver* receiver) const = 0;
+};
+
+
 /*!
 \brief
 	An abstract class that defines the interface to access object properties by name.
@@ -170,6 +190,33 @@ public:
 	*/
 	virtual void	set(PropertyReceiver* receiver, const String& value) = 0;
 
+    /*!
+    \brief
+        Interpret a textual value once, so it can be set on many receivers.
+
+        The default implementation keeps the string and passes it to set.
+
+    \return
+        The prepared value, which the caller must delete. It must not be used
+        once this Property is destroyed.
+
+    \exception InvalidRequestException	Thrown when the Property was unable to interpret the content of \a value.
+    */
+    virtual PreparedPropertyValue* prepareValue(const String& value);
+
+    /*!
+    \brief
+        Take the current value of the property on a receiver, so it can be set
+        on other receivers or compared with their value later.
+
+        The default implementation prepares the value returned by get.
+
+    \return
+        The prepared value, which the caller must delete. It must not be used
+        once this Property is destroyed.
+    */
+    virtual PreparedPropertyValue* prepareCurrentValue(const PropertyReceiver* receiver);
+
 
 	/*!
 	\brief
@@ -39,6 +39,7 @@
 // we also define the CEGUI_DEFINE_PROPERTY macro that relies on this here
 #include "CEGUI/TplWindowProperty.h"
 #include "CEGUI/Exceptions.h"
+#include <cstdint>
 #include <unordered_map>
 
 #if defined(_MSC_VER)
@@ -111,7 +112,7 @@ public:
 	\brief
 		Constructs a new PropertySet object
 	*/
-    PropertySet(void) {}
+    PropertySet(void) : d_propertyRevision(0) {}
 
 
     /*!
@@ -313,9 +314,19 @@ public:
 	*/
     String getPropertyDefault(const String& name) const;
 
+    /*!
+    \brief
+        Returns a number that changes each time a Property is added to or
+        removed from the set, so that Property pointers taken from it can be
+        checked for still being valid.
+    */
+    std::uint32_t getPropertyRevision() const { return d_propertyRevision; }
+
 private:
     typedef std::unordered_map<String, Property*> PropertyRegistry;
     PropertyRegistry	d_properties;
+    //! incremented whenever properties are added or removed.
+    std::uint32_t d_propertyRevision;
 
 
 public:
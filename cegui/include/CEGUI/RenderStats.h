@@ -0,0 +1,223 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Defines per-frame rendering statistics and scoped timers
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIRenderStats_h_
+#define _CEGUIRenderStats_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include "CEGUI/SimpleTimer.h"
+#include <chrono>
+#include <unordered_map>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class Window;
+
+//! The parts of rendering that RenderStats measures the time of.
+enum class RenderStatsTimer : int
+{
+    //! Window::draw, including the children of the window.
+    WindowDraw,
+    //! Window::bufferGeometry of windows that needed to be redrawn.
+    BufferGeometry,
+    //! Renderer::uploadBuffers.
+    UploadBuffers,
+    //! RenderQueue::draw.
+    RenderQueueDraw,
+    //! Font layout and glyph geometry creation.
+    FontLayout,
+    //! Number of timers, not a timer itself.
+    Count
+};
+
+/*!
+\brief
+    Collects counters and timings of the rendering done in a frame.
+
+    A frame is delimited by beginFrame and endFrame, which
+    System::renderAllGUIContexts calls; applications drawing the GUIContext
+    objects themselves should call them too. Once a frame ends, its figures
+    are available through getLastFrameStats until the next one ends.
+
+    Nothing is recorded while the statistics are disabled, which is the
+    default, so that the instrumented code only pays for a flag check. The
+    per window breakdown has to be enabled separately, as it is more costly.
+*/
+class CEGUIEXPORT RenderStats
+{
+public:
+    //! The figures collected over a frame.
+    struct FrameStats
+    {
+        //! Number of GeometryBuffer draw calls.
+        size_t d_geometryBuffersDrawn;
+        //! Number of vertices in the drawn GeometryBuffers.
+        size_t d_verticesDrawn;
+        //! Number of vertices in the buffers handed to Renderer::uploadBuffers.
+        size_t d_verticesUploaded;
+        //! Number of Window::draw calls for visible windows.
+        size_t d_windowsDrawn;
+        //! Number of windows that rebuilt their geometry as they needed a redraw.
+        size_t d_windowsRebuffered;
+        //! Seconds between beginFrame and endFrame.
+        double d_frameTime;
+        //! Seconds spent in each part, indexed by RenderStatsTimer.
+        double d_times[static_cast<int>(RenderStatsTimer::Count)];
+
+        //! Returns the seconds spent in the given part.
+        double getTime(RenderStatsTimer timer) const
+            { return d_times[static_cast<int>(timer)]; }
+    };
+
+    //! The figures of a window that rebuilt its geometry.
+    struct WindowStats
+    {
+        //! Name path of the window.
+        String d_namePath;
+        //! Number of times the geometry was rebuilt in the frame.
+        size_t d_rebufferCount;
+        //! Seconds spent rebuilding the geometry.
+        double d_bufferGeometryTime;
+        //! Number of vertices of the rebuilt geometry.
+        size_t d_vertexCount;
+    };
+
+    typedef std::unordered_map<const Window*, WindowStats> WindowStatsMap;
+
+    /*!
+    \brief
+        Measures the time until it goes out of scope and adds it to a timer.
+
+        Nested measurements of the same timer, such as the recursion of
+        Window::draw into the children, only count once. The clock is only
+        read by the outermost measurement, and not at all while the
+        statistics are disabled.
+    */
+    class CEGUIEXPORT ScopedTimer
+    {
+    public:
+        ScopedTimer(RenderStats& stats, RenderStatsTimer timer);
+        ~ScopedTimer();
+
+    private:
+        ScopedTimer(const ScopedTimer&);
+        ScopedTimer& operator=(const ScopedTimer&);
+
+        RenderStats* d_stats;
+        RenderStatsTimer d_timer;
+        std::chrono::steady_clock::time_point d_startTime;
+    };
+
+    RenderStats();
+
+    //! Returns whether statistics are being collected.
+    bool isEnabled() const { return d_enabled; }
+
+    //! Sets whether statistics are being collected.
+    void setEnabled(bool enabled);
+
+    //! Returns whether the per window breakdown is being collected.
+    bool isWindowStatsEnabled() const { return d_windowStatsEnabled; }
+
+    /*!
+    \brief
+        Sets whether the figures of each window that rebuilt its geometry are
+        collected. This only has an effect while the statistics are enabled.
+    */
+    void setWindowStatsEnabled(bool enabled);
+
+    //! Starts a new frame, resetting the counters of the current one.
+    void beginFrame();
+
+    //! Ends the current frame, making its figures the ones of the last frame.
+    void endFrame();
+
+    //! Returns the figures of the frame in progress.
+    const FrameStats& getCurrentFrameStats() const { return d_currentFrame; }
+
+    //! Returns the figures of the last completed frame.
+    const FrameStats& getLastFrameStats() const { return d_lastFrame; }
+
+    //! Returns the per window breakdown of the last completed frame.
+    const WindowStatsMap& getLastFrameWindowStats() const
+        { return d_lastFrameWindows; }
+
+    //! Records a GeometryBuffer draw call.
+    void addGeometryBufferDrawn(size_t vertex_count)
+    {
+        ++d_currentFrame.d_geometryBuffersDrawn;
+        d_currentFrame.d_verticesDrawn += vertex_count;
+    }
+
+    //! Records vertices handed to the renderer for uploading.
+    void addVerticesUploaded(size_t vertex_count)
+        { d_currentFrame.d_verticesUploaded += vertex_count; }
+
+    //! Records a draw of a visible window.
+    void addWindowDrawn() { ++d_currentFrame.d_windowsDrawn; }
+
+    //! Records a window rebuilding its geometry.
+    void addWindowRebuffered(const Window& window, double time,
+                             size_t vertex_count);
+
+protected:
+    //! Returns whether a measure of the timer starts, rather than nests.
+    bool beginTiming(RenderStatsTimer timer);
+
+    //! Adds the time since \a start to a timer, unless the measure is nested.
+    void endTiming(RenderStatsTimer timer,
+                   const std::chrono::steady_clock::time_point& start);
+
+    //! Resets all figures of a frame.
+    static void resetFrameStats(FrameStats& stats);
+
+    bool d_enabled;
+    bool d_windowStatsEnabled;
+    FrameStats d_currentFrame;
+    FrameStats d_lastFrame;
+    WindowStatsMap d_currentFrameWindows;
+    WindowStatsMap d_lastFrameWindows;
+    //! Number of measures in progress for each timer.
+    int d_timerDepth[static_cast<int>(RenderStatsTimer::Count)];
+    //! Measures the time between beginFrame and endFrame.
+    SimpleTimer d_frameTimer;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIRenderStats_h_
@@ -54,7 +54,6 @@ public:
 
     // Implement GeometryBuffer interface.
     virtual void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const;
-    virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
 
     /*
     \brief
@@ -66,6 +65,8 @@ public:
     void finaliseVertexAttributes();
 
 protected:
+    // Implement GeometryBuffer interface.
+    virtual void onGeometryAppended();
     //! Update the cached matrices
     void updateMatrix() const;
     //! Synchronise data in the hardware buffer with what's been added
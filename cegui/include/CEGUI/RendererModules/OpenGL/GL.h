@@ -189,6 +189,14 @@ public:
     bool isSizedInternalFormatSupported() const
       { return d_isSizedInternalFormatSupported; }
 
+    /*!
+    \brief
+        Returns true if the channels read from a texture can be remapped with
+        the "GL_TEXTURE_SWIZZLE_*" texture parameters.
+    */
+    bool isTextureSwizzleSupported() const
+      { return d_isTextureSwizzleSupported; }
+
     /* For internal use. Used to force the object to act is if we're using a
        context of the specificed "verMajor_.verMinor_". This is useful to
        check that an OpenGL (desktop/ES) version lower than the actual one
@@ -217,6 +225,7 @@ private:
     bool d_isSeperateReadAndDrawFramebufferSupported;
     bool d_isVaoSupported;
     bool d_isSizedInternalFormatSupported;
+    bool d_isTextureSwizzleSupported;
 };
 
 } // namespace CEGUI
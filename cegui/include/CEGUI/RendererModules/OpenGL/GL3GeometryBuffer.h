@@ -47,7 +47,6 @@ public:
 
     // Overrides of virtual and abstract methods from GeometryBuffer
     void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const override;
-    void appendGeometry(const float* vertex_data, std::size_t array_size) override;
     void reset() override;
 
     // Implementation/overrides of member functions inherited from OpenGLGeometryBufferBase
@@ -56,6 +55,9 @@ public:
     std::size_t d_verticesVBOPosition;
 
 protected:
+    // Overrides of virtual methods from GeometryBuffer
+    void onGeometryAppended() override;
+
     void initialiseVertexBuffers();
     void deinitialiseOpenGLBuffers();
     //! Update the OpenGL buffer objects containing the vertex data.
@@ -42,6 +42,9 @@ namespace CEGUI
 //! Texture implementation for the OpenGL3Renderer.
 class OPENGL_GUIRENDERER_API OpenGL3Texture : public OpenGL1Texture
 {
+public:
+    bool isPixelFormatSupported(const PixelFormat fmt) const override;
+
 protected:
     friend class OpenGL3Renderer;
 
@@ -52,6 +55,21 @@ protected:
 
     //! OpenGL method to set glTexEnv which is deprecated in GL 3.2 and GLES 2.0 and above
     void setTextureEnvironment() override;
+
+    /*!
+    \brief
+        Stores PixelFormat::Alpha data in the red channel, as GL_ALPHA textures
+        are not available in core profiles.
+    */
+    void initInternalPixelFormatFields(const PixelFormat fmt) override;
+
+    /*!
+    \brief
+        Resizes the texture and sets up the swizzle that makes single channel
+        textures sample as white with the stored value as alpha, so that the
+        standard textured shader can draw them.
+    */
+    void setTextureSize_impl(const Sizef& sz) override;
 };
 
 } // End of  CEGUI namespace section
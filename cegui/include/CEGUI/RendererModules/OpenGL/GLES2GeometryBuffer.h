@@ -48,13 +48,15 @@ public:
 
     // Overrides of virtual and abstract methods from GeometryBuffer
     void draw() const override;
-    void appendGeometry(const float* vertex_data, std::size_t array_size) override;
     void reset() override;
 
     // Implementation/overrides of member functions inherited from OpenGLGeometryBufferBase
     void finaliseVertexAttributes();
 
 protected:
+    // Overrides of virtual methods from GeometryBuffer
+    void onGeometryAppended() override;
+
     void initialiseVertexBuffers();
     void deinitialiseOpenGLBuffers();
     //! Update the OpenGL buffer objects containing the vertex data.
@@ -46,6 +46,7 @@ public:
     virtual ~OpenGL1Texture();
 
     void blitToMemory(void* targetData) override;
+    bool isPixelFormatSupported(const PixelFormat fmt) const override;
 
 protected:
     //! OpenGL method to set glTexEnv which is deprecated in GL 3.2 and GLES 2.0 and above
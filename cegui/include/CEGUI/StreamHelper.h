@@ -28,8 +28,10 @@
 #define _StreamHelper_h_
 
 #include "CEGUI/Base.h"
+#include "CEGUI/String.h"
 
 #include <istream>
+#include <sstream>
 
 namespace CEGUI
 {
@@ -87,6 +89,17 @@ std::istream& mandatoryChar(std::istream& inputStream)
 }
 
 
+/*!
+\brief
+    Helper method to set up a stringstream for reading the supplied String. The
+    stream is reset to contain the String, converted to UTF-8, and to use the
+    "C" locale, so that numbers are read and written the same way regardless of
+    the global locale.
+    Usage, for example: std::stringstream strStream; prepareStream(strStream, value);
+*/
+CEGUIEXPORT void prepareStream(std::stringstream& stream, const String& value = String());
+
+
 /*!
 \brief
     A class that can be used to match and extract a mandatory sequence of characters from a string
@@ -216,6 +216,13 @@ public:
     */
     Clipboard* getClipboard() const         {return d_clipboard;}
 
+    /*!
+    \brief
+        Returns the per-frame rendering statistics, which are disabled until
+        RenderStats::setEnabled is called.
+    */
+    RenderStats& getRenderStats() const     {return *d_renderStats;}
+
     typedef std::vector<GUIContext*> GUIContextCollection;
     GUIContextCollection& getGUIContexts()         {return d_guiContexts;}
 
@@ -652,6 +659,7 @@ protected:
 
     Clipboard* d_clipboard;         //!< Internal clipboard with optional sync with native clipboard
     NativeClipboardProvider* d_nativeClipboardProvider; //!< the default native clipboard provider (only on Win32 for now)
+    RenderStats* d_renderStats;     //!< Counters and timings of the rendered frames.
 
     // scripting
     ScriptModule*    d_scriptModule;            //!< Points to the scripting support module.
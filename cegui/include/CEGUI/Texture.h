@@ -77,7 +77,13 @@ public:
         //! S3 DXT1 texture compression (RGBA).
         RgbaDxt3,
         //! S3 DXT1 texture compression (RGBA).
-        RgbaDxt5
+        RgbaDxt5,
+        /*!
+            Each pixel is 1 byte holding the alpha; the colour channels sample
+            as white. Not every renderer supports this, check with
+            isPixelFormatSupported before using it.
+        */
+        Alpha
     };
 
     /*!
@@ -0,0 +1,146 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Defines the interface for allocating areas of a texture atlas
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureAtlasAllocator_h_
+#define _CEGUITextureAtlasAllocator_h_
+
+#include "CEGUI/Base.h"
+#include <vector>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Interface for objects deciding where rectangles are placed inside a
+    texture atlas page of fixed size.
+
+    Allocated areas are never released individually; the whole page is
+    emptied by calling reset.
+*/
+class CEGUIEXPORT TextureAtlasAllocator
+{
+public:
+    TextureAtlasAllocator(int width, int height);
+    virtual ~TextureAtlasAllocator();
+
+    /*!
+    \brief
+        Finds room for a rectangle of the given size and reserves it.
+
+    \param width
+        Width of the rectangle to reserve, in pixels.
+
+    \param height
+        Height of the rectangle to reserve, in pixels.
+
+    \param x
+        Receives the left edge of the reserved area.
+
+    \param y
+        Receives the top edge of the reserved area.
+
+    \return
+        - true if the area was reserved.
+        - false if the page has no room for the rectangle.
+    */
+    virtual bool allocate(int width, int height, int& x, int& y) = 0;
+
+    //! Releases all the reserved areas.
+    virtual void reset();
+
+    //! Returns the width of the page.
+    int getWidth() const { return d_width; }
+
+    //! Returns the height of the page.
+    int getHeight() const { return d_height; }
+
+    //! Returns the fraction of the page area that has been reserved.
+    float getOccupancy() const;
+
+protected:
+    //! Width of the page.
+    int d_width;
+    //! Height of the page.
+    int d_height;
+    //! Sum of the areas reserved so far.
+    long long d_allocatedArea;
+};
+
+/*!
+\brief
+    TextureAtlasAllocator keeping track of the skyline, the upper contour of
+    the rectangles placed so far, and placing each new rectangle at the
+    lowest position along it.
+
+    Unlike a shelf packer, a short glyph placed next to a tall one does not
+    waste the space above it, which gives a noticeably denser atlas for text.
+*/
+class CEGUIEXPORT SkylineTextureAtlasAllocator : public TextureAtlasAllocator
+{
+public:
+    SkylineTextureAtlasAllocator(int width, int height);
+
+    bool allocate(int width, int height, int& x, int& y) override;
+    void reset() override;
+
+protected:
+    //! A horizontal segment of the skyline.
+    struct SkylineNode
+    {
+        int d_x;
+        int d_y;
+        int d_width;
+    };
+
+    /*!
+    \brief
+        Returns the y position at which a rectangle of the given size fits when
+        its left edge is put at the start of the node at \a index, or -1 if it
+        does not fit there.
+    */
+    int fitAt(size_t index, int width, int height) const;
+
+    //! Adds a node for a rectangle placed at \a index and trims the others.
+    void addNode(size_t index, int x, int y, int width, int height);
+
+    //! The segments of the skyline, from left to right.
+    std::vector<SkylineNode> d_skyline;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUITextureAtlasAllocator_h_
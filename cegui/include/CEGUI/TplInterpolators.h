@@ -32,6 +32,10 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/TypedProperty.h"
+#include "CEGUI/Affector.h"
+#include "CEGUI/AnimationInstance.h"
+#include <vector>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -57,6 +61,73 @@ private:
     const String d_type;
 };
 
+/*!
+ \brief Key frame values parsed to T and interpolated by Interp
+
+ Interp has to provide static interpolateAbsoluteNative and
+ interpolateRelativeNative methods working on T.
+ */
+template<typename T, class Interp>
+class TplTypedKeyFrames : public TypedKeyFrames
+{
+public:
+    typedef PropertyHelper<T> Helper;
+
+    TplTypedKeyFrames(const Affector& affector)
+    {
+        const size_t count = affector.getNumKeyFrames();
+        d_values.reserve(count);
+        d_sourceProperties.reserve(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const KeyFrame* keyFrame = affector.getKeyFrameAtIndex(i);
+            const String& sourceProperty = keyFrame->getSourceProperty();
+
+            // values of key frames linked to a property are only known once
+            // the animation instance saved them
+            d_values.push_back(sourceProperty.empty() ?
+                T(Helper::fromString(keyFrame->getValue())) : T());
+            d_sourceProperties.push_back(sourceProperty);
+        }
+    }
+
+    //! \copydoc TypedKeyFrames::isApplicableTo
+    bool isApplicableTo(const Property& property) const override
+    {
+        return property.isWritable() &&
+            dynamic_cast<const TypedProperty<T>*>(&property) != nullptr;
+    }
+
+    //! \copydoc TypedKeyFrames::apply
+    void apply(AnimationInstance& instance, Property& property,
+               size_t left, size_t right, float position,
+               const String* base) override
+    {
+        const T result = base ?
+            Interp::interpolateRelativeNative(Helper::fromString(*base),
+                getValue(instance, left), getValue(instance, right), position) :
+            Interp::interpolateAbsoluteNative(
+                getValue(instance, left), getValue(instance, right), position);
+
+        static_cast<TypedProperty<T>&>(property).setNative(
+            instance.getTarget(), result);
+    }
+
+private:
+    T getValue(AnimationInstance& instance, size_t index) const
+    {
+        if (d_sourceProperties[index].empty())
+            return d_values[index];
+
+        return Helper::fromString(
+            instance.getSavedPropertyValue(d_sourceProperties[index]));
+    }
+
+    std::vector<T> d_values;
+    std::vector<String> d_sourceProperties;
+};
+
 /*!
  \brief Generic linear interpolator class
  
@@ -75,18 +146,26 @@ public:
     
     //! destructor
     virtual ~TplLinearInterpolator() {}
+
+    //! interpolates native values for absolute application
+    static T interpolateAbsoluteNative(T val1, T val2, float position)
+    {
+        return static_cast<T>(val1 * (1.0f - position) + val2 * (position));
+    }
+
+    //! interpolates native values for relative application
+    static T interpolateRelativeNative(T bas, T val1, T val2, float position)
+    {
+        return static_cast<T>(bas + (val1 * (1.0f - position) + val2 * (position)));
+    }
     
     //! \copydoc Interpolator::interpolateAbsolute
     String interpolateAbsolute(const String& value1,
                                        const String& value2,
                                        float position) override
     {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        const T result = static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
-
-        return Helper::toString(result);
+        return Helper::toString(interpolateAbsoluteNative(
+            Helper::fromString(value1), Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelative
@@ -95,13 +174,9 @@ public:
                                        const String& value2,
                                        float position) override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        const T result = static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
-
-        return Helper::toString(result);
+        return Helper::toString(interpolateRelativeNative(
+            Helper::fromString(base), Helper::fromString(value1),
+            Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelativeMultiply
@@ -120,6 +195,12 @@ public:
 
         return Helper::toString(result);
     }
+
+    //! \copydoc Interpolator::createTypedKeyFrames
+    TypedKeyFrames* createTypedKeyFrames(const Affector& affector) override
+    {
+        return new TplTypedKeyFrames<T, TplLinearInterpolator<T> >(affector);
+    }
 };
 
 /*!
@@ -141,18 +222,31 @@ public:
     
     //! destructor
     virtual ~TplDiscreteInterpolator() {}
+
+    //! picks the native value closest to position for absolute application
+    static T interpolateAbsoluteNative(typename Helper::pass_type val1,
+                                       typename Helper::pass_type val2,
+                                       float position)
+    {
+        return position < 0.5 ? val1 : val2;
+    }
+
+    //! picks the native value closest to position, the base is ignored
+    static T interpolateRelativeNative(typename Helper::pass_type /*bas*/,
+                                       typename Helper::pass_type val1,
+                                       typename Helper::pass_type val2,
+                                       float position)
+    {
+        return position < 0.5 ? val1 : val2;
+    }
     
     //! \copydoc Interpolator::interpolateAbsolute
     String interpolateAbsolute(const String& value1,
                                        const String& value2,
                                        float position) override
     {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;
-
-        return Helper::toString(result);
+        return Helper::toString(interpolateAbsoluteNative(
+            Helper::fromString(value1), Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelative
@@ -161,13 +255,8 @@ public:
                                        const String& value2,
                                        float position) override
     {
-        //typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;
-        
-        return Helper::toString(result);
+        return Helper::toString(interpolateAbsoluteNative(
+            Helper::fromString(value1), Helper::fromString(value2), position));
     }
     
     //! \copydoc Interpolator::interpolateRelativeMultiply
@@ -185,6 +274,12 @@ public:
         // there is nothing we can do, we have no idea what operators T has overloaded
         return Helper::toString(bas);
     }
+
+    //! \copydoc Interpolator::createTypedKeyFrames
+    TypedKeyFrames* createTypedKeyFrames(const Affector& affector) override
+    {
+        return new TplTypedKeyFrames<T, TplDiscreteInterpolator<T> >(affector);
+    }
 };
 
 /*!
@@ -207,6 +302,15 @@ public:
     
     //! destructor
     virtual ~TplDiscreteRelativeInterpolator() {}
+
+    //! adds the native value closest to position to the base
+    static T interpolateRelativeNative(typename Helper::pass_type bas,
+                                       typename Helper::pass_type val1,
+                                       typename Helper::pass_type val2,
+                                       float position)
+    {
+        return bas + (position < 0.5 ? val1 : val2);
+    }
     
     //! \copydoc Interpolator::interpolateRelative
     String interpolateRelative(const String& base,
@@ -214,13 +318,15 @@ public:
                                        const String& value2,
                                        float position) override
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = bas + (position < 0.5 ? val1 : val2);
-        
-        return Helper::toString(result);
+        return Helper::toString(interpolateRelativeNative(
+            Helper::fromString(base), Helper::fromString(value1),
+            Helper::fromString(value2), position));
+    }
+
+    //! \copydoc Interpolator::createTypedKeyFrames
+    TypedKeyFrames* createTypedKeyFrames(const Affector& affector) override
+    {
+        return new TplTypedKeyFrames<T, TplDiscreteRelativeInterpolator<T> >(affector);
     }
 };
 
@@ -34,9 +34,11 @@
 #include "CEGUI/Property.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Exceptions.h"
+#include <type_traits>
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+template<typename T> class TypedPreparedPropertyValue;
 
 /*!
 \brief base class for properties able to do native set/get
@@ -72,6 +74,24 @@ public:
     {
         setNative(receiver, Helper::fromString(value));
     }
+    //! \copydoc Property::prepareValue
+    PreparedPropertyValue* prepareValue(const String& value) override
+    {
+        // objects referenced by pointer, such as fonts and images, may be
+        // destroyed and recreated after the value was prepared
+        if (std::is_pointer<T>::value)
+            return Property::prepareValue(value);
+
+        return new TypedPreparedPropertyValue<T>(*this, Helper::fromString(value));
+    }
+    //! \copydoc Property::prepareCurrentValue
+    PreparedPropertyValue* prepareCurrentValue(const PropertyReceiver* receiver) override
+    {
+        if (std::is_pointer<T>::value)
+            return Property::prepareCurrentValue(receiver);
+
+        return new TypedPreparedPropertyValue<T>(*this, getNative(receiver));
+    }
 
     /*!
     \brief native set method, sets the property given a native type
@@ -102,6 +122,35 @@ protected:
     virtual typename Helper::safe_method_return_type getNative_impl(const PropertyReceiver* receiver) const = 0;
 };
 
+/*!
+\brief
+    Prepared value of a TypedProperty, holding the value in its native type.
+*/
+template<typename T>
+class TypedPreparedPropertyValue : public PreparedPropertyValue
+{
+public:
+    TypedPreparedPropertyValue(TypedProperty<T>& property,
+                               typename TypedProperty<T>::Helper::pass_type value) :
+        d_property(property),
+        d_value(value)
+    {}
+
+    void apply(PropertyReceiver* receiver) const override
+    {
+        d_property.setNative(receiver, d_value);
+    }
+
+    bool isApplied(const PropertyReceiver* receiver) const override
+    {
+        return d_property.getNative(receiver) == d_value;
+    }
+
+private:
+    TypedProperty<T>& d_property;
+    typename std::decay<typename TypedProperty<T>::Helper::pass_type>::type d_value;
+};
+
 } // End of  CEGUI namespace section
 
 #endif  // end of guard _CEGUITypedProperty_h_
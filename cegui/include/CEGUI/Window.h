@@ -44,6 +44,7 @@
 #include "CEGUI/WindowRenderer.h"
 #include "CEGUI/BasicRenderedStringParser.h"
 #include "CEGUI/DefaultRenderedStringParser.h"
+#include "CEGUI/falagard/DimensionReferenceCache.h"
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
@@ -226,92 +227,92 @@ public:
     /** Event fired as part of the time based update of the window.
      * Handlers are passed a const UpdateEventArgs reference.
      */
-    static const String EventUpdated;
+    static const EventId EventUpdated;
 
     /** Event fired when the text string for the Window has changed.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose text was changed.
      */
-    static const String EventTextChanged;
+    static const EventId EventTextChanged;
     /** Event fired when the Font object for the Window has been changed.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose font was changed.
      */
-    static const String EventFontChanged;
+    static const EventId EventFontChanged;
     /** Event fired when the Alpha blend value for the Window has changed.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose alpha value was changed.
      */
-    static const String EventAlphaChanged;
+    static const EventId EventAlphaChanged;
     /** Event fired when the client assigned ID for the Window has changed.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose ID was changed.
      */
-    static const String EventIDChanged;
+    static const EventId EventIDChanged;
     /** Event fired when the Window has been activated and has input focus.
      * Handlers are passed a const ActivationEventArgs reference with
      * WindowEventArgs::window set to the Window that is gaining activation and
      * ActivationEventArgs::otherWindow set to the Window that is losing
      * activation (may be 0).
      */
-    static const String EventActivated;
+    static const EventId EventActivated;
     /** Event fired when the Window has been deactivated, losing input focus.
      * Handlers are passed a const ActivationEventArgs reference with
      * WindowEventArgs::window set to the Window that is losing activation and
      * ActivationEventArgs::otherWindow set to the Window that is gaining
      * activation (may be 0).
      */
-    static const String EventDeactivated;
+    static const EventId EventDeactivated;
     /** Event fired when the Window is shown (made visible).
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window that was shown.
      */
-    static const String EventShown;
+    static const EventId EventShown;
     /** Event fired when the Window is made hidden.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window that was hidden.
      */
-    static const String EventHidden;
+    static const EventId EventHidden;
     /** Event fired when the Window is enabled so interaction is possible.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window that was enabled.
      */
-    static const String EventEnabled;
+    static const EventId EventEnabled;
     /** Event fired when the Window is disabled and interaction is no longer
      * possible.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window that was disabled.
      */
-    static const String EventDisabled;
+    static const EventId EventDisabled;
     /** Event fired when the Window clipping mode is modified.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose clipping mode was
      * changed.
      */
-    static const String EventClippedByParentChanged;
+    static const EventId EventClippedByParentChanged;
     /** Event fired when the Window destruction mode is modified.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose destruction mode was
      * changed.
      */
-    static const String EventDestroyedByParentChanged;
+    static const EventId EventDestroyedByParentChanged;
     /** Event fired when the Window mode controlling inherited alpha is changed.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose alpha inheritence mode
      * was changed.
      */
-    static const String EventInheritsAlphaChanged;
+    static const EventId EventInheritsAlphaChanged;
     /** Event fired when the always on top setting for the Window is changed.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose always on top setting
      * was changed.
      */
-    static const String EventAlwaysOnTopChanged;
+    static const EventId EventAlwaysOnTopChanged;
     /** Event fired when the Window gains capture of cursor inputs.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window that has captured cursor inputs.
      */
-    static const String EventInputCaptureGained;
+    static const EventId EventInputCaptureGained;
     /** Event fired when the Window loses capture of cursor inputs.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to either:
@@ -320,7 +321,7 @@ public:
      * - the Window that is @gaining capture of cursor inputs if that is the
      *   cause of the previous window with capture losing that capture.
      */
-    static const String EventInputCaptureLost;
+    static const EventId EventInputCaptureLost;
     /** Event fired when the Window has been invalidated.
      * When a window is invalidated its cached rendering geometry is cleared,
      * the rendering surface that receives the window's output is invalidated
@@ -330,7 +331,7 @@ public:
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window that has been invalidated.
      */
-    static const String EventInvalidated;
+    static const EventId EventInvalidated;
     /** Event fired when rendering of the Window has started.  In this context
      * 'rendering' is the population of the GeometryBuffer with geometry for the
      * window, not the actual rendering of that GeometryBuffer content to the
@@ -338,7 +339,7 @@ public:
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose rendering has started.
      */
-    static const String EventRenderingStarted;
+    static const EventId EventRenderingStarted;
     /** Event fired when rendering of the Window has ended.  In this context
      * 'rendering' is the population of the GeometryBuffer with geometry for the
      * window, not the actual rendering of that GeometryBuffer content to the
@@ -346,12 +347,12 @@ public:
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose rendering has ended.
      */
-    static const String EventRenderingEnded;
+    static const EventId EventRenderingEnded;
     /** Event fired when destruction of the Window is about to begin.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window that is about to be destroyed.
      */
-    static const String EventDestructionStarted;
+    static const EventId EventDestructionStarted;
     /** Event fired when a DragContainer is dragged in to the window's area.
      * Handlers are passed a const DragDropEventArgs reference with
      * WindowEventArgs::window set to the window over which a DragContainer has
@@ -359,7 +360,7 @@ public:
      * set to the DragContainer that was dragged in to the receiving window's
      * area.
      */
-    static const String EventDragDropItemEnters;
+    static const EventId EventDragDropItemEnters;
     /** Event fired when a DragContainer is dragged out of the window's area.
      * Handlers are passed a const DragDropEventArgs reference with
      * WindowEventArgs::window set to the window over which a DragContainer has
@@ -367,51 +368,51 @@ public:
      * DragDropEventArgs::dragDropItem set to the DragContainer that was dragged
      * out of the receiving window's area.
      */
-    static const String EventDragDropItemLeaves;
+    static const EventId EventDragDropItemLeaves;
     /** Event fired when a DragContainer is dropped within the window's area.
      * Handlers are passed a const DragDropEventArgs reference with
      * WindowEventArgs::window set to the window over which a DragContainer was
      * dropped (the receiving window) and DragDropEventArgs::dragDropItem set to
      * the DragContainer that was dropped within the receiving window's area.
      */
-    static const String EventDragDropItemDropped;
+    static const EventId EventDragDropItemDropped;
     /** Event fired when a WindowRenderer object is attached to the window.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the window that had the WindowRenderer
      * attached to it.
      */
-    static const String EventWindowRendererAttached;
+    static const EventId EventWindowRendererAttached;
     /** Event fired when a WindowRenderer object is detached from the window.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the window that had the WindowRenderer
      * detached from it.
      */
-    static const String EventWindowRendererDetached;
+    static const EventId EventWindowRendererDetached;
     /** Event fired when the Window's setting controlling parsing of it's text
      * string is changed.
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose text parsing setting was
      * changed.
      */
-    static const String EventTextParsingChanged;
+    static const EventId EventTextParsingChanged;
     /** Event fired when the Window's margin has changed (any of the four margins)
      * Handlers are passed a const WindowEventArgs reference with
      * WindowEventArgs::window set to the Window whose margin was
      * changed.
      */
-    static const String EventMarginChanged;
+    static const EventId EventMarginChanged;
 
     // generated externally (inputs)
     /** Event fired when the cursor has entered the Window's area.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventCursorEntersArea;
+    static const EventId EventCursorEntersArea;
     /** Event fired when the cursor has left the Window's area.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventCursorLeavesArea;
+    static const EventId EventCursorLeavesArea;
     /** Event fired when the cursor enters the Window's area.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
@@ -422,7 +423,7 @@ public:
      * For an alternative version of this event see the
      * Window::EventCursorEntersArea event.
      */
-    static const String EventCursorEntersSurface;
+    static const EventId EventCursorEntersSurface;
     /** Event fired when the cursor is no longer over the Window's surface
      * area.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
@@ -433,46 +434,46 @@ public:
      * actually 'left' this Window's area).  For an alternative version of this
      * event see the Window::EventCursorLeavesArea event.
      */
-    static const String EventCursorLeavesSurface;
+    static const EventId EventCursorLeavesSurface;
     /** Event fired when the cursor moves within the area of the Window.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventCursorMove;
+    static const EventId EventCursorMove;
     /** Event fired when there is a scroll event within the Window's area.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventScroll;
+    static const EventId EventScroll;
     /** Event fired when a cursor is pressed and held down within the Window.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventCursorPressHold;
+    static const EventId EventCursorPressHold;
     /** Event fired when the cursor is activated twice within the Window.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventSelectWord;
+    static const EventId EventSelectWord;
     /** Event fired when the cursor is activated three times within the Window.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventSelectAll;
+    static const EventId EventSelectAll;
     /** Event fired when the cursor is activated within the Window.
      * Handlers are passed a const CursorInputEventArgs reference with all fields
      * valid.
      */
-    static const String EventCursorActivate;
+    static const EventId EventCursorActivate;
     /** Event fired when the Window receives a character key input event.
      * Handlers are passed a const CursorInputEventArgs reference.
      */
-    static const String EventCharacterKey;
+    static const EventId EventCharacterKey;
     /** Event fired when the Window receives a semantic input event.
      * Handler are passed a const SemanticEventArgs reference with the details
      * of what semantic event was received
      */
-    static const String EventSemanticEvent;
+    static const EventId EventSemanticEvent;
 
     /*************************************************************************
         Child Widget name suffix constants
@@ -1027,6 +1028,11 @@ public:
     \return
         - true if \a position hits this Window.
         - false if \a position does not hit this window.
+
+    \note
+        Overrides must not report hits outside of getHitTestRect, as
+        getChildAtPosition skips the windows whose hit-test bounds do not
+        contain the position.
     */
     virtual bool isHit(const glm::vec2& position,
                        const bool allow_disabled = false) const;
@@ -1305,6 +1311,21 @@ public:
     */
     const String& getLookNFeel() const;
 
+    /*!
+    \brief
+        Returns the cache of the child windows and properties that the
+        Falagard dimensions evaluated for this window reference by name.
+    */
+    DimensionReferenceCache& getDimensionReferenceCache() const
+        { return d_dimensionReferenceCache; }
+
+    /*!
+    \brief
+        Invalidates the dimension references cached by this window and its
+        ancestors, the only windows whose dimensions can reference it.
+    */
+    void invalidateDimensionReferences();
+
     /*!
     \brief
         Get whether or not this Window is the modal target.
@@ -2113,6 +2134,22 @@ public:
     */
     virtual void destroy(void);
 
+    /*!
+    \brief
+        Internal method returning the window to the state of a newly created
+        one, before WindowManager keeps it in a window pool for reuse.
+
+        Widgets owning content which is not reset through their properties,
+        such as list items or tabs, override this to release it. The base
+        version resets the auto-windows. If you override this, you MUST call
+        the base class version.
+
+    \note
+        You never have to call this method yourself, WindowManager calls it
+        when destroying a window whose type is pooled.
+    */
+    virtual void resetForReuse();
+
     /*!
     \brief
         Set the custom Tooltip object for this Window.  This value may be 0 to
@@ -2284,6 +2321,31 @@ public:
     virtual void performChildWindowLayout(bool nonclient_sized_hint = false,
                                           bool client_sized_hint = false);
 
+    /*!
+    \brief
+        Return whether this window has a screen area update or child layout
+        deferred by its GUIContext that has not been performed yet.
+
+    \see GUIContext::setDeferredLayoutEnabled
+    */
+    bool isLayoutPending() const
+        { return d_layoutPending || d_screenAreaPending; }
+
+    /*!
+    \brief
+        Perform the deferred screen area updates and child layouts of this
+        window and its descendants, parents before children.
+
+    \param screen_area_updated
+        true if an ancestor has already updated the screen area of the whole
+        hierarchy in this pass.
+
+    \note
+        This function is called by GUIContext::flushLayout, and should not be
+        called by client code.
+    */
+    void performPendingLayout(bool screen_area_updated = false);
+
     /*!
     \brief
        Sets the value a named user string, creating it as required.
@@ -3196,6 +3258,9 @@ protected:
     */
     void onChildRemoved(ElementEventArgs& e) override;
 
+    //! \copydoc NamedElement::onNameChanged
+    void onNameChanged(NamedElementEventArgs& e) override;
+
     /*!
     \brief
         Handler called when the cursor has entered this window's area.
@@ -3422,6 +3487,45 @@ protected:
     */
     virtual void drawSelf(const RenderingContext& ctx, std::uint32_t drawModeMask);
 
+    /*!
+    \brief
+        Return whether the geometry of this Window would be clipped away
+        entirely, in which case draw skips generating and queueing it. The
+        geometry is then generated once the window comes into view again.
+
+        This is only assumed when the outer rect clipper is empty and neither
+        the look'n'feel nor the last generated geometry draw unclipped.
+    */
+    bool isGeometryCulled() const;
+
+    /*!
+    \brief
+        Return whether the given child window is known to be out of view, so
+        that draw can skip it without working out its area. The default
+        implementation returns false; ScrolledContainer uses this to skip the
+        content that was scrolled out of view.
+
+        The child is only skipped when isDrawingConfinedToParent is true.
+    */
+    virtual bool isChildCulled(const Window& child) const;
+
+    /*!
+    \brief
+        Return whether this Window and all its descendants only draw within
+        the clipping area the parent gives to this window.
+    */
+    bool isDrawingConfinedToParent() const;
+
+    /*!
+    \brief
+        Return whether the assigned look'n'feel has StateImagery clipped to
+        the display, working it out again if the looks changed since.
+    */
+    bool lookHasUnclippedImagery() const;
+
+    //! Work out d_lookHasUnclippedImagery from the assigned look'n'feel.
+    void updateLookHasUnclippedImagery() const;
+
     /*!
     \brief
         Perform drawing operations concerned with generating and buffering
@@ -3670,8 +3774,35 @@ protected:
 
     // mark the rect caches defined on Window invalid (does not affect Element)
     void markCachedWindowRectsInvalid();
+
+    /*!
+    \brief
+        Return a rect containing the hit-test rects of this window and of all
+        its visible descendants, in the space positions are hit-tested against
+        this window. Subtrees whose bounds do not contain a position are
+        skipped by getChildAtPosition.
+
+        Descendants of a window backed by a RenderingWindow are tested against
+        an unprojected position, so such a window has unlimited bounds.
+    */
+    const Rectf& getHitTestBounds() const;
+    //! mark the hit-test bounds of this window and its ancestors invalid.
+    void invalidateHitTestBounds();
     void layoutLookNFeelChildWidgets();
 
+    /*!
+    \brief
+        Defer the child layout (when \a sized) or the screen area update of
+        this window to the next GUIContext::flushLayout.
+
+    \return
+        false if the GUIContext of this window does not defer layout, in
+        which case the caller must do the work immediately.
+    */
+    bool deferLayout(bool sized);
+    //! mark this window and its ancestors as having a pending descendant.
+    void markChildLayoutPending();
+
     Window* getChildAtPosition(const glm::vec2& position,
                                bool (Window::*hittestfunc)(const glm::vec2&, bool)
                                #ifndef SWIG
@@ -3772,6 +3903,16 @@ protected:
     RenderingSurface* d_surface;
     //! true if window geometry cache needs to be regenerated.
     mutable bool d_needsRedraw;
+    //! true if the last generated geometry has buffers with clipping disabled.
+    bool d_hasUnclippedGeometry;
+    //! true if the look'n'feel has StateImagery that is clipped to the display.
+    mutable bool d_lookHasUnclippedImagery;
+    //! WidgetLookManager revision d_lookHasUnclippedImagery was computed at.
+    mutable std::uint32_t d_lookUnclippedImageryRevision;
+    //! true if the geometry was left out of the last draw as it was culled.
+    bool d_geometryCulled;
+    //! true if updating the geometry position and clipping waits for a draw.
+    bool d_geometryRenderSettingsPending;
     //! holds setting for automatic creation of of surface (RenderingWindow)
     bool d_autoRenderingWindow;
     //! holds setting for stencil buffer usage in texture caching
@@ -3835,6 +3976,8 @@ protected:
     void* d_userData;
     //! Holds a collection of named user string values.
     UserStringMap d_userStrings;
+    //! Serial of the first event subscription made after WindowManager handed the window out.
+    std::uint64_t d_userSubscriptionSerial;
 
     //! true if Window will be drawn on top of all other Windows
     bool d_alwaysOnTop;
@@ -3882,9 +4025,17 @@ protected:
     //! area rect used for hit-testing against this window
     mutable Rectf d_hitTestRect;
 
+    //! bounds of the hit-test rects of this window and its visible descendants
+    mutable Rectf d_hitTestBounds;
+
     mutable bool d_outerRectClipperValid;
     mutable bool d_innerRectClipperValid;
     mutable bool d_hitTestRectValid;
+    //! whether d_hitTestBounds is valid; if not, neither are the ancestors' bounds
+    mutable bool d_hitTestBoundsValid;
+
+    //! what the names used by Falagard dimensions resolved to for this window
+    mutable DimensionReferenceCache d_dimensionReferenceCache;
 
     //! The mode to use for calling Window::update
     WindowUpdateMode d_updateMode;
@@ -3895,6 +4046,13 @@ protected:
     //! GUIContext.  Set when this window is used as a root window.
     GUIContext* d_guiContext;
 
+    //! true when the child layout of this window was deferred.
+    bool d_layoutPending = false;
+    //! true when the screen area update of this hierarchy was deferred.
+    bool d_screenAreaPending = false;
+    //! true when some descendant has a deferred layout or screen area update.
+    bool d_childLayoutPending = false;
+
     //! true when cursor is contained within this Window's area.
     bool d_containsPointer;
 
@@ -37,6 +37,7 @@
 #include "CEGUI/EventSet.h"
 #include <map>
 #include <vector>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -181,6 +182,46 @@ public:
     //! return whether Window is alive.
     bool isAlive(const Window* window) const;
 
+    /*!
+    \brief
+        Set how many destroyed windows of a type are kept for reuse.
+
+        Once pooling is enabled for a type, destroyWindow returns windows of
+        that type to a pool instead of destroying them, and createWindow hands
+        them out again. This skips the construction of the window, the
+        registration of its properties and events and the assignment of its
+        WindowRenderer and LookNFeel, which creates its child auto-windows.
+
+        A window returned to the pool first fires
+        Window::EventDestructionStarted, as when it is destroyed. All event
+        subscriptions made to it and its auto-windows since createWindow
+        returned it are then disconnected. It is detached from its parent,
+        and Window::resetForReuse releases the content the widget owns, such
+        as list items, columns or tabs, and resets its auto-windows. Its
+        remaining child windows which are not auto-windows are destroyed, its
+        user data, custom tooltip and added user strings are cleared, and its
+        properties are reset to the values a newly created window of the type
+        has. Windows whose WindowRenderer or LookNFeel were changed are
+        destroyed as usual rather than pooled.
+
+    \param type
+        The window type, as passed to createWindow.
+
+    \param capacity
+        The maximum number of pooled windows of \a type. 0 disables pooling
+        for \a type and destroys the windows in its pool.
+    */
+    void setWindowPoolCapacity(const String& type, size_t capacity);
+
+    //! Return the maximum number of pooled windows of the given type.
+    size_t getWindowPoolCapacity(const String& type) const;
+
+    //! Return the number of windows of the given type waiting in the pool.
+    size_t getPooledWindowCount(const String& type) const;
+
+    //! Destroy all pooled windows, keeping pooling enabled.
+    void clearWindowPools();
+
     /*!
     \brief
         Creates a set of windows (a GUI layout) from the information in the specified XML.
@@ -407,9 +448,54 @@ private:
 	*************************************************************************/
     typedef std::vector<Window*> WindowVector; //!< Type to use for a collection of Window pointers.
 
+    //! Position of each created window in d_windowRegistry.
+    typedef std::unordered_map<const Window*, size_t> RegistryIndex;
+
+    //! Remove a window from the registry, returning false if it was not registered.
+    bool unregisterWindow(const Window* window);
+
+    //! Pooled windows of a type and the state a newly created one has.
+    struct WindowPool
+    {
+        //! Maximum number of pooled windows.
+        size_t d_capacity = 0;
+        //! The windows waiting for reuse.
+        WindowVector d_windows;
+        //! Whether the fields below have been taken from a new window.
+        bool d_hasInitialState = false;
+        //! LookNFeel of a newly created window.
+        String d_lookName;
+        //! WidgetLookManager revision the recorded property values are valid for.
+        std::uint32_t d_lookRevision = 0;
+        //! WindowRenderer of a newly created window.
+        String d_windowRendererName;
+        //! Number of event subscriptions a new window and its auto-windows make to themselves.
+        size_t d_connectionCount = 0;
+        //! Names of the user strings of a newly created window.
+        std::vector<String> d_userStringNames;
+        //! Values of the writable properties of a newly created window.
+        std::vector<PreparedPropertyValue*> d_propertyValues;
+    };
+    typedef std::unordered_map<String, WindowPool> WindowPoolMap;
+
+    //! Record the state of a newly created window as the one to reset to.
+    static void recordInitialState(WindowPool& pool, const Window& window);
+    //! Delete the recorded state of a newly created window.
+    static void releaseInitialState(WindowPool& pool);
+    //! Reset a window and return it to its pool. Returns false if it can not be pooled.
+    bool recycleWindow(Window* window);
+    //! Destroy the windows waiting in a pool.
+    void destroyPooledWindows(WindowPool& pool);
+    //! Empty a pool and drop its recorded state if a look was replaced since.
+    void discardStalePool(WindowPool& pool);
+
     //! collection of created windows.
 	WindowVector d_windowRegistry;
+    //! Position of each window in d_windowRegistry, so lookups need no search.
+    RegistryIndex d_registryIndex;
     WindowVector d_deathrow; //!< Collection of 'destroyed' windows.
+    //! Pools of destroyed windows kept for reuse, by window type.
+    WindowPoolMap d_windowPools;
 
     std::uint32_t d_uid_counter;  //!< Counter used to generate unique window names.
     static String d_defaultResourceGroup;   //!< holds default resource group
@@ -425,6 +511,9 @@ public:
 	/*!
 	\brief
 		Return a WindowManager::WindowIterator object to iterate over the currently defined Windows.
+
+		The order of the windows is unspecified: destroying a window moves
+		the last window of the collection into its place.
 	*/
 	WindowIterator	getIterator(void) const;
 
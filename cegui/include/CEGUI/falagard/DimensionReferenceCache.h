@@ -0,0 +1,141 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Per window cache of references resolved by Falagard dimensions
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFalDimensionReferenceCache_h_
+#define _CEGUIFalDimensionReferenceCache_h_
+
+#include "../Base.h"
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Per window cache of the child windows and properties that Falagard
+    dimensions and areas reference by name.
+
+    Dimensions are evaluated each time a widget is laid out or its imagery is
+    drawn, and resolving child name paths and property names on every
+    evaluation dominates the cost of skins using many WidgetDim and PropertyDim
+    elements. Each dimension that references something by name has an id,
+    under which a window keeps what the names resolved to.
+
+    A window only caches references to itself and its descendants, so when a
+    window gains, loses or renames a child, or has its look'n'feel or window
+    renderer removed, only the caches of that window and its ancestors are
+    invalidated.
+*/
+class CEGUIEXPORT DimensionReferenceCache
+{
+public:
+    //! The native type a cached property can be read as.
+    enum class PropertyAccess : int
+    {
+        //! No property, or one that can only be read as a string.
+        String,
+        Bool,
+        Float,
+        UDim,
+        URect,
+        Image
+    };
+
+    //! What the names of a dimension resolved to.
+    struct Reference
+    {
+        //! The window the dimension reads from, its owner or one of its children.
+        const Window* d_window;
+        //! The property the dimension reads, nullptr if it reads none.
+        const Property* d_property;
+        //! How d_property can be read natively.
+        PropertyAccess d_access;
+    };
+
+    DimensionReferenceCache();
+
+    /*!
+    \brief
+        Returns the references cached for the dimension with the given id, or
+        nullptr if they were not resolved since the last invalidation.
+    */
+    const Reference* find(unsigned int id);
+
+    //! Caches the references of the dimension with the given id.
+    Reference store(unsigned int id, const Window* window,
+                    const Property* property = nullptr,
+                    PropertyAccess access = PropertyAccess::String);
+
+    //! Invalidates the references cached, they are dropped on the next use.
+    void invalidate() { ++d_generation; }
+
+    //! Returns a new id for a dimension that references things by name.
+    static unsigned int allocateId();
+
+    /*!
+    \brief
+        Remembers how the last property a dimension resolved to can be read,
+        so that its type is only inspected again when a different property
+        is resolved.
+    */
+    class CEGUIEXPORT AccessCache
+    {
+    public:
+        //! Returns how the given property can be read natively.
+        PropertyAccess get(const Property* property);
+
+    private:
+        const Property* d_property = nullptr;
+        PropertyAccess d_access = PropertyAccess::String;
+    };
+
+private:
+    typedef std::unordered_map<unsigned int, Reference> ReferenceMap;
+    ReferenceMap d_references;
+    //! Incremented each time the cached references are invalidated.
+    unsigned int d_generation;
+    //! Value of d_generation when d_references was last cleared.
+    unsigned int d_referencesGeneration;
+
+    //! Drops the cached references if they were invalidated since.
+    void dropInvalidated();
+
+    static unsigned int s_lastId;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIFalDimensionReferenceCache_h_
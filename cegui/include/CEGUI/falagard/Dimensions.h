@@ -28,6 +28,7 @@
 #define _CEGUIFalDimensions_h_
 
 #include "./Enums.h"
+#include "./DimensionReferenceCache.h"
 #include "../String.h"
 #include "../UDim.h"
 #include "../Rectf.h"
@@ -367,6 +368,10 @@ protected:
 
     //! name of the property from which to fetch the image name.
     String d_propertyName;
+    //! id under which windows cache what the names used here resolve to.
+    unsigned int d_referenceId = DimensionReferenceCache::allocateId();
+    //! how the property resolved to last can be read.
+    mutable DimensionReferenceCache::AccessCache d_propertyAccess;
 };
 
 /*!
@@ -452,6 +457,8 @@ private:
     String d_widgetName;
     //! the dimension of the target window that we are to represent.
     DimensionType d_dimensionType;
+    //! id under which windows cache what the names used here resolve to.
+    unsigned int d_referenceId = DimensionReferenceCache::allocateId();
 };
 
 /*!
@@ -621,6 +628,8 @@ private:
     FontMetricType d_metric;
     //! padding value to be added.
     float d_padding;
+    //! id under which windows cache what the names used here resolve to.
+    unsigned int d_referenceId = DimensionReferenceCache::allocateId();
 };
 
 /*!
@@ -745,6 +754,10 @@ private:
     String d_childName;
     //! String to hold the type of dimension
     DimensionType d_type;
+    //! id under which windows cache what the names used here resolve to.
+    unsigned int d_referenceId = DimensionReferenceCache::allocateId();
+    //! how the property resolved to last can be read.
+    mutable DimensionReferenceCache::AccessCache d_propertyAccess;
 };
 
 /*!
@@ -1007,10 +1020,17 @@ public:
     Dimension d_bottom_or_height;
 
 private:
+    //! returns the value of the URect property the area is fetched from.
+    URect getPropertySourceArea(const Window& wnd) const;
+
     //! name of property or named area: must access a URect style value.
     String d_namedSource;
     //! name of widget look holding the named area to fetch
     String d_namedAreaSourceLook;
+    //! id under which windows cache what the names used here resolve to.
+    unsigned int d_referenceId = DimensionReferenceCache::allocateId();
+    //! how the property resolved to last can be read.
+    mutable DimensionReferenceCache::AccessCache d_propertyAccess;
 };
 
 } // End of  CEGUI namespace section
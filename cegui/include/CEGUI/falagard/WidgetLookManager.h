@@ -293,6 +293,15 @@ namespace CEGUI
         */
         WidgetLookPointerMap getWidgetLookPointerMap();
 
+        /*!
+        \brief
+            Returns a number that changes whenever a WidgetLookFeel is replaced
+            or erased, which destroys its property definitions. Anything that
+            keeps pointers to those properties has to drop them once the
+            revision changes.
+        */
+        std::uint32_t getRevision() const { return d_revision; }
+
     private:
         //! Name of schema file used for XML validation.
         static const String FalagardSchemaName; 
@@ -305,6 +314,8 @@ namespace CEGUI
 
         //! List of WidgetLookFeels added to this Manager
         WidgetLookList  d_widgetLooks;  
+        //! Counter of the WidgetLookFeels replaced or erased.
+        std::uint32_t d_revision;
     };
 
 } // End of  CEGUI namespace section
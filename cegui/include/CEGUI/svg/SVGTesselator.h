@@ -573,6 +573,17 @@ private:
     //! Helper function to get the min and max x and y coordinates of a list of points
     static void calculateMinMax(const std::vector<glm::vec2>& points, glm::vec2& min, glm::vec2& max);
 
+    /*!
+    \brief
+        Helper function that writes one vertex per point directly into the
+        storage of the GeometryBuffer. Apart from the x and y coordinates, the
+        vertices are copies of the passed vertex.
+    */
+    static void appendVertices(GeometryBuffer& geometry_buffer,
+                               const ColouredVertex& vertex,
+                               const glm::vec2* const* points,
+                               std::size_t point_count);
+
     //! Helper function to append a fill-quad based on its 4 corner points to the Geometrybuffer
     static void addFillQuad(const glm::vec2& point1,
                             const glm::vec2& point2,
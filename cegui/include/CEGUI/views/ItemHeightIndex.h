@@ -0,0 +1,116 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Prefix-sum index over the heights of the items of a view.
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIItemHeightIndex_h_
+#define _CEGUIItemHeightIndex_h_
+
+#include "CEGUI/Base.h"
+#include <vector>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+
+/*!
+\brief
+    Keeps the heights of a sequence of items laid out one below the other and
+    answers, in logarithmic time, which item is found at a given vertical
+    offset and at which offset a given item starts.
+
+    This is implemented as a Fenwick (binary indexed) tree. Changing the height
+    of an item is a logarithmic operation. Inserting or removing items only
+    moves the heights and marks the nodes past the change as stale; those are
+    brought up to date by the next query, so a batch of changes costs a single
+    pass over the items following the first of them.
+*/
+class CEGUIEXPORT ItemHeightIndex
+{
+public:
+    ItemHeightIndex() : d_validNodes(0) {}
+
+    //! Removes all the items from the index.
+    void clear();
+
+    //! Returns the number of items in the index.
+    size_t size() const { return d_heights.size(); }
+
+    //! Appends an item with the given \a height at the end.
+    void append(float height);
+
+    //! Inserts \a count items, with the heights pointed by \a heights, at \a position.
+    void insert(size_t position, const float* heights, size_t count);
+
+    //! Removes \a count items starting at \a position.
+    void erase(size_t position, size_t count);
+
+    //! Changes the height of the item found at \a position.
+    void setHeight(size_t position, float height);
+
+    //! Returns the height of the item found at \a position.
+    float getHeight(size_t position) const { return d_heights[position]; }
+
+    /*!
+    \brief
+        Returns the offset at which the item at \a position starts, that is
+        the sum of the heights of all the items before it. Passing size() as
+        \a position returns the total height.
+    */
+    float getOffset(size_t position) const;
+
+    //! Returns the sum of the heights of all the items.
+    float getTotalHeight() const { return getOffset(d_heights.size()); }
+
+    /*!
+    \brief
+        Returns the position of the item which spans the given vertical
+        \a offset, or size() if the offset is past the last item.
+    */
+    size_t getPositionAtOffset(float offset) const;
+
+private:
+    //! Brings the stale nodes of d_tree up to date with d_heights.
+    void update() const;
+
+    //! The heights of the items, in order.
+    std::vector<float> d_heights;
+    //! The Fenwick tree, 1-based: d_tree[i] holds the sum of a range ending with item i - 1.
+    mutable std::vector<float> d_tree;
+    //! The number of leading nodes of d_tree which are up to date.
+    mutable size_t d_validNodes;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
@@ -387,6 +387,7 @@ protected:
         ScrollbarDisplayMode new_mode, String change_event);
 
     void initialiseComponents(void) override;
+    void resetForReuse() override;
 
     virtual bool onChildrenWillBeAdded(const EventArgs& args);
     virtual bool onChildrenAdded(const EventArgs& args);
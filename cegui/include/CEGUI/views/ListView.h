@@ -30,6 +30,7 @@
 #define _CEGUIListView_h_
 
 #include "CEGUI/views/ItemView.h"
+#include "CEGUI/views/ItemHeightIndex.h"
 #include <vector>
 
 #if defined (_MSC_VER)
@@ -52,6 +53,11 @@ namespace CEGUI
 */
 struct CEGUIEXPORT ListViewItemRenderingState
 {
+    /*!
+        The parsed and formatted item text. When virtualization is enabled on
+        the attached ListView, these are only created for items that have been
+        scrolled into view and can be nullptr otherwise.
+    */
     RenderedString* d_string;
     FormattedRenderedString* d_formattedString;
     //! The name of the image that represents the icon
@@ -61,6 +67,8 @@ struct CEGUIEXPORT ListViewItemRenderingState
     ModelIndex d_index;
     String d_text;
     ListView* d_attachedListView;
+    //! The last visible items pass in which this item was visible.
+    std::uint32_t d_lastVisiblePass;
 
     ListViewItemRenderingState(ListView* list_view);
     ~ListViewItemRenderingState();
@@ -72,6 +80,8 @@ struct CEGUIEXPORT ListViewItemRenderingState
     ListViewItemRenderingState& operator=(const ListViewItemRenderingState&) = delete;
 
     void setStringAndFormatting(const RenderedString& string, HorizontalTextFormatting h_fmt);
+    //! Releases the rendered and formatted strings of this item.
+    void clearStringAndFormatting();
 
     bool operator< (const ListViewItemRenderingState& other) const;
     bool operator> (const ListViewItemRenderingState& other) const;
@@ -104,6 +114,21 @@ public:
 
     ModelIndex indexAt(const glm::vec2& position) override;
 
+    /*!
+    \brief
+        Returns the position, within getItems(), of the item found at the
+        specified vertical \a offset from the top of the view's content, or
+        the number of items if there is no item at that offset.
+    */
+    size_t getItemPositionAtOffset(float offset) const;
+
+    /*!
+    \brief
+        Returns the vertical offset, from the top of the view's content, at
+        which the item found at \a position within getItems() starts.
+    */
+    float getItemOffset(size_t position) const;
+
     /*!
     \brief
         Return the current horizontal formatting option set for this widget.
@@ -116,25 +141,138 @@ public:
     */
     void    setHorizontalFormatting(HorizontalTextFormatting h_fmt);
 
+    /*!
+    \brief
+        Specifies whether the items of this view are virtualized or not.
+
+        When virtualization is enabled, the text of the items is only parsed,
+        formatted and measured once the items are scrolled into view. Until
+        then, each item is assumed to have the height returned by
+        getEstimatedItemHeight. Only a limited number of formatted items (see
+        setFormattedItemCacheSize) is kept for items that are not visible.
+    */
+    void setVirtualizationEnabled(bool enabled);
+    bool isVirtualizationEnabled() const;
+
+    /*!
+    \brief
+        Sets the height assumed for items that were not measured yet when
+        virtualization is enabled. A value of 0 means that the line spacing of
+        the view's font is used.
+    */
+    void setEstimatedItemHeight(float height);
+    float getEstimatedItemHeight() const;
+
+    /*!
+    \brief
+        Sets the maximum number of items that keep their formatted text when
+        virtualization is enabled. The items that were visible least recently
+        are released first; visible items are never released.
+    */
+    void setFormattedItemCacheSize(size_t size);
+    size_t getFormattedItemCacheSize() const;
+
 protected:
     bool onChildrenAdded(const EventArgs& args) override;
+    bool onChildrenWillBeRemoved(const EventArgs& args) override;
     bool onChildrenRemoved(const EventArgs& args) override;
+    bool onChildrenDataWillChange(const EventArgs& args) override;
+    bool onChildrenDataChanged(const EventArgs& args) override;
 
     //! Horizontal formatting to be applied to the text.
     HorizontalTextFormatting d_horzFormatting;
+    //! Whether the items are only formatted once they become visible.
+    bool d_isVirtualizationEnabled;
+    //! Height assumed for the items that were not measured yet.
+    float d_estimatedItemHeight;
+    //! Maximum number of formatted items kept when virtualized.
+    size_t d_formattedItemCacheSize;
 
 private:
-    std::vector<ListViewItemRenderingState> d_items;
+    //! Rendering states of the items, in model order; owned by the view.
+    std::vector<ListViewItemRenderingState*> d_items;
+    //! The items of d_items in the order they are displayed.
     std::vector<ListViewItemRenderingState*> d_sortedItems;
+    //! Heights of the items in d_sortedItems, used for offset lookups.
+    ItemHeightIndex d_itemHeights;
+    //! Number of items that currently have formatted strings (virtualized only)
+    size_t d_formattedItemCount;
+    //! Counter of the passes made by formatVisibleItems.
+    std::uint32_t d_visiblePass;
+    //! Positions in d_sortedItems of the items about to be removed or changed.
+    std::vector<size_t> d_pendingSortedPositions;
 
     void resortListView();
     void resortView() override;
 
+    //! Deletes all the rendering states and empties the item containers.
+    void clearItems();
+
+    /*!
+    \brief
+        Inserts the specified \a items into d_sortedItems, keeping it sorted,
+        and updates the height index accordingly.
+
+    \param position
+        The position at which the items are inserted when the view is not
+        sorted; it is ignored otherwise.
+    */
+    void insertSortedItems(std::vector<ListViewItemRenderingState*>& items,
+        size_t position);
+
+    /*!
+    \brief
+        Removes the specified \a items, the children of the model starting at
+        \a first_child, from d_sortedItems and the height index.
+
+        When sorting, the items are removed from the positions found by
+        findPendingSortedPositions, as their data can no longer be compared.
+    */
+    void removeSortedItems(const std::vector<ListViewItemRenderingState*>& items,
+        size_t first_child);
+
+    /*!
+    \brief
+        Finds the positions in d_sortedItems of the children about to be
+        removed or changed, while their data can still be compared.
+    */
+    void findPendingSortedPositions(const ModelEventArgs& args);
+
+    /*!
+    \brief
+        Rebuilds the height index from the items in d_sortedItems, starting
+        with the one at \a first_position; the entries before it are kept.
+    */
+    void rebuildItemHeights(size_t first_position = 0);
+
+    //! Returns the position of the specified \a item within d_sortedItems.
+    size_t getSortedPosition(const ListViewItemRenderingState* item) const;
+
     //! Updates the rendering state for the specified \a item using the specified
     //! \a index as the data source.
     void updateItem(ListViewItemRenderingState& item, ModelIndex index,
         float& max_width, float& total_height);
 
+    /*!
+    \brief
+        Refreshes the model indices of the items from \a first_child onwards,
+        as a model may hand out different indices for its children once some
+        are added or removed before them.
+    */
+    void updateItemIndices(size_t first_child);
+
+    //! Parses, formats and measures the text of the specified \a item.
+    void formatItem(ListViewItemRenderingState& item);
+
+    //! Formats the items intersecting the currently visible area.
+    void formatVisibleItems();
+
+    //! Releases formatted strings of non visible items over the cache size.
+    void trimFormattedItems();
+
+    //! Returns the height to be used for an item that was not measured yet.
+    float getItemHeightEstimate() const;
+
     Rectf getIndexRect(const ModelIndex& index) override;
 };
 
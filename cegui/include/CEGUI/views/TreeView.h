@@ -103,6 +103,13 @@ public:
     bool d_subtreeIsExpanded;
     int d_nestedLevel;
 
+    //! Height of this item together with all the rendered items in its subtree.
+    float d_subtreeHeight;
+    //! Offset of each of the d_renderedChildren, relative to the bottom of this item.
+    std::vector<float> d_renderedChildrenOffsets;
+    //! Whether d_subtreeHeight and d_renderedChildrenOffsets are up to date.
+    bool d_subtreeHeightIsValid;
+
     TreeView* d_attachedTreeView;
 
     TreeViewItemRenderingState(TreeView* attached_tree_view);
@@ -204,8 +211,17 @@ private:
     void fillRenderingState(TreeViewItemRenderingState& state, const ModelIndex& index, float& rendered_max_width, float& rendered_total_height);
 
     ModelIndex indexAtWithAction(const glm::vec2& position, TreeViewItemAction action);
-    ModelIndex indexAtRecursive(TreeViewItemRenderingState& item, float& cur_height,
-        const glm::vec2& window_position, bool& handled, TreeViewItemAction action);
+
+    //! Fills \a ids_path with the child ids leading from the root to \a index,
+    //! starting with the id of \a index itself.
+    void getChildIdsPath(const ModelIndex& index, std::vector<int>& ids_path) const;
+
+    //! Marks the subtree heights of the item of \a index and all its ancestors
+    //! as needing to be recomputed.
+    void invalidateSubtreeHeights(const ModelIndex& index);
+
+    //! Recomputes the subtree heights of \a item and its descendants, if needed.
+    void updateSubtreeHeights(TreeViewItemRenderingState& item);
 
     void clearItemRenderedChildren(TreeViewItemRenderingState& item, float& renderedTotalHeight);
     void handleSelectionAction(TreeViewItemRenderingState& item, bool toggles_expander);
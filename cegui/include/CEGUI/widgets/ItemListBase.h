@@ -235,6 +235,7 @@ public:
         Nothing
     */
     void initialiseComponents(void) override;
+    void resetForReuse() override;
 
 
 	/*!
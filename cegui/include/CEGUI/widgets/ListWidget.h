@@ -110,6 +110,7 @@ public:
 
 protected:
     void initialiseComponents() override;
+    void resetForReuse() override;
 
     StandardItemModel d_itemModel;
 };
@@ -785,6 +785,7 @@ public:
 		Nothing
 	*/
     void initialiseComponents() override;
+    void resetForReuse() override;
 
 
 	/*!
@@ -237,7 +237,18 @@ public:
     Rectf getTextRenderArea() const;
 
     // get d_lines
-    const LineList& getFormattedLines() const   {return d_lines;}
+    const LineList& getFormattedLines() const;
+
+    /*!
+    \brief
+        Return the formatted line at \a line_number. Unlike getFormattedLines,
+        this does not bring the start index of all the lines up to date after
+        an edit, so it is the cheaper way to access only some of the lines.
+    */
+    LineInfo getFormattedLine(size_t line_number) const;
+
+    //! Return the number of formatted lines.
+    size_t getFormattedLineCount() const    {return d_lines.size();}
 
     /*!
     \brief
@@ -324,6 +335,21 @@ public:
     */
     void formatText(const bool update_scrollbars);
 
+    /*!
+    \brief
+        Format the text into lines, only re-wrapping the paragraphs touched
+        by the edit announced through setEditedText.
+
+        The whole text is formatted as by formatText when the text was changed
+        in some other way, or when the formatting options or the width of the
+        text area changed since it was last formatted.
+
+    \param update_scrollbars
+        - true if scrollbar configuration should be performed.
+        - false if scrollbar configuration should not be performed.
+    */
+    void formatChangedText(const bool update_scrollbars);
+
 
 protected:
     // Overriding methods inherited from EditboxBase
@@ -432,6 +458,52 @@ protected:
 	*/
 	size_t getNextTokenLength(const String& text, size_t start_idx) const;
 
+    /*!
+    \brief
+        Append the lines of the paragraphs in the given range of the text
+        to \a lines.
+
+    \param start_idx
+        Index of the first character of the first paragraph.
+
+    \param end_idx
+        Index one past the last character of the last paragraph.
+
+    \param area_width
+        Width available to the lines, or 0 if lines must not be wrapped.
+    */
+    void formatParagraphs(const Font& font, size_t start_idx, size_t end_idx,
+                          float area_width, LineList& lines) const;
+
+    //! Return the index, relative to the start of the line, of the character at a pixel offset in a line.
+    size_t getCharAtPixelInLine(size_t line_number, float pixel) const;
+
+    //! Return the index of the first character of a line, including any pending shift.
+    size_t getLineStartIndex(size_t line_number) const;
+
+    //! Return the number of lines starting before the character at \a index.
+    size_t getLineCountBefore(size_t index) const;
+
+    //! Add the pending shift to the start index of the lines it applies to.
+    void applyLineShift() const;
+
+    /*!
+    \brief
+        Set the text to \a text, which differs from the current one by
+        replacing \a erased_length characters at \a start_idx with
+        \a inserted_length new ones, so that only the paragraphs touched by
+        the change get formatted again.
+    */
+    void setEditedText(const String& text, size_t start_idx,
+                       size_t erased_length, size_t inserted_length);
+
+    //! Record an edit of the text, merging it with one not formatted yet.
+    void noteTextEdit(size_t start_idx, size_t erased_length,
+                      size_t inserted_length);
+
+    //! Update d_widestExtent from the extents of d_lines.
+    void updateWidestExtent();
+
 
     /*!
 	\brief
@@ -469,9 +541,25 @@ protected:
 	*************************************************************************/
 	static String   d_lineBreakChars;	//!< Holds what we consider to be line break characters.
     bool            d_wordWrap;		//!< true when formatting uses word-wrapping.
-	LineList        d_lines;			//!< Holds the lines for the current formatting.
+	mutable LineList d_lines;			//!< Holds the lines for the current formatting.
 	float           d_lastRenderWidth;  //!< Holds last render area width
 	float           d_widestExtent;	//!< Holds the extent of the widest line as calculated in the last formatting pass.
+    //! Font used when d_lines was built, or 0 if d_lines is not up to date.
+    const Font*     d_formattedFont;
+    //! Length of the text when d_lines was last brought up to date.
+    size_t          d_formattedLength;
+    //! First line of those whose d_startIdx still lacks d_lineShift.
+    mutable size_t  d_shiftedLine;
+    //! Change of length of the text not yet added to the lines after the edits.
+    mutable size_t  d_lineShift;
+    //! true when d_editStart, d_editEnd and d_editLengthChange describe the text change to format.
+    bool            d_hasTextEdit;
+    //! Index of the first changed character in the edited text.
+    size_t          d_editStart;
+    //! Index one past the last changed character in the edited text.
+    size_t          d_editEnd;
+    //! Length of the edited text minus the formatted one, modulo the size_t range.
+    size_t          d_editLengthChange;
 
 	// component widget settings
 	bool d_forceVertScroll;		//!< true if vertical scrollbar should always be displayed
@@ -474,6 +474,7 @@ public:
 
     // overrides
     void initialiseComponents(void) override;
+    void resetForReuse() override;
 
 protected:
     /*!
@@ -30,6 +30,7 @@
 #include "../Window.h"
 #include "../WindowFactory.h"
 #include <map>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -76,6 +77,10 @@ public:
         Rect object that describes the pixel extents of the attached
         child windows.  This is effectively the smallest bounding box
         that could contain all the attached windows.
+
+    \note
+        The extents are cached, and updated incrementally as child windows
+        are added, removed, moved or sized.
     */
     Rectf getChildExtentsArea(void) const;
 
@@ -92,13 +97,33 @@ protected:
     
     Rectf getClientChildContentArea_impl(bool skipAllPixelAlignment) const;
 
+    //! Cached areas of a child window.
+    struct ChildAreas
+    {
+        //! Area the child adds to the extents, see getChildExtentsArea.
+        Rectf d_extentsArea;
+        //! Screen area of the child, relative to the position of the container.
+        Rectf d_drawArea;
+        bool d_extentsAreaValid;
+        bool d_drawAreaValid;
+    };
+
+    //! Return the size child positions are relative to in getChildExtentsArea.
+    Sizef getChildExtentsBaseSize() const;
+    //! Return the area a child adds to the extents for the given base size.
+    static Rectf calculateChildExtentsArea(const Window& child, const Sizef& baseSize);
+    //! Return the cached areas of a child, creating them if needed.
+    ChildAreas& getChildAreas(const Window& child) const;
+    //! Update the cached extents after the area a child adds to them changed.
+    void updateChildExtents(const Rectf& oldArea, const Rectf& newArea) const;
+
     //! handles notifications about child windows being moved or sized.
     bool handleChildAreaChanged(const EventArgs& e);
     void subscribeOnChildAreaEvents(Window* child);
-    void onIsSizeAdjustedToContentChanged(ElementEventArgs& e) override;
 
     // overridden from Window.
     void drawSelf(const RenderingContext&, std::uint32_t) override {}
+    bool isChildCulled(const Window& child) const override;
     Rectf getInnerRectClipper_impl() const override;
     Rectf getHitTestRect_impl() const override;
     void onChildAdded(ElementEventArgs& e) override;
@@ -119,6 +144,17 @@ protected:
     glm::vec2 d_contentOffset;
 
     CachedRectf d_clientChildContentArea;
+
+    typedef std::unordered_map<const Window*, ChildAreas> ChildAreasMap;
+    //! Cached areas of the child windows.
+    mutable ChildAreasMap d_childAreas;
+    //! Cached result of getChildExtentsArea.
+    mutable Rectf d_childExtents;
+    //! Base size the cached extents areas of the children were calculated for.
+    mutable Sizef d_childExtentsBaseSize;
+    mutable bool d_childExtentsValid;
+    //! Size of the child content area the cached draw areas were taken at.
+    mutable Sizef d_childDrawAreasBaseSize;
 };
 
 } // End of  CEGUI namespace section
@@ -281,6 +281,7 @@ public:
 		Nothing
 	*/
     void	initialiseComponents(void) override;
+    void    resetForReuse() override;
 
     /*!
     \brief
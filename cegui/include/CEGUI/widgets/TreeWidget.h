@@ -56,6 +56,7 @@ public:
     void addItem(StandardItem* item);
 protected:
     void initialiseComponents() override;
+    void resetForReuse() override;
     StandardItemModel d_itemModel;
 };
 
@@ -36,17 +36,25 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Animation_xmlHandler.h"
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+// Revisions are unique across all affectors, so that a cached property of a
+// destroyed affector never matches a new one allocated at the same address.
+static unsigned int s_lastAffectorRevision = 0;
 
 //----------------------------------------------------------------------------//
 Affector::Affector(Animation* parent):
     d_parent(parent),
     d_applicationMethod(ApplicationMethod::ApplyAbsolute),
     d_targetProperty(""),
-    d_interpolator(nullptr)
+    d_interpolator(nullptr),
+    d_typedKeyFrames(nullptr),
+    d_typedKeyFramesValid(false),
+    d_revision(++s_lastAffectorRevision)
 {}
 
 //----------------------------------------------------------------------------//
@@ -56,6 +64,8 @@ Affector::~Affector(void)
     {
         destroyKeyFrame(getKeyFrameAtIndex(0));
     }
+
+    delete d_typedKeyFrames;
 }
 
 //----------------------------------------------------------------------------//
@@ -83,6 +93,7 @@ size_t Affector::getIndexInParent() const
 void Affector::setApplicationMethod(ApplicationMethod method)
 {
     d_applicationMethod = method;
+    invalidateTypedKeyFrames(true);
 }
 
 //----------------------------------------------------------------------------//
@@ -96,6 +107,7 @@ Affector::ApplicationMethod Affector::getApplicationMethod() const
 void Affector::setTargetProperty(const String& target)
 {
     d_targetProperty = target;
+    invalidateTypedKeyFrames(true);
 }
 
 //----------------------------------------------------------------------------//
@@ -108,12 +120,14 @@ const String& Affector::getTargetProperty() const
 void Affector::setInterpolator(Interpolator* interpolator)
 {
     d_interpolator = interpolator;
+    invalidateTypedKeyFrames(true);
 }
 
 //----------------------------------------------------------------------------//
 void Affector::setInterpolator(const String& name)
 {
     d_interpolator = AnimationManager::getSingleton().getInterpolator(name);
+    invalidateTypedKeyFrames(true);
 }
 
 //----------------------------------------------------------------------------//
@@ -134,6 +148,7 @@ KeyFrame* Affector::createKeyFrame(float position)
 
     KeyFrame* ret = new KeyFrame(this, position);
     d_keyFrames.insert(std::make_pair(position, ret));
+    updateSortedKeyFrames();
 
     return ret;
 }
@@ -164,6 +179,7 @@ void Affector::destroyKeyFrame(KeyFrame* keyframe)
 
     d_keyFrames.erase(it);
     delete keyframe;
+    updateSortedKeyFrames();
 }
 
 //----------------------------------------------------------------------------//
@@ -227,6 +243,7 @@ void Affector::moveKeyFrameToPosition(KeyFrame* keyframe, float newPosition)
             d_keyFrames.insert(std::make_pair(newPosition, keyframe));
 
             keyframe->notifyPositionChanged(newPosition);
+            updateSortedKeyFrames();
             return;
         }
     }
@@ -291,50 +308,47 @@ void Affector::apply(AnimationInstance* instance)
         return;
     }
 
-    KeyFrame* left = nullptr;
-    KeyFrame* right = nullptr;
-
-    // find 2 neighbouring keyframes
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
-         it != d_keyFrames.end(); ++it)
-    {
-        KeyFrame* current = it->second;
-
-        if (current->getPosition() <= position)
-        {
-            left = current;
-        }
-
-        if (current->getPosition() >= position && !right)
-        {
-            right = current;
-        }
-    }
-
+    // find 2 neighbouring keyframes, the last one at or before the position
+    // and the first one at or after it
+    const KeyFrameList::const_iterator firstAfter = std::upper_bound(
+        d_sortedKeyFrames.cbegin(), d_sortedKeyFrames.cend(), position,
+        [](float pos, const KeyFrame* keyFrame)
+        { return pos < keyFrame->getPosition(); });
+    const KeyFrameList::const_iterator firstAtOrAfter = std::lower_bound(
+        d_sortedKeyFrames.cbegin(), firstAfter, position,
+        [](const KeyFrame* keyFrame, float pos)
+        { return keyFrame->getPosition() < pos; });
+
+    size_t leftIndex, rightIndex;
     float leftDistance, rightDistance;
 
-    if (left)
+    if (firstAfter != d_sortedKeyFrames.cbegin())
     {
-        leftDistance = position - left->getPosition();
+        leftIndex = (firstAfter - d_sortedKeyFrames.cbegin()) - 1;
+        leftDistance = position - d_sortedKeyFrames[leftIndex]->getPosition();
     }
     else
         // if no keyframe is suitable for left neighbour, pick the first one
     {
-        left = d_keyFrames.begin()->second;
+        leftIndex = 0;
         leftDistance = 0;
     }
 
-    if (right)
+    if (firstAtOrAfter != d_sortedKeyFrames.cend())
     {
-        rightDistance = right->getPosition() - position;
+        rightIndex = firstAtOrAfter - d_sortedKeyFrames.cbegin();
+        rightDistance = d_sortedKeyFrames[rightIndex]->getPosition() - position;
     }
     else
         // if no keyframe is suitable for the right neighbour, pick the last one
     {
-        right = d_keyFrames.rbegin()->second;
+        rightIndex = d_sortedKeyFrames.size() - 1;
         rightDistance = 0;
     }
 
+    KeyFrame* left = d_sortedKeyFrames[leftIndex];
+    KeyFrame* right = d_sortedKeyFrames[rightIndex];
+
     // if there is just one keyframe and we are right on it
     if (leftDistance + rightDistance == 0)
     {
@@ -347,6 +361,19 @@ void Affector::apply(AnimationInstance* instance)
         right->alterInterpolationPosition(
             leftDistance / (leftDistance + rightDistance));
 
+    // set the native value directly when the interpolator and the target
+    // property agree on the type
+    if (Property* property = getNativeTargetProperty(instance))
+    {
+        const String* base =
+            d_applicationMethod == ApplicationMethod::ApplyRelative ?
+            &instance->getSavedPropertyValue(d_targetProperty) : nullptr;
+
+        d_typedKeyFrames->apply(*instance, *property, leftIndex, rightIndex,
+                                interpolationPosition, base);
+        return;
+    }
+
     // absolute application method
     if (d_applicationMethod == ApplicationMethod::ApplyAbsolute)
     {
@@ -390,6 +417,81 @@ void Affector::apply(AnimationInstance* instance)
     }
 }
 
+//----------------------------------------------------------------------------//
+void Affector::notifyKeyFrameValueChanged()
+{
+    invalidateTypedKeyFrames(false);
+}
+
+//----------------------------------------------------------------------------//
+void Affector::updateSortedKeyFrames()
+{
+    d_sortedKeyFrames.clear();
+    d_sortedKeyFrames.reserve(d_keyFrames.size());
+
+    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
+         it != d_keyFrames.end(); ++it)
+    {
+        d_sortedKeyFrames.push_back(it->second);
+    }
+
+    invalidateTypedKeyFrames(false);
+}
+
+//----------------------------------------------------------------------------//
+TypedKeyFrames* Affector::getTypedKeyFrames()
+{
+    if (!d_typedKeyFramesValid)
+    {
+        delete d_typedKeyFrames;
+        d_typedKeyFrames = nullptr;
+
+        // key frames hold float multipliers in relative multiply mode
+        if (d_interpolator &&
+            d_applicationMethod != ApplicationMethod::ApplyRelativeMultiply)
+        {
+            d_typedKeyFrames = d_interpolator->createTypedKeyFrames(*this);
+        }
+
+        d_typedKeyFramesValid = true;
+    }
+
+    return d_typedKeyFrames;
+}
+
+//----------------------------------------------------------------------------//
+Property* Affector::getNativeTargetProperty(AnimationInstance* instance)
+{
+    TypedKeyFrames* typedKeyFrames = getTypedKeyFrames();
+    if (!typedKeyFrames)
+        return nullptr;
+
+    Property* property;
+    if (instance->getCachedAffectorProperty(this, d_revision, property))
+        return property;
+
+    // a missing property is left for the string path to report
+    PropertySet* target = instance->getTarget();
+    property = target->isPropertyPresent(d_targetProperty) ?
+        target->getPropertyInstance(d_targetProperty) : nullptr;
+
+    if (property && !typedKeyFrames->isApplicableTo(*property))
+        property = nullptr;
+
+    instance->cacheAffectorProperty(this, d_revision, property);
+    return property;
+}
+
+//----------------------------------------------------------------------------//
+void Affector::invalidateTypedKeyFrames(bool revise)
+{
+    d_typedKeyFramesValid = false;
+
+    if (revise)
+        d_revision = ++s_lastAffectorRevision;
+}
+
+//----------------------------------------------------------------------------//
 void Affector::writeXMLToStream(XMLSerializer& xml_stream) const
 {
     xml_stream.openTag(AnimationAffectorHandler::ElementName);
@@ -31,6 +31,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -88,6 +89,7 @@ void AnimationInstance::setTarget(PropertySet* target)
     d_target = target;
 
     purgeSavedPropertyValues();
+    d_affectorProperties.clear();
 
     if (d_definition->getAutoStart() && !isRunning())
     {
@@ -551,10 +553,57 @@ void AnimationInstance::apply()
     }
 }
 
+//----------------------------------------------------------------------------//
+bool AnimationInstance::getCachedAffectorProperty(const Affector* affector,
+                                                  unsigned int revision,
+                                                  Property*& property) const
+{
+    for (AffectorPropertyList::const_iterator it = d_affectorProperties.begin();
+         it != d_affectorProperties.end(); ++it)
+    {
+        if (it->d_affector == affector)
+        {
+            // the property may have been removed from the target since
+            if (it->d_revision != revision ||
+                it->d_targetRevision != d_target->getPropertyRevision() ||
+                it->d_lookRevision != WidgetLookManager::getSingleton().getRevision())
+                return false;
+
+            property = it->d_property;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void AnimationInstance::cacheAffectorProperty(const Affector* affector,
+                                              unsigned int revision,
+                                              Property* property)
+{
+    const AffectorProperty entry = { affector, revision,
+        d_target->getPropertyRevision(),
+        WidgetLookManager::getSingleton().getRevision(), property };
+
+    for (AffectorPropertyList::iterator it = d_affectorProperties.begin();
+         it != d_affectorProperties.end(); ++it)
+    {
+        if (it->d_affector == affector)
+        {
+            *it = entry;
+            return;
+        }
+    }
+
+    d_affectorProperties.push_back(entry);
+}
+
 //----------------------------------------------------------------------------//
 void AnimationInstance::onAnimationStarted()
 {
     purgeSavedPropertyValues();
+    d_affectorProperties.clear();
     d_definition->savePropertyValues(this);
 
     if (d_eventReceiver)
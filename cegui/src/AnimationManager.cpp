@@ -36,7 +36,6 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/Animation_xmlHandler.h"
 #include "CEGUI/Quaternion.h"
-#include "CEGUI/SharedStringStream.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -57,7 +56,7 @@ const String AnimationManager::GeneratedAnimationNameBase("__ceanim_uid_");
 *************************************************************************/
 AnimationManager::AnimationManager(void)
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::AnimationManager Singleton created. (" + addressStr + ")");
@@ -107,7 +106,7 @@ AnimationManager::~AnimationManager()
 
     d_basicInterpolators.clear();
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::AnimationManager singleton destroyed " + addressStr);
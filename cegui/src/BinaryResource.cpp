@@ -0,0 +1,339 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the binary form of the XML based resources
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/BinaryResource.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/XMLAttributes.h"
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//! size of the header: magic, version and three counts.
+const size_t HeaderSize = 8 + 4 * sizeof(std::uint32_t);
+
+//----------------------------------------------------------------------------//
+//! Bounds checked reading of the integers of a binary resource.
+class BinaryReader
+{
+public:
+    BinaryReader(const std::uint8_t* data, size_t size) :
+        d_data(data),
+        d_size(size),
+        d_pos(0)
+    {}
+
+    bool atEnd() const { return d_pos == d_size; }
+
+    std::uint8_t readByte()
+    {
+        require(1);
+        return d_data[d_pos++];
+    }
+
+    std::uint32_t readUint32()
+    {
+        require(4);
+        const std::uint8_t* p = d_data + d_pos;
+        d_pos += 4;
+
+        return static_cast<std::uint32_t>(p[0]) |
+               (static_cast<std::uint32_t>(p[1]) << 8) |
+               (static_cast<std::uint32_t>(p[2]) << 16) |
+               (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    const std::uint8_t* skip(size_t count)
+    {
+        require(count);
+        const std::uint8_t* p = d_data + d_pos;
+        d_pos += count;
+        return p;
+    }
+
+private:
+    void require(size_t count) const
+    {
+        if (count > d_size - d_pos)
+            throw InvalidRequestException(
+                "The binary resource is truncated or corrupt.");
+    }
+
+    const std::uint8_t* d_data;
+    size_t d_size;
+    size_t d_pos;
+};
+
+//----------------------------------------------------------------------------//
+std::string toUtf8(const String& str)
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32)
+    return String::convertUtf32ToUtf8(str.getString());
+#else
+    return str.getString();
+#endif
+}
+
+}
+
+//----------------------------------------------------------------------------//
+const char BinaryResource::Magic[8] = { 'C', 'E', 'G', 'U', 'I', 'B', 'I', 'N' };
+const std::uint32_t BinaryResource::Version = 1;
+
+//----------------------------------------------------------------------------//
+bool BinaryResource::isBinaryResource(const std::uint8_t* data, size_t size)
+{
+    return data && size >= HeaderSize &&
+           std::memcmp(data, Magic, sizeof(Magic)) == 0;
+}
+
+//----------------------------------------------------------------------------//
+void BinaryResource::parse(XMLHandler& handler, const std::uint8_t* data,
+                           size_t size)
+{
+    if (!isBinaryResource(data, size))
+        throw InvalidRequestException("The data is not a binary resource.");
+
+    BinaryReader reader(data, size);
+    reader.skip(sizeof(Magic));
+
+    const std::uint32_t version = reader.readUint32();
+    if (version != Version)
+        throw InvalidRequestException(
+            "The binary resource has version " +
+            PropertyHelper<std::uint32_t>::toString(version) +
+            " but only version " + PropertyHelper<std::uint32_t>::toString(Version) +
+            " is supported. Convert the resource again.");
+
+    const std::uint32_t string_count = reader.readUint32();
+    const std::uint32_t string_data_size = reader.readUint32();
+    const std::uint32_t event_data_size = reader.readUint32();
+
+    // decode every distinct string once
+    const std::uint8_t* offsets =
+        reader.skip(static_cast<size_t>(string_count + 1) * sizeof(std::uint32_t));
+    const char* string_data =
+        reinterpret_cast<const char*>(reader.skip(string_data_size));
+
+    BinaryReader offset_reader(offsets, (string_count + 1) * sizeof(std::uint32_t));
+    std::vector<String> strings;
+    strings.reserve(string_count);
+
+    std::uint32_t start = offset_reader.readUint32();
+    for (std::uint32_t i = 0; i < string_count; ++i)
+    {
+        const std::uint32_t end = offset_reader.readUint32();
+        if (start > end || end > string_data_size)
+            throw InvalidRequestException(
+                "The binary resource is truncated or corrupt.");
+
+        strings.push_back(String(std::string(string_data + start, end - start)));
+        start = end;
+    }
+
+    BinaryReader events(reader.skip(event_data_size), event_data_size);
+    if (!reader.atEnd())
+        throw InvalidRequestException(
+            "The binary resource is truncated or corrupt.");
+
+    const auto getString = [&strings](std::uint32_t index) -> const String&
+    {
+        if (index >= strings.size())
+            throw InvalidRequestException(
+                "The binary resource is truncated or corrupt.");
+
+        return strings[index];
+    };
+
+    while (!events.atEnd())
+    {
+        switch (static_cast<EventType>(events.readByte()))
+        {
+        case EventType::ElementStart:
+        {
+            const String& element = getString(events.readUint32());
+            const std::uint32_t attribute_count = events.readUint32();
+
+            XMLAttributes attributes;
+            for (std::uint32_t i = 0; i < attribute_count; ++i)
+            {
+                const String& name = getString(events.readUint32());
+                attributes.add(name, getString(events.readUint32()));
+            }
+
+            handler.elementStart(element, attributes);
+            break;
+        }
+
+        case EventType::ElementEnd:
+            handler.elementEnd(getString(events.readUint32()));
+            break;
+
+        case EventType::Text:
+            handler.text(getString(events.readUint32()));
+            break;
+
+        default:
+            throw InvalidRequestException(
+                "The binary resource is truncated or corrupt.");
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+BinaryResourceWriter::BinaryResourceWriter()
+{
+}
+
+//----------------------------------------------------------------------------//
+const String& BinaryResourceWriter::getDefaultResourceGroup() const
+{
+    static const String ret;
+    return ret;
+}
+
+//----------------------------------------------------------------------------//
+void BinaryResourceWriter::elementStart(const String& element,
+                                        const XMLAttributes& attributes)
+{
+    flushText();
+
+    d_events.push_back(static_cast<std::uint8_t>(BinaryResource::EventType::ElementStart));
+    writeUint32(internString(element));
+
+    const size_t count = attributes.getCount();
+    writeUint32(static_cast<std::uint32_t>(count));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        writeUint32(internString(attributes.getName(i)));
+        writeUint32(internString(attributes.getValue(i)));
+    }
+}
+
+//----------------------------------------------------------------------------//
+void BinaryResourceWriter::elementEnd(const String& element)
+{
+    flushText();
+
+    d_events.push_back(static_cast<std::uint8_t>(BinaryResource::EventType::ElementEnd));
+    writeUint32(internString(element));
+}
+
+//----------------------------------------------------------------------------//
+void BinaryResourceWriter::text(const String& text)
+{
+    d_pendingText += text;
+}
+
+//----------------------------------------------------------------------------//
+void BinaryResourceWriter::flushText()
+{
+    if (d_pendingText.empty())
+        return;
+
+    d_events.push_back(static_cast<std::uint8_t>(BinaryResource::EventType::Text));
+    writeUint32(internString(d_pendingText));
+    d_pendingText.clear();
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t BinaryResourceWriter::internString(const String& str)
+{
+    const auto it = d_stringIndices.find(str);
+    if (it != d_stringIndices.end())
+        return it->second;
+
+    const std::uint32_t index = static_cast<std::uint32_t>(d_strings.size());
+    d_strings.push_back(toUtf8(str));
+    d_stringIndices.emplace(str, index);
+
+    return index;
+}
+
+//----------------------------------------------------------------------------//
+void BinaryResourceWriter::writeUint32(std::uint32_t value)
+{
+    d_events.push_back(static_cast<std::uint8_t>(value));
+    d_events.push_back(static_cast<std::uint8_t>(value >> 8));
+    d_events.push_back(static_cast<std::uint8_t>(value >> 16));
+    d_events.push_back(static_cast<std::uint8_t>(value >> 24));
+}
+
+//----------------------------------------------------------------------------//
+std::vector<std::uint8_t> BinaryResourceWriter::getData() const
+{
+    // any text pending after the last element is whitespace, left out
+    std::vector<std::uint8_t> data(BinaryResource::Magic,
+                                   BinaryResource::Magic + sizeof(BinaryResource::Magic));
+
+    const auto append = [&data](std::uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+            data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    };
+
+    std::uint32_t string_data_size = 0;
+    for (const std::string& str : d_strings)
+        string_data_size += static_cast<std::uint32_t>(str.size());
+
+    append(BinaryResource::Version);
+    append(static_cast<std::uint32_t>(d_strings.size()));
+    append(string_data_size);
+    append(static_cast<std::uint32_t>(d_events.size()));
+
+    std::uint32_t offset = 0;
+    append(offset);
+    for (const std::string& str : d_strings)
+    {
+        offset += static_cast<std::uint32_t>(str.size());
+        append(offset);
+    }
+
+    for (const std::string& str : d_strings)
+        data.insert(data.end(), str.begin(), str.end());
+
+    data.insert(data.end(), d_events.begin(), d_events.end());
+
+    return data;
+}
+
+//----------------------------------------------------------------------------//
+void BinaryResourceWriter::reset()
+{
+    d_stringIndices.clear();
+    d_strings.clear();
+    d_events.clear();
+    d_pendingText.clear();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -106,19 +106,17 @@ std::vector<GeometryBuffer*> BitmapImage::createRenderGeometry(const ImageRender
         return std::vector<GeometryBuffer*>();
     }
 
-    TexturedColouredVertex vbuffer[6];
-    const CEGUI::ColourRect& colours = render_settings.d_multiplyColours;
-
-    createTexturedQuadVertices(vbuffer, colours, finalRect, texRect);
-
-
     CEGUI::GeometryBuffer& buffer = System::getSingleton().getRenderer()->createGeometryBufferTextured();
 
     buffer.setClippingActive(render_settings.d_clippingEnabled);
     if(render_settings.d_clippingEnabled)
         buffer.setClippingRegion(*render_settings.d_clipArea);
     buffer.setTexture("texture0", d_texture);
-    buffer.appendGeometry(vbuffer, 6);
+
+    createTexturedQuadVertices(buffer.beginAppendTexturedGeometry(6),
+        render_settings.d_multiplyColours, finalRect, texRect);
+    buffer.endAppendGeometry();
+
     buffer.setAlpha(render_settings.d_alpha);
 
     std::vector<GeometryBuffer*> geomBuffers;
@@ -145,10 +143,10 @@ void BitmapImage::addToRenderGeometry(
         return;
     }
     
-    TexturedColouredVertex vbuffer[6];
-    createTexturedQuadVertices(vbuffer, colours, finalRect, texRect);
-
-    geomBuffer.appendGeometry(vbuffer, 6);
+    // Write the quad straight into the storage of the buffer
+    createTexturedQuadVertices(geomBuffer.beginAppendTexturedGeometry(6),
+        colours, finalRect, texRect);
+    geomBuffer.endAppendGeometry();
 }
 
 
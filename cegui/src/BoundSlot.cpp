@@ -33,14 +33,16 @@ namespace CEGUI
 BoundSlot::BoundSlot(Group group, const SubscriberSlot& subscriber, Event& event) :
     d_group(group),
     d_subscriber(new SubscriberSlot(subscriber)),
-    d_event(&event)
+    d_event(&event),
+    d_serial(0)
 {}
 
 
 BoundSlot::BoundSlot(const BoundSlot& other) :
     d_group(other.d_group),
     d_subscriber(other.d_subscriber),
-    d_event(other.d_event)
+    d_event(other.d_event),
+    d_serial(other.d_serial)
 {}
 
 
@@ -56,6 +58,7 @@ BoundSlot& BoundSlot::operator=(const BoundSlot& other)
     d_group      = other.d_group;
     d_subscriber = other.d_subscriber;
     d_event      = other.d_event;
+    d_serial     = other.d_serial;
 
     return *this;
 }
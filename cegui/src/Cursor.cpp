@@ -36,6 +36,7 @@
 #include "CEGUI/Image.h"
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/CoordConverter.h"
+#include "CEGUI/RenderStats.h"
 #include "CEGUI/GUIContext.h"
 
 // Start of CEGUI namespace section
@@ -155,10 +156,24 @@ void Cursor::draw(std::uint32_t drawModeMask)
     if (!d_cachedGeometryValid)
         cacheGeometry();
 
-    System::getSingleton().getRenderer()->uploadBuffers(d_geometryBuffers);
+    RenderStats& stats = System::getSingleton().getRenderStats();
+    {
+        RenderStats::ScopedTimer timer(stats, RenderStatsTimer::UploadBuffers);
+        System::getSingleton().getRenderer()->uploadBuffers(d_geometryBuffers);
+    }
+
     const size_t geom_buffer_count = d_geometryBuffers.size();
     for (size_t i = 0; i < geom_buffer_count; ++i)
+    {
         d_geometryBuffers[i]->draw(drawModeMask);
+
+        if (stats.isEnabled())
+        {
+            const size_t vertex_count = d_geometryBuffers[i]->getVertexCount();
+            stats.addVerticesUploaded(vertex_count);
+            stats.addGeometryBufferDrawn(vertex_count);
+        }
+    }
 }
 
 
@@ -29,7 +29,6 @@
 #include "CEGUI/DefaultLogger.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/System.h"
-#include "CEGUI/SharedStringStream.h"
 #ifdef __ANDROID__
 #   include <android/log.h> 
 #endif
@@ -40,7 +39,10 @@ namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 DefaultLogger::DefaultLogger(void) 
-   : d_caching(true)
+   : d_caching(true),
+     d_asyncWriting(false),
+     d_writing(false),
+     d_stopWriter(false)
 {
     // create log header
     DefaultLogger::logEvent("+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+");
@@ -48,7 +50,7 @@ DefaultLogger::DefaultLogger(void)
     DefaultLogger::logEvent("+                          (http://www.cegui.org.uk/)                         +");
     DefaultLogger::logEvent("+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+\n");
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     DefaultLogger::logEvent("CEGUI::Logger Singleton created. (" + addressStr + ")");
 }
@@ -58,9 +60,10 @@ DefaultLogger::~DefaultLogger(void)
 {
     if (d_ostream.is_open())
     {
-        String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+        String addressStr = Logger::addressToString(this);
 
         DefaultLogger::logEvent("CEGUI::Logger singleton destroyed. " + addressStr);
+        stopWriterThread();
         d_ostream.close();
     }
 }
@@ -68,15 +71,62 @@ DefaultLogger::~DefaultLogger(void)
 //----------------------------------------------------------------------------//
 void DefaultLogger::logEvent(const String& message,
                              LoggingLevel level)
+{
+    // cached events are filtered when the log file gets created instead, as
+    // the logging level may still change until then.
+    if (!d_caching && d_level < level)
+        return;
+
+    const std::time_t event_time = std::time(nullptr);
+
+    if (d_writerThread.joinable())
+    {
+        bool was_empty;
+        {
+            std::lock_guard<std::mutex> lock(d_queueMutex);
+            was_empty = d_queue.empty();
+            const QueuedEvent event = { event_time, level, message };
+            d_queue.push_back(event);
+        }
+
+        if (was_empty)
+            d_queueNotEmpty.notify_one();
+
+        return;
+    }
+
+    if (!formatEvent(event_time, level, message))
+        return;
+
+    if (d_caching)
+    {
+        d_cache.push_back(std::make_pair(String(d_workstream.str().c_str()), level));
+    }
+    if (d_level >= level)
+    {
+        if (!d_caching)
+        {
+            // write message
+            d_ostream << d_workstream.str();
+            // ensure new event is written to the file, rather than just being
+            // buffered.
+            d_ostream.flush();
+        }
+
+        writeToSystemLog(level);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultLogger::formatEvent(std::time_t time, LoggingLevel level,
+                                const String& message)
 {
     using namespace std;
 
-    time_t et;
-    time(&et);
-    tm* etm = localtime(&et);
+    tm* etm = localtime(&time);
 
     if (!etm)
-        return;
+        return false;
 
     // clear sting stream
     d_workstream.str("");
@@ -119,51 +169,136 @@ void DefaultLogger::logEvent(const String& message,
         break;
     }
 
-    d_workstream << message << endl;
+    d_workstream << message << '\n';
 
-    if (d_caching)
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::writeToSystemLog(LoggingLevel level)
+{
+#ifdef __ANDROID__
+    int priority(ANDROID_LOG_UNKNOWN);
+    switch (level)
     {
-        d_cache.push_back(std::make_pair(String(d_workstream.str().c_str()), level));
+    case LoggingLevel::Error:
+        priority = ANDROID_LOG_ERROR;
+        break;
+    case LoggingLevel::Warning:
+        priority = ANDROID_LOG_WARN;
+        break;
+    case LoggingLevel::Standard:
+        priority = ANDROID_LOG_INFO;
+        break;
+    case LoggingLevel::Informative:
+        priority = ANDROID_LOG_DEBUG;
+        break;
+    case LoggingLevel::Insane:
+    default:
+        priority = ANDROID_LOG_VERBOSE;
+        break;
     }
-    if (d_level >= level)
+    __android_log_write(priority, "CEGUI_log", d_workstream.str().c_str());
+#else
+    CEGUI_UNUSED(level);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::setAsynchronousWriting(bool enabled)
+{
+    if (d_asyncWriting == enabled)
+        return;
+
+    d_asyncWriting = enabled;
+
+    // the writer only runs once there is a log file to write to.
+    if (!enabled)
+        stopWriterThread();
+    else if (!d_caching)
+        startWriterThread();
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::flush()
+{
+    if (!d_writerThread.joinable())
+        return;
+
+    std::unique_lock<std::mutex> lock(d_queueMutex);
+    d_queueDrained.wait(lock, [this] { return d_queue.empty() && !d_writing; });
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::startWriterThread()
+{
+    if (d_writerThread.joinable())
+        return;
+
+    d_stopWriter = false;
+    d_writerThread = std::thread(&DefaultLogger::writerThreadMain, this);
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::stopWriterThread()
+{
+    if (!d_writerThread.joinable())
+        return;
+
     {
-        if (!d_caching)
+        std::lock_guard<std::mutex> lock(d_queueMutex);
+        d_stopWriter = true;
+    }
+
+    d_queueNotEmpty.notify_one();
+    d_writerThread.join();
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::writerThreadMain()
+{
+    EventQueue batch;
+
+    std::unique_lock<std::mutex> lock(d_queueMutex);
+    for (;;)
+    {
+        d_queueNotEmpty.wait(lock, [this] { return !d_queue.empty() || d_stopWriter; });
+
+        // only stop once everything queued has been written
+        if (d_queue.empty())
+            break;
+
+        // take the whole queue, so logging threads only ever wait for a swap
+        batch.swap(d_queue);
+        d_writing = true;
+        lock.unlock();
+
+        for (const QueuedEvent& event : batch)
         {
-            // write message
-            d_ostream << d_workstream.str();
-            // ensure new event is written to the file, rather than just being
-            // buffered.
-            d_ostream.flush();
-        }
-        #ifdef __ANDROID__
-            int priority(ANDROID_LOG_UNKNOWN);
-            switch (level)
+            if (formatEvent(event.d_time, event.d_level, event.d_message))
             {
-            case LoggingLevel::Error:
-                priority = ANDROID_LOG_ERROR;
-                break;
-            case LoggingLevel::Warning:
-                priority = ANDROID_LOG_WARN;
-                break;
-            case LoggingLevel::Standard:
-                priority = ANDROID_LOG_INFO;
-                break;
-            case LoggingLevel::Informative:
-                priority = ANDROID_LOG_DEBUG;
-                break;
-            case LoggingLevel::Insane:
-            default:
-                priority = ANDROID_LOG_VERBOSE;
-                break;
+                d_ostream << d_workstream.str();
+                writeToSystemLog(event.d_level);
             }
-            __android_log_write(priority, "CEGUI_log", d_workstream.str().c_str());
-        #endif
+        }
+
+        // one flush per batch rather than per event
+        d_ostream.flush();
+        batch.clear();
+
+        lock.lock();
+        d_writing = false;
+        if (d_queue.empty())
+            d_queueDrained.notify_all();
     }
 }
 
 //----------------------------------------------------------------------------//
 void DefaultLogger::setLogFilename(const String& filename, bool append)
 {
+    // the writer thread must not touch the stream while it is reopened
+    stopWriterThread();
+
     // close current log file (if any)
     if (d_ostream.is_open())
         d_ostream.close();
@@ -215,6 +350,9 @@ void DefaultLogger::setLogFilename(const String& filename, bool append)
 
         d_cache.clear();
     }
+
+    if (d_asyncWriting)
+        startWriterThread();
 }
 
 //----------------------------------------------------------------------------//
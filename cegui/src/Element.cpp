@@ -40,6 +40,7 @@
 #include "CEGUI/DefaultParagraphDirection.h"
 
 #include <algorithm>
+#include <iterator>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -985,12 +986,14 @@ void Element::removeChild_impl(Element* element)
 {
     // NB: it is intentionally valid to remove an element that is not in the list
 
-    // find this element in the child list
-    ChildList::iterator it = std::find(d_children.begin(), d_children.end(), element);
+    // find this element in the child list, searching from the back so that
+    // removing all children in reverse order stays linear.
+    ChildList::reverse_iterator it =
+        std::find(d_children.rbegin(), d_children.rend(), element);
 
     // if the element was found in the child list, remove it from there
-    if (it != d_children.end())
-        d_children.erase(it);
+    if (it != d_children.rend())
+        d_children.erase(std::next(it).base());
 
     // reset element's parent so it's no longer this element
     if (element->getParentElement() == this)
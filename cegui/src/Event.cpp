@@ -55,6 +55,9 @@ private:
     const BoundSlot& d_s;
 };
 
+//----------------------------------------------------------------------------//
+std::uint64_t Event::s_nextSubscriptionSerial = 0;
+
 //----------------------------------------------------------------------------//
 Event::Event(const String& name) :
     d_name(name)
@@ -87,10 +90,47 @@ Event::Connection Event::subscribe(Event::Group group,
                                    const Event::Subscriber& slot)
 {
     Event::Connection c(new BoundSlot(group, slot, *this));
+    c->d_serial = s_nextSubscriptionSerial++;
     d_slots.insert(std::pair<Group, Connection>(group, c));
     return c;
 }
 
+//----------------------------------------------------------------------------//
+size_t Event::getConnectionCountBefore(std::uint64_t serial) const
+{
+    size_t count = 0;
+
+    for (SlotContainer::const_iterator iter = d_slots.begin();
+         iter != d_slots.end(); ++iter)
+    {
+        if (iter->second->d_serial < serial)
+            ++count;
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+void Event::disconnectSubscriptionsFrom(std::uint64_t serial)
+{
+    SlotContainer::iterator iter(d_slots.begin());
+
+    while (iter != d_slots.end())
+    {
+        if (iter->second->d_serial < serial)
+        {
+            ++iter;
+            continue;
+        }
+
+        // detach the slot first, so that releasing it does not come back here
+        Connection connection(iter->second);
+        connection->d_event = nullptr;
+        connection->d_subscriber->cleanup();
+        iter = d_slots.erase(iter);
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Event::operator()(EventArgs& args)
 {
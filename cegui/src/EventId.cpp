@@ -0,0 +1,101 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the interned event identifier
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/EventId.h"
+#include <unordered_map>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// The interned names. This is accessed through a function so that it exists
+// before the static EventId objects of other translation units are built.
+struct EventIdRegistry
+{
+    typedef std::unordered_map<String, std::uint32_t> ValueMap;
+
+    ValueMap d_values;
+    //! Names indexed by value; they point at the keys of d_values.
+    std::vector<const String*> d_names;
+
+    EventIdRegistry()
+    {
+        // value 0 is reserved for the invalid EventId
+        static const String empty;
+        d_names.push_back(&empty);
+    }
+};
+
+EventIdRegistry& getRegistry()
+{
+    static EventIdRegistry registry;
+    return registry;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+EventId::EventId(const String& name)
+{
+    EventIdRegistry& registry = getRegistry();
+
+    const std::pair<EventIdRegistry::ValueMap::iterator, bool> result =
+        registry.d_values.insert(std::make_pair(name,
+            static_cast<std::uint32_t>(registry.d_names.size())));
+
+    if (result.second)
+        registry.d_names.push_back(&result.first->first);
+
+    d_value = result.first->second;
+}
+
+//----------------------------------------------------------------------------//
+EventId EventId::find(const String& name)
+{
+    const EventIdRegistry& registry = getRegistry();
+    const EventIdRegistry::ValueMap::const_iterator pos =
+        registry.d_values.find(name);
+
+    EventId id;
+    if (pos != registry.d_values.end())
+        id.d_value = pos->second;
+
+    return id;
+}
+
+//----------------------------------------------------------------------------//
+const String& EventId::getName() const
+{
+    return *getRegistry().d_names[d_value];
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -31,10 +31,18 @@
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/ScriptModule.h"
 #include "CEGUI/System.h"
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+static bool eventIdValueLess(const std::pair<std::uint32_t, Event*>& entry,
+                             std::uint32_t value)
+{
+    return entry.first < value;
+}
+
 //----------------------------------------------------------------------------//
 EventSet::EventSet() :
     d_muted(false)
@@ -67,6 +75,14 @@ void EventSet::addEvent(Event& event)
     }
 
     d_events.insert(std::make_pair(name, &event));
+
+    const std::uint32_t id_value = EventId(name).getValue();
+    d_eventsById.insert(std::lower_bound(d_eventsById.begin(),
+                                         d_eventsById.end(),
+                                         id_value, &eventIdValueLess),
+                        std::make_pair(id_value, &event));
+
+    onEventAdded(event);
 }
 
 //----------------------------------------------------------------------------//
@@ -76,6 +92,11 @@ void EventSet::removeEvent(const String& name)
 
 	if (pos != d_events.end())
 	{
+        const std::uint32_t id_value = EventId::find(name).getValue();
+        d_eventsById.erase(std::lower_bound(d_eventsById.begin(),
+                                            d_eventsById.end(),
+                                            id_value, &eventIdValueLess));
+
 		delete pos->second;
 		d_events.erase(pos);
 	}
@@ -97,6 +118,7 @@ void EventSet::removeAllEvents(void)
 		delete pos->second;
 
     d_events.clear();
+    d_eventsById.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -147,15 +169,50 @@ Event::Connection EventSet::subscribeEvent(const String& name,
     return getEventObject(name, true)->subscribe(group, subscriber);
 }
 
+//----------------------------------------------------------------------------//
+Event::Connection EventSet::subscribeEvent(const EventId& id,
+                                           Event::Subscriber subscriber)
+{
+    if (Event* ev = getEventObjectById(id))
+        return ev->subscribe(subscriber);
+
+    return subscribeEvent(id.getName(), subscriber);
+}
+
+//----------------------------------------------------------------------------//
+Event::Connection EventSet::subscribeEvent(const EventId& id,
+                                           Event::Group group,
+                                           Event::Subscriber subscriber)
+{
+    if (Event* ev = getEventObjectById(id))
+        return ev->subscribe(group, subscriber);
+
+    return subscribeEvent(id.getName(), group, subscriber);
+}
+
 //----------------------------------------------------------------------------//
 void EventSet::fireEvent(const String& name,
                          EventArgs& args,
                          const String& eventNamespace)
 {
-    if (GlobalEventSet* ges = GlobalEventSet::getSingletonPtr())
-        ges->fireEvent(name, args, eventNamespace);
+    // every Event object, including those of the GlobalEventSet, interns its
+    // name when added; a name never interned can have no subscribers at all.
+    const EventId id(EventId::find(name));
+
+    if (id.isValid())
+        fireEvent(id, args, eventNamespace);
+}
+
+//----------------------------------------------------------------------------//
+void EventSet::fireEvent(const EventId& id,
+                         EventArgs& args,
+                         const String& eventNamespace)
+{
+    GlobalEventSet* ges = GlobalEventSet::getSingletonPtr();
+    if (ges && ges->isEventNameUsed(id))
+        ges->fireEvent(id.getName(), args, eventNamespace);
 
-    fireEvent_impl(name, args);
+    fireEvent_impl(id, args);
 }
 
 //----------------------------------------------------------------------------//
@@ -188,6 +245,20 @@ Event* EventSet::getEventObject(const String& name, bool autoAdd)
     return pos->second;
 }
 
+//----------------------------------------------------------------------------//
+Event* EventSet::getEventObjectById(const EventId& id) const
+{
+    const std::uint32_t id_value = id.getValue();
+    const EventIdVector::const_iterator pos =
+        std::lower_bound(d_eventsById.begin(), d_eventsById.end(),
+                         id_value, &eventIdValueLess);
+
+    if (pos == d_eventsById.end() || pos->first != id_value)
+        return nullptr;
+
+    return pos->second;
+}
+
 //----------------------------------------------------------------------------//
 void EventSet::fireEvent_impl(const String& name, EventArgs& args)
 {
@@ -197,6 +268,21 @@ void EventSet::fireEvent_impl(const String& name, EventArgs& args)
         (*ev)(args);
 }
 
+//----------------------------------------------------------------------------//
+void EventSet::fireEvent_impl(const EventId& id, EventArgs& args)
+{
+    if (d_muted || d_eventsById.empty())
+        return;
+
+    if (Event* ev = getEventObjectById(id))
+        (*ev)(args);
+}
+
+//----------------------------------------------------------------------------//
+void EventSet::onEventAdded(Event&)
+{
+}
+
 //----------------------------------------------------------------------------//
 EventSet::EventIterator EventSet::getEventIterator(void) const
 {
@@ -31,8 +31,11 @@
 #include "CEGUI/Image.h"
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderStats.h"
 
+#include <algorithm>
 #include <iterator>
+#include <utility>
 
 
 namespace CEGUI
@@ -127,20 +130,25 @@ void Font::addFontProperties()
     );
 }
 
-float Font::getTextExtent(const String& text) const
+float Font::getTextExtent(const String& text, size_t start, size_t length) const
 {
     float cur_extent = 0.0f;
     float adv_extent = 0.0f;
 
+    const size_t first = std::min(start, text.length());
+    const size_t end = first + std::min(length, text.length() - first);
+
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
-    for (size_t c = 0; c < text.length(); ++c)
+    for (size_t c = first; c < end; ++c)
     {
         char32_t currentCodePoint = text[c];
 
         getGlyphExtents(currentCodePoint, cur_extent, adv_extent);
     }
 #else
-    String::codepoint_iterator codePointIter(text.begin(), text.begin(), text.end());
+    String::codepoint_iterator codePointIter(text.begin() + first,
+                                             text.begin() + first,
+                                             text.begin() + end);
 
     while (!codePointIter.isAtEnd())
     {
@@ -177,12 +185,15 @@ void Font::getGlyphExtents(
 }
 
 //----------------------------------------------------------------------------//
-float Font::getTextAdvance(const String& text) const
+float Font::getTextAdvance(const String& text, size_t start, size_t length) const
 {
     float advance = 0.0f;
 
+    const size_t first = std::min(start, text.length());
+    const size_t end = first + std::min(length, text.length() - first);
+
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
-    for (size_t c = 0; c < text.length(); ++c)
+    for (size_t c = first; c < end; ++c)
     {
         if (const FontGlyph* glyph = getPreparedGlyph(text[c]))
         {
@@ -190,7 +201,9 @@ float Font::getTextAdvance(const String& text) const
         }
     }
 #else
-String::codepoint_iterator currentCodePointIter(text.begin(), text.begin(), text.end());
+String::codepoint_iterator currentCodePointIter(text.begin() + first,
+                                                text.begin() + first,
+                                                text.begin() + end);
 while (!currentCodePointIter.isAtEnd())
 {
     char32_t currentCodePoint = *currentCodePointIter;
@@ -278,13 +291,13 @@ std::vector<GeometryBuffer*> Font::layoutUsingFallbackAndCreateGlyphGeometry(
     const float space_extra,
     ImageRenderSettings imgRenderSettings, glm::vec2& glyphPos) const
 {
-    std::vector<GeometryBuffer*> textGeometryBuffers;
+    GlyphGeometryBatches textGeometryBatches;
 
     const float base_y = glyphPos.y + getBaseline();
 
     if (text.empty())
     {
-        return textGeometryBuffers;
+        return textGeometryBatches.d_buffers;
     }
 
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
@@ -313,7 +326,7 @@ std::vector<GeometryBuffer*> Font::layoutUsingFallbackAndCreateGlyphGeometry(
             imgRenderSettings.d_destArea =
                 Rectf(glyphPos, renderedSize);
 
-            addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
+            addGlyphRenderGeometry(textGeometryBatches, image, imgRenderSettings,
                 clip_rect, colours);
 
             glyphPos.x += glyph->getAdvance();
@@ -328,7 +341,7 @@ std::vector<GeometryBuffer*> Font::layoutUsingFallbackAndCreateGlyphGeometry(
 #endif
     }
 
-    return textGeometryBuffers;
+    return std::move(textGeometryBatches.d_buffers);
 }
 
 std::vector<GeometryBuffer*> Font::createTextRenderGeometry(
@@ -336,6 +349,9 @@ std::vector<GeometryBuffer*> Font::createTextRenderGeometry(
     const Rectf* clip_rect, const bool clipping_enabled,
     const ColourRect& colours, const DefaultParagraphDirection defaultParagraphDir, const float space_extra) const
 {
+    RenderStats::ScopedTimer timer(System::getSingleton().getRenderStats(),
+                                   RenderStatsTimer::FontLayout);
+
     ImageRenderSettings imgRenderSettings(
         Rectf(), clip_rect,
         clipping_enabled, colours);
@@ -440,56 +456,39 @@ void Font::onRenderSizeChanged(FontEventArgs& e)
     fireEvent(EventRenderSizeChanged, e, EventNamespace);
 }
 
-GeometryBuffer* Font::findCombinableBuffer(const std::vector<GeometryBuffer*>& geomBuffers,
-    const Image* image)
+void Font::addGlyphRenderGeometry(GlyphGeometryBatches& batches,
+    const Image* image, ImageRenderSettings& imgRenderSettings,
+    const Rectf* clip_rect, const ColourRect& colours) const
 {
-    const BitmapImage* bitmapImage = static_cast<const BitmapImage*>(image);
-    if(bitmapImage == nullptr)
-    {
-        return nullptr;
-    }
-
-    const Texture* requiredTexture = bitmapImage->getTexture();
-
-    for(auto& currentGeomBuffer : geomBuffers)
+    // Glyphs drawing from the same texture are combined into one
+    // GeometryBuffer. Render order is irrelevant since glyphs should never
+    // overlap
+    const Texture* requiredTexture =
+        static_cast<const BitmapImage*>(image)->getTexture();
+
+    // there are only ever a few glyph textures, so a linear search of the
+    // texture pointers beats any map
+    for (size_t i = 0; i < batches.d_textures.size(); ++i)
     {
-        const Texture* currentTexture = currentGeomBuffer->getTexture("texture0");
-
-        if(requiredTexture == currentTexture)
+        if (batches.d_textures[i] == requiredTexture)
         {
-            return currentGeomBuffer;
+            image->addToRenderGeometry(*batches.d_buffers[i],
+                imgRenderSettings.d_destArea, clip_rect, colours);
+            return;
         }
     }
 
-    return nullptr;
-}
-
-void Font::addGlyphRenderGeometry(std::vector<GeometryBuffer*>& textGeometryBuffers,
-    const Image* image, ImageRenderSettings& imgRenderSettings,
-    const Rectf* clip_rect, const ColourRect& colours) const
-{
-    // We only fully create a GeometryBuffer if no existing one
-    // is found that we can combine this one with. Render order is irrelevant since
-    // glyphs should never overlap
-    GeometryBuffer* matchingGeomBuffer = findCombinableBuffer(textGeometryBuffers, image);
-
-    if (matchingGeomBuffer == nullptr)
-    {
-        imgRenderSettings.d_multiplyColours = colours;
-        std::vector<GeometryBuffer*> glyphGeomBuffer =
-            image->createRenderGeometry(imgRenderSettings);
+    imgRenderSettings.d_multiplyColours = colours;
+    std::vector<GeometryBuffer*> glyphGeomBuffer =
+        image->createRenderGeometry(imgRenderSettings);
 
-        assert(glyphGeomBuffer.size() <= 1 && "Glyphs are expected to "
-            "be built from a single GeometryBuffer (or none)");
+    assert(glyphGeomBuffer.size() <= 1 && "Glyphs are expected to "
+        "be built from a single GeometryBuffer (or none)");
 
-        textGeometryBuffers.insert(textGeometryBuffers.end(),
-            glyphGeomBuffer.begin(), glyphGeomBuffer.end());
-    }
-    else
+    for (GeometryBuffer* buffer : glyphGeomBuffer)
     {
-        // Else we add geometry to the rendering batch of the existing geometry
-        image->addToRenderGeometry(*matchingGeomBuffer, imgRenderSettings.d_destArea,
-            clip_rect, colours);
+        batches.d_buffers.push_back(buffer);
+        batches.d_textures.push_back(requiredTexture);
     }
 }
 
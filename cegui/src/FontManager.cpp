@@ -34,7 +34,6 @@
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/PixmapFont.h"
-#include "CEGUI/SharedStringStream.h"
 
 #ifdef CEGUI_HAS_FREETYPE
 #   include "CEGUI/FreeTypeFont.h"
@@ -53,7 +52,7 @@ const String FontManager::ResourceTypeName = "Font";
 
 FontManager::FontManager()
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::FontManager Singleton created. (" + addressStr + ")");
@@ -66,7 +65,7 @@ FontManager::~FontManager()
 
     destroyAll();
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::FontManager singleton destroyed. (" + addressStr + ")");
@@ -299,7 +298,7 @@ bool FontManager::isDefined(const String& font_name) const
 void FontManager::destroyObject(
     FontRegistry::iterator ob)
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(ob->second);
+    String addressStr = Logger::addressToString(ob->second);
     Logger::getSingleton().logEvent("Object of type '" + ResourceTypeName +
         "' named '" + ob->first + "' has been destroyed. " +
         addressStr, LoggingLevel::Informative);
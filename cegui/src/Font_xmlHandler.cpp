@@ -35,7 +35,6 @@
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/PixmapFont.h"
-#include "CEGUI/SharedStringStream.h"
 #include "CEGUI/FontManager.h"
 
 #ifdef CEGUI_HAS_FREETYPE
@@ -204,7 +203,7 @@ void Font_xmlHandler::validateFontFileVersion(const XMLAttributes& attrs)
 //----------------------------------------------------------------------------//
 void Font_xmlHandler::elementFontEnd()
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(d_font);
+    String addressStr = Logger::addressToString(d_font);
     Logger::getSingleton().logEvent("Finished creation of Font '" +
         d_font->getName() + "' via XML file. " + addressStr, LoggingLevel::Informative);
 
@@ -34,13 +34,13 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Font_xmlHandler.h"
-#include "CEGUI/SharedStringStream.h"
 #include "CEGUI/FreeTypeFontGlyph.h"
 
 #ifdef CEGUI_USE_RAQM
 #include <raqm.h>
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 
@@ -175,9 +175,9 @@ FreeTypeFont::FreeTypeFont(
 
     FreeTypeFont::updateFont();
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "Successfully loaded " << d_codePointToGlyphMap.size() << " glyphs";
-    Logger::getSingleton().logEvent(sstream.str(), LoggingLevel::Informative);
+    Logger::getSingleton().logEvent("Successfully loaded " +
+        PropertyHelper<std::uint64_t>::toString(d_codePointToGlyphMap.size()) +
+        " glyphs", LoggingLevel::Informative);
 }
 
 //----------------------------------------------------------------------------//
@@ -211,81 +211,27 @@ void FreeTypeFont::addFreeTypeFontProperties()
     );
 }
 
-void FreeTypeFont::resizeAndUpdateTexture(Texture* texture, int newSize) const
+//----------------------------------------------------------------------------//
+void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph, FT_Bitmap& ft_bitmap, int glyphLeft, int glyphTop,
+    int glyphWidth, int glyphHeight, int unsigned layer) const
 {
-    if(d_lastTextureSize >= newSize)
-    {
-        InvalidRequestException("Must supply a larger than previous size when "
-            "resizing the glyph atlas");
-    }
-
-    int oldTextureSize = d_lastTextureSize;
-    std::vector<argb_t> oldTextureData(d_lastTextureBuffer);
-
-    Sizef newTextureSize(static_cast<float>(newSize),
-                         static_cast<float>(newSize));
-    d_lastTextureSize = newSize;
-
-    d_lastTextureBuffer.resize(newSize * newSize);
-    std::fill(d_lastTextureBuffer.begin(), d_lastTextureBuffer.end(), 0);
+    // Reserve the glyph area plus padding separating it from its neighbours
+    int glyphX = 0;
+    int glyphY = 0;
+    GlyphAtlas& atlas = getOrCreateGlyphAtlas();
+    Texture& texture = atlas.allocate(
+        glyphWidth + s_glyphPadding, glyphHeight + s_glyphPadding, glyphX, glyphY);
 
-    // Copy our memory buffer into the texture and free it
-    updateTextureBufferSubImage(d_lastTextureBuffer.data(),
-        oldTextureSize, oldTextureSize, oldTextureData);
+    // Create the coverage values of the glyph and upload them; the atlas
+    // expands them if its pages are not single channel
+    const std::vector<std::uint8_t> coverage = createGlyphTextureData(ft_bitmap);
 
-    //TODO: why always RGBA if we, and Freetype, only support greyscale?
-    texture->loadFromMemory(d_lastTextureBuffer.data(), newTextureSize, Texture::PixelFormat::Rgba);
-
-    System::getSingleton().getRenderer()->updateGeometryBufferTexCoords(texture,
-        oldTextureSize / static_cast<float>(newSize));
-}
-
-void FreeTypeFont::createTextureSpaceForGlyphRasterisation(Texture* texture, int glyphWidth, int glyphHeight) const
-{
-    int maxTextureSize = System::getSingleton().getRenderer()->getMaxTextureSize();
-    const int scaleFactor = 2;
-
-    if(glyphWidth > maxTextureSize || glyphHeight > maxTextureSize)
-    {
-        InvalidRequestException("Can not rasterise a glyph that is larger "
-            "than the maximum supported texture size.");
-    }
-        
-    int newSize = d_lastTextureSize * scaleFactor;
-    if (newSize > maxTextureSize)
-    {
-        createGlyphAtlasTexture();
-    }
-    else
-    {
-        resizeAndUpdateTexture(texture, newSize);
-    }
-}
+    const Rectf area(static_cast<float>(glyphX),
+        static_cast<float>(glyphY),
+        static_cast<float>(glyphX + glyphWidth),
+        static_cast<float>(glyphY + glyphHeight));
 
-void FreeTypeFont::addRasterisedGlyphToTextureAndSetupGlyphImage(
-    FreeTypeFontGlyph* glyph, Texture* texture, FT_Bitmap& glyphBitmap, int glyphLeft, int glyphTop,
-    int glyphWidth, int glyphHeight, unsigned int layer,
-    const TextureGlyphLine& glyphTexLine) const
-{
-    // Create the data containing the pixels of the glyph
-    std::vector<argb_t> subTextureData = createGlyphTextureData(glyphBitmap);
-
-    // Update the cached texture data in memory
-    size_t bufferDataGlyphPos = (glyphTexLine.d_lastYPos * d_lastTextureSize) + glyphTexLine.d_lastXPos;
-    updateTextureBufferSubImage(d_lastTextureBuffer.data() + bufferDataGlyphPos,
-        glyphWidth, glyphHeight, subTextureData);
-
-    // Update the sub-image in the texture on the GPU
-    glm::vec2 subImagePos(glyphTexLine.d_lastXPos, glyphTexLine.d_lastYPos);
-    Sizef subImageSize(static_cast<float>(glyphWidth), static_cast<float>(glyphHeight));
-    Rectf subImageArea(subImagePos, subImageSize);
-    texture->blitFromMemory(subTextureData.data(), subImageArea);
-
-    // Create a new image in the imageset
-    const Rectf area(static_cast<float>(glyphTexLine.d_lastXPos),
-        static_cast<float>(glyphTexLine.d_lastYPos),
-        static_cast<float>(glyphTexLine.d_lastXPos + glyphWidth),
-        static_cast<float>(glyphTexLine.d_lastYPos + glyphHeight));
+    atlas.blitCoverage(texture, coverage.data(), area);
 
     // This is the right bearing for bitmap glyphs, not d_fontFace->glyph->metrics.horiBearingX
     const glm::vec2 offset(
@@ -295,168 +241,69 @@ void FreeTypeFont::addRasterisedGlyphToTextureAndSetupGlyphImage(
     const String name(PropertyHelper<std::uint32_t>::toString(glyph->getCodePoint()));
 
     BitmapImage* img = new BitmapImage(
-        name, texture, area,
+        name, &texture, area,
         offset, AutoScaledMode::Disabled, d_nativeResolution);
     d_glyphImages.push_back(img);
 
     glyph->setImage(img, layer);
 }
 
-void FreeTypeFont::findFittingSpotInGlyphTextureLines(
-    int glyphWidth, int glyphHeight,
-    bool &fittingLineWasFound, size_t &fittingLineIndex) const 
-{
-    // Go through the lines and find one that fits
-    size_t lineCount =  d_textureGlyphLines.size();
-    for(size_t i = 0; i < lineCount && !fittingLineWasFound; ++i)
-    {
-        const auto& currentGlyphLine = d_textureGlyphLines[i];
-
-        bool isLastLine = (i == (lineCount - 1));
-
-        // Check if glyph right margin exceeds texture size
-        int curGlyphXEnd = currentGlyphLine.d_lastXPos + glyphWidth;
-        int curGlyphYEnd = currentGlyphLine.d_lastYPos + glyphHeight;
-        if (curGlyphXEnd < d_lastTextureSize && curGlyphYEnd < d_lastTextureSize)
-        {
-            //Only the last line can be extended into the y-dimension
-            if (isLastLine)
-            {
-                if (curGlyphYEnd > currentGlyphLine.d_maximumExtentY)
-                {
-                    currentGlyphLine.d_maximumExtentY = curGlyphYEnd;
-                }
-
-                fittingLineIndex = i;
-                fittingLineWasFound = true;
-            }
-            else
-            {
-                if (curGlyphYEnd < currentGlyphLine.d_maximumExtentY)
-                {
-                    fittingLineIndex = i;
-                    fittingLineWasFound = true;
-                }
-            }
-        }
-    }
-}
-
 //----------------------------------------------------------------------------//
-void FreeTypeFont::rasterise(FreeTypeFontGlyph* glyph, FT_Bitmap& ft_bitmap, int glyphLeft, int glyphTop,
-    int glyphWidth, int glyphHeight, int unsigned layer) const
-{
-    if(d_glyphTextures.empty())
-    {
-        createGlyphAtlasTexture();
-    }
-
-    bool fittingLineWasFound = false;
-    size_t fittingLineIndex = -1;
-
-    findFittingSpotInGlyphTextureLines(glyphWidth, glyphHeight,
-        fittingLineWasFound, fittingLineIndex);
-
-    if(!fittingLineWasFound)
-    {
-        fittingLineWasFound = addNewLineIfFitting(glyphHeight, glyphWidth, fittingLineIndex);
-    }
-
-    if(!fittingLineWasFound)
-    {
-        Texture* texture = d_glyphTextures.back();
-        createTextureSpaceForGlyphRasterisation(texture, glyphWidth, glyphHeight);
-
-        rasterise(glyph, ft_bitmap, glyphLeft, glyphTop, glyphWidth, glyphHeight, layer);
-        return;
-    }
-
-    const TextureGlyphLine& glyphTexLine = d_textureGlyphLines[fittingLineIndex];
-
-    // Retrieve the last texture created
-    Texture* texture = d_glyphTextures.back();
-
-    addRasterisedGlyphToTextureAndSetupGlyphImage(glyph, texture, ft_bitmap,
-        glyphLeft, glyphTop, glyphWidth, glyphHeight, layer, glyphTexLine);
-
-    // Advance to next position, add padding
-    glyphTexLine.d_lastXPos += glyphWidth + s_glyphPadding;
-}
-
-bool FreeTypeFont::addNewLineIfFitting(unsigned int glyphHeight, unsigned int glyphWidth,
-    size_t& fittingLineIndex) const
+GlyphAtlas& FreeTypeFont::getOrCreateGlyphAtlas() const
 {
-    const auto& lastLine = d_textureGlyphLines.back();
+    if (d_glyphAtlas)
+        return *d_glyphAtlas;
 
-    unsigned int newLinePosY = lastLine.d_maximumExtentY + s_glyphPadding;
-    int newMaxYExtent = newLinePosY + glyphHeight;
-    
-    // Also skip if the texture isn't wide enough
-    const int curGlyphXEnd = glyphWidth;
-    
-    if (newMaxYExtent <= d_lastTextureSize && curGlyphXEnd < d_lastTextureSize)
+    int pageSize = d_glyphAtlasPageSize;
+    if (pageSize <= 0)
     {
-        // Add the glyph in a new line
-        d_textureGlyphLines.push_back(TextureGlyphLine(0, newLinePosY, newMaxYExtent));
-        fittingLineIndex = d_textureGlyphLines.size() - 1;
-        return true;
+        // room for roughly 16 rows of glyphs, which is enough for the ASCII
+        // range and still reasonably small for large fonts
+        const int glyphRows = 16;
+        const int maxPageSize = std::min(1024, static_cast<int>(
+            System::getSingleton().getRenderer()->getMaxTextureSize()));
+
+        pageSize = 64;
+        while (pageSize < maxPageSize &&
+               pageSize < static_cast<int>(std::ceil(getFontHeight())) * glyphRows)
+            pageSize *= 2;
     }
 
-    return false;
-}
+    d_glyphAtlas = new GlyphAtlas(d_name + "_auto_glyph_images_texture", pageSize);
+    d_ownsGlyphAtlas = true;
 
-void FreeTypeFont::createGlyphAtlasTexture() const
-{
-    std::uint32_t newTextureIndex = d_glyphTextures.size();
-    const String texture_name(d_name + "_auto_glyph_images_texture_" +
-        PropertyHelper<std::uint32_t>::toString(newTextureIndex));
-
-    d_lastTextureSize = d_initialGlyphAtlasSize;
-    Sizef newTextureSize(static_cast<float>(d_initialGlyphAtlasSize),
-        static_cast<float>(d_initialGlyphAtlasSize));
-    Texture& texture = System::getSingleton().getRenderer()->createTexture(
-        texture_name, newTextureSize);
-    d_glyphTextures.push_back(&texture);
-
-    d_lastTextureBuffer = std::vector<argb_t>(d_lastTextureSize * d_lastTextureSize, 0);
-    d_textureGlyphLines.clear();
-    d_textureGlyphLines.push_back(TextureGlyphLine());
+    return *d_glyphAtlas;
 }
 
 //----------------------------------------------------------------------------//
-std::vector<argb_t> FreeTypeFont::createGlyphTextureData(FT_Bitmap& glyphBitmap)
+std::vector<std::uint8_t> FreeTypeFont::createGlyphTextureData(FT_Bitmap& glyphBitmap)
 {
     unsigned int bitmapHeight = static_cast<unsigned int>(glyphBitmap.rows);
     unsigned int bitmapWidth = static_cast<unsigned int>(glyphBitmap.width);
 
-    std::vector<argb_t> glyphTextureData;
+    std::vector<std::uint8_t> glyphTextureData;
     glyphTextureData.resize(bitmapHeight * bitmapWidth);
 
     for (unsigned int i = 0; i < bitmapHeight; ++i)
     {
-        argb_t* currentRow =  glyphTextureData.data() + i * bitmapWidth;
+        std::uint8_t* currentRow = glyphTextureData.data() + i * bitmapWidth;
+        const std::uint8_t* src = glyphBitmap.buffer + i * glyphBitmap.pitch;
 
-        for (unsigned int j = 0; j < bitmapWidth; ++j)
+        switch (glyphBitmap.pixel_mode)
         {
-            std::uint8_t* src = glyphBitmap.buffer + (i * glyphBitmap.pitch + j);
+        case FT_PIXEL_MODE_GRAY:
+            std::copy(src, src + bitmapWidth, currentRow);
+            break;
 
-            switch (glyphBitmap.pixel_mode)
-            {
-            case FT_PIXEL_MODE_GRAY:
-            {
-                currentRow[j] = Colour::calculateArgb(*src, 0xFF, 0xFF, 0xFF);
-                break;
-            }
-            case FT_PIXEL_MODE_MONO:
-            {
-                currentRow[j] = (src[j / 8] & (0x80 >> (j & 7))) ? 0xFFFFFFFF : 0x00000000;
-                break;
-            }
-            default:
-                throw InvalidRequestException(
-                    "The glyph could not be drawn because the pixel mode is "
-                    "unsupported.");
-            }
+        case FT_PIXEL_MODE_MONO:
+            for (unsigned int j = 0; j < bitmapWidth; ++j)
+                currentRow[j] = (src[j / 8] & (0x80 >> (j & 7))) ? 0xFF : 0x00;
+            break;
+
+        default:
+            throw InvalidRequestException(
+                "The glyph could not be drawn because the pixel mode is "
+                "unsupported.");
         }
     }
 
@@ -500,29 +347,13 @@ FT_Stroker_LineJoin FreeTypeFont::getLineJoin(FreeTypeLineJoin line_join) {
     return ft_line_join;
 }
 
-//----------------------------------------------------------------------------//
-void FreeTypeFont::updateTextureBufferSubImage(argb_t* destTextureData, unsigned int bitmapWidth,
-    unsigned int bitmapHeight, const std::vector<argb_t>& subImageData) const
-{
-    argb_t* curDestPixelLine = destTextureData;
-
-    for (unsigned int i = 0;  i < bitmapHeight;  ++i)
-    {
-        argb_t* curDestPixel = curDestPixelLine;
-
-        for (unsigned int j = 0; j < bitmapWidth; ++j)
-        {
-            *curDestPixel = subImageData[bitmapWidth * i + j];
-            ++curDestPixel;
-        }
-
-        curDestPixelLine += d_lastTextureSize;
-    }
-}
-
 //----------------------------------------------------------------------------//
 void FreeTypeFont::free()
 {
+    // the cached runs point at the glyphs that are about to be deleted
+    clearShapedRunCache();
+    d_uncachedShapedRun.d_glyphs.clear();
+
     if (!d_fontFace)
         return;
 
@@ -538,9 +369,14 @@ void FreeTypeFont::free()
         delete d_glyphImages[i];
     d_glyphImages.clear();
 
-    for (size_t i = 0; i < d_glyphTextures.size(); i++)
-        System::getSingleton().getRenderer()->destroyTexture(*d_glyphTextures[i]);
-    d_glyphTextures.clear();
+    // the area used in a shared atlas is not reclaimed; it is only cleared
+    // along with the atlas itself.
+    if (d_ownsGlyphAtlas)
+    {
+        delete d_glyphAtlas;
+        d_glyphAtlas = nullptr;
+        d_ownsGlyphAtlas = false;
+    }
 
     FT_Done_Face(d_fontFace);
     d_fontFace = nullptr;
@@ -624,11 +460,9 @@ void FreeTypeFont::tryToCreateFontWithClosestFontHeight(
 
     if (errorResult != 0)
     {
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-        sstream << d_size;
         throw GenericException("The font '" + d_name + "' requested at height "
-            "of " + sstream.str() + " pixels, could not be created and therefore"
-            " not used");
+            "of " + PropertyHelper<float>::toString(d_size) + " pixels, could not "
+            "be created and therefore not used");
     }
 }
 
@@ -981,30 +815,69 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
     const float space_extra, ImageRenderSettings imgRenderSettings,
     glm::vec2& penPosition) const
 {
-    std::vector<GeometryBuffer*> textGeometryBuffers;
+    GlyphGeometryBatches textGeometryBatches;
 
     if (text.empty())
     {
-        return textGeometryBuffers;
+        return textGeometryBatches.d_buffers;
     }
 
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
-    std::u32string utf32Text = String::convertUtf8ToUtf32(text.c_str(), text.length());
-#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) 
-    const std::u32string& utf32Text = text.getString();
-#endif
+    const ShapedRun& run = getShapedRun(text, DefaultParagraphDirection::LeftToRight, false);
     glm::vec2 penPositionStart = penPosition;
 
     unsigned int layerCount = d_fontLayers.size();
     for (int layerTmp = layerCount -1; layerTmp >= 0; layerTmp--) {
     unsigned int layer = static_cast<unsigned int>(layerTmp);
 
-    FT_Pos previousRsbDelta = 0;
-    unsigned int previousGlyphIndex = 0;
     penPosition = penPositionStart;
     penPosition.y += getBaseline();
 
+    const CEGUI::ColourRect fallbackColour;
+    const CEGUI::ColourRect& currentlayerColour = (layer < layerColours.size()) ?
+        layerColours[layer] : fallbackColour;
+
+    for (const ShapedGlyph& shapedGlyph : run.d_glyphs)
+    {
+        penPosition.x += shapedGlyph.d_penAdjustment;
+
+        const Image* const image = shapedGlyph.d_glyph->getImage(layer);
+        if (image)
+        {
+            imgRenderSettings.d_destArea =
+                Rectf(penPosition, image->getRenderedSize());
+
+            addGlyphRenderGeometry(textGeometryBatches, image, imgRenderSettings,
+                clip_rect, currentlayerColour);
+        }
+
+        penPosition.x += shapedGlyph.d_advance;
+
+        if (shapedGlyph.d_isSpace)
+        {
+            // TODO: This is for justified text and probably wrong because the space was determined
+            // without considering kerning
+            penPosition.x += space_extra;
+        }
+    }
+
+    } //for layers
+    return std::move(textGeometryBatches.d_buffers);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::shapeUsingFreetype(const String& text, ShapedRun& run) const
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
+    std::u32string utf32Text = String::convertUtf8ToUtf32(text.c_str(), text.length());
+#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) 
+    const std::u32string& utf32Text = text.getString();
+#endif
+
+    FT_Pos previousRsbDelta = 0;
+    unsigned int previousGlyphIndex = 0;
+
     size_t charCount = utf32Text.size();
+    run.d_glyphs.reserve(charCount);
     for (size_t i = 0; i < charCount; ++i)
     {
         const char32_t& codePoint = utf32Text[i];
@@ -1029,8 +902,8 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
             }
         }
 
-     
-        adjustPenPositionForBearingDeltas(penPosition, previousRsbDelta, glyph);
+        glm::vec2 penAdjustment(0.0f, 0.0f);
+        adjustPenPositionForBearingDeltas(penAdjustment, previousRsbDelta, glyph);
         previousRsbDelta = glyph->getRsbDelta();
 
         if (i >= 1)
@@ -1042,36 +915,90 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingFreetypeAndCreateRenderGeo
             FT_Get_Kerning(d_fontFace, previousGlyphIndex, rightGlyphIndex,
                 FT_KERNING_DEFAULT, &kerning);
 
-            penPosition.x += kerning.x * s_conversionMultCoeff;
+            penAdjustment.x += kerning.x * s_conversionMultCoeff;
         }
         previousGlyphIndex = glyph->getGlyphIndex();
 
-            const Image* const image = glyph->getImage(layer);
-            if (image)
-            {
-                imgRenderSettings.d_destArea =
-                    Rectf(penPosition, image->getRenderedSize());
+        const ShapedGlyph shapedGlyph = { glyph, penAdjustment.x,
+            glm::vec2(0.0f, 0.0f), glyph->getAdvance(), codePoint == ' ' };
+        run.d_glyphs.push_back(shapedGlyph);
+    }
+}
 
-                const CEGUI::ColourRect fallbackColour;
-                const CEGUI::ColourRect& currentlayerColour = (layer < layerColours.size()) ?
-                    layerColours[layer] : fallbackColour;
+//----------------------------------------------------------------------------//
+const FreeTypeFont::ShapedRun& FreeTypeFont::getShapedRun(const String& text,
+    DefaultParagraphDirection defaultParagraphDir, bool use_raqm) const
+{
+    ShapedRun* run = &d_uncachedShapedRun;
 
-                addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
-                    clip_rect, currentlayerColour);
-            }
+    if (d_shapedRunCacheCapacity > 0)
+    {
+        const ShapedRunKey key = { text, defaultParagraphDir, use_raqm };
 
-        penPosition.x += glyph->getAdvance();
+        ShapedRunCache::iterator pos = d_shapedRunCache.find(key);
+        if (pos != d_shapedRunCache.end())
+        {
+            d_shapedRunUses.splice(d_shapedRunUses.begin(), d_shapedRunUses,
+                pos->second.d_use);
+            return pos->second.d_run;
+        }
 
-        if (codePoint == ' ')
+        // make room by dropping the least recently drawn run
+        if (d_shapedRunCache.size() >= d_shapedRunCacheCapacity)
         {
-            // TODO: This is for justified text and probably wrong because the space was determined
-            // without considering kerning
-            penPosition.x += space_extra;
+            d_shapedRunCache.erase(*d_shapedRunUses.back());
+            d_shapedRunUses.pop_back();
         }
+
+        pos = d_shapedRunCache.insert(
+            std::make_pair(key, ShapedRunCacheEntry())).first;
+        d_shapedRunUses.push_front(&pos->first);
+        pos->second.d_use = d_shapedRunUses.begin();
+
+        run = &pos->second.d_run;
     }
 
-    } //for layers
-    return textGeometryBuffers;
+    run->d_glyphs.clear();
+
+#ifdef CEGUI_USE_RAQM
+    if (use_raqm)
+        shapeUsingRaqm(text, defaultParagraphDir, *run);
+    else
+#endif
+        shapeUsingFreetype(text, *run);
+
+    return *run;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::clearShapedRunCache()
+{
+    d_shapedRunCache.clear();
+    d_shapedRunUses.clear();
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::getShapedRunCacheCapacity() const
+{
+    return d_shapedRunCacheCapacity;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setShapedRunCacheCapacity(size_t capacity)
+{
+    d_shapedRunCacheCapacity = capacity;
+
+    while (d_shapedRunCache.size() > capacity)
+    {
+        d_shapedRunCache.erase(*d_shapedRunUses.back());
+        d_shapedRunUses.pop_back();
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t FreeTypeFont::getShapedRunCacheSize() const
+{
+    return d_shapedRunCache.size();
 }
 
 #ifdef CEGUI_USE_RAQM
@@ -1091,107 +1018,118 @@ std::vector<GeometryBuffer*> FreeTypeFont::layoutUsingRaqmAndCreateRenderGeometr
     const float space_extra, ImageRenderSettings imgRenderSettings, 
     DefaultParagraphDirection defaultParagraphDir, glm::vec2& penPosition) const
 {
-    std::vector<GeometryBuffer*> textGeometryBuffers;
+    GlyphGeometryBatches textGeometryBatches;
 
     if (text.empty())
     {
-        return textGeometryBuffers;
+        return textGeometryBatches.d_buffers;
     }
 
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
-    std::u32string utf32Text = String::convertUtf8ToUtf32(text.c_str());
-    size_t origTextLength = utf32Text.length();
-    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(utf32Text.c_str());
-#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) 
-    size_t origTextLength = text.length();
-    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(text.c_str());
-#endif
+    const ShapedRun& run = getShapedRun(text, defaultParagraphDir, true);
     glm::vec2 penPositionStart = penPosition;
 
-    raqm_t* raqmObject = createAndSetupRaqmTextObject(
-        originalTextArray, origTextLength, defaultParagraphDir, getFontFace());
-
     const std::size_t layerCount = d_fontLayers.size();
     for (int layerTmp = layerCount - 1; layerTmp >= 0; layerTmp--) {
         unsigned int layer = static_cast<unsigned int>(layerTmp);
 
-        size_t count = 0;
-        raqm_glyph_t* glyphs = raqm_get_glyphs(raqmObject, &count);
         penPosition = penPositionStart;
         penPosition.y += getBaseline();
 
-        for (size_t i = 0; i < count; i++)
+        const CEGUI::ColourRect fallbackColour;
+        const CEGUI::ColourRect& currentlayerColour = (layer < layerColours.size()) ?
+            layerColours[layer] : fallbackColour;
+
+        for (const ShapedGlyph& shapedGlyph : run.d_glyphs)
         {
-            raqm_glyph_t& currentGlyph = glyphs[i];
+            const Image* const image = shapedGlyph.d_glyph->getImage(layer);
+            if (image) {
+                penPosition.x = std::round(penPosition.x);
 
-            char32_t codePoint;
-            auto foundCodePointIter = d_indexToGlyphMap.find(currentGlyph.index);
-            if (foundCodePointIter != d_indexToGlyphMap.end())
-            {
-                codePoint = foundCodePointIter->second;
-            }
-            else
-            {
-                codePoint = UnicodeReplacementCharacter;
-            }
+                //The glyph pos will be rounded to full pixels internally
+                imgRenderSettings.d_destArea = Rectf(
+                    penPosition + shapedGlyph.d_offset, image->getRenderedSize());
 
-            // Ignore new line characters
-            if (originalTextArray[currentGlyph.cluster] == '\n')
-            {
-                continue;
+                addGlyphRenderGeometry(textGeometryBatches, image, imgRenderSettings,
+                    clip_rect, currentlayerColour);
             }
 
-            const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint);
-            if (glyph == nullptr)
+            penPosition.x += shapedGlyph.d_advance;
+
+            if (shapedGlyph.d_isSpace)
             {
-                if (codePoint != UnicodeReplacementCharacter)
-                {
-                    glyph = getPreparedGlyph(UnicodeReplacementCharacter);
-                }
-
-                if (glyph == nullptr)
-                {
-                    continue;
-                }
+                // TODO: This is for justified text and probably wrong because the space was determined
+                // without considering kerning
+                penPosition.x += space_extra;
             }
+        }
+    }
 
-            const Image* const image = glyph->getImage(layer);
-            if (image) {
-                imgRenderSettings.d_destArea =
-                    Rectf(penPosition, image->getRenderedSize());
+    return std::move(textGeometryBatches.d_buffers);
+}
 
-                penPosition.x = std::round(penPosition.x);
+//----------------------------------------------------------------------------//
+void FreeTypeFont::shapeUsingRaqm(const String& text,
+    DefaultParagraphDirection defaultParagraphDir, ShapedRun& run) const
+{
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
+    std::u32string utf32Text = String::convertUtf8ToUtf32(text.c_str());
+    size_t origTextLength = utf32Text.length();
+    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(utf32Text.c_str());
+#elif (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) 
+    size_t origTextLength = text.length();
+    const uint32_t* originalTextArray = reinterpret_cast<const std::uint32_t*>(text.c_str());
+#endif
 
-                //The glyph pos will be rounded to full pixels internally
-                glm::vec2 renderGlyphPos(
-                    penPosition.x + currentGlyph.x_offset * s_conversionMultCoeff,
-                    penPosition.y + currentGlyph.y_offset * s_conversionMultCoeff);
+    raqm_t* raqmObject = createAndSetupRaqmTextObject(
+        originalTextArray, origTextLength, defaultParagraphDir, getFontFace());
 
-                imgRenderSettings.d_destArea =
-                    Rectf(renderGlyphPos, image->getRenderedSize());
+    size_t count = 0;
+    raqm_glyph_t* glyphs = raqm_get_glyphs(raqmObject, &count);
+    run.d_glyphs.reserve(count);
 
-                const CEGUI::ColourRect fallbackColour;
-                const CEGUI::ColourRect& currentlayerColour = (layer < layerColours.size()) ?
-                    layerColours[layer] : fallbackColour;
+    for (size_t i = 0; i < count; i++)
+    {
+        raqm_glyph_t& currentGlyph = glyphs[i];
 
-                addGlyphRenderGeometry(textGeometryBuffers, image, imgRenderSettings,
-                    clip_rect, currentlayerColour);
-            }
+        char32_t codePoint;
+        auto foundCodePointIter = d_indexToGlyphMap.find(currentGlyph.index);
+        if (foundCodePointIter != d_indexToGlyphMap.end())
+        {
+            codePoint = foundCodePointIter->second;
+        }
+        else
+        {
+            codePoint = UnicodeReplacementCharacter;
+        }
 
-            penPosition.x += currentGlyph.x_advance * s_conversionMultCoeff;
+        // Ignore new line characters
+        if (originalTextArray[currentGlyph.cluster] == '\n')
+        {
+            continue;
+        }
 
-            if (codePoint == ' ')
+        const FreeTypeFontGlyph* glyph = getPreparedGlyph(codePoint);
+        if (glyph == nullptr)
+        {
+            if (codePoint != UnicodeReplacementCharacter)
             {
-                // TODO: This is for justified text and probably wrong because the space was determined
-                // without considering kerning
-                penPosition.x += space_extra;
+                glyph = getPreparedGlyph(UnicodeReplacementCharacter);
+            }
+
+            if (glyph == nullptr)
+            {
+                continue;
             }
         }
 
-        raqm_destroy(raqmObject);
+        const ShapedGlyph shapedGlyph = { glyph, 0.0f,
+            glm::vec2(currentGlyph.x_offset * s_conversionMultCoeff,
+                      currentGlyph.y_offset * s_conversionMultCoeff),
+            currentGlyph.x_advance * s_conversionMultCoeff, codePoint == ' ' };
+        run.d_glyphs.push_back(shapedGlyph);
     }
 
-    return textGeometryBuffers;
+    raqm_destroy(raqmObject);
 }
 #endif
 
@@ -1211,16 +1149,49 @@ FreeTypeFontGlyph* FreeTypeFont::getGlyphForCodepoint(const char32_t codepoint)
     return nullptr;
 }
 
+//----------------------------------------------------------------------------//
+int FreeTypeFont::getGlyphAtlasPageSize() const
+{
+    return d_glyphAtlasPageSize;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setGlyphAtlasPageSize(int size)
+{
+    d_glyphAtlasPageSize = size;
+}
+
+//----------------------------------------------------------------------------//
 int FreeTypeFont::getInitialGlyphAtlasSize() const
 {
-    return d_initialGlyphAtlasSize;
+    return getGlyphAtlasPageSize();
 }
 
+//----------------------------------------------------------------------------//
 void FreeTypeFont::setInitialGlyphAtlasSize(int val)
 {
-    d_initialGlyphAtlasSize = val;
+    setGlyphAtlasPageSize(val);
 }
 
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setGlyphAtlas(GlyphAtlas* atlas)
+{
+    if (atlas == d_glyphAtlas)
+        return;
+
+    free();
+    d_glyphAtlas = atlas;
+    updateFont();
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas* FreeTypeFont::getGlyphAtlas() const
+{
+    return d_glyphAtlas;
+}
+
+//----------------------------------------------------------------------------//
+
 const FreeTypeFontGlyph* FreeTypeFont::getPreparedGlyph(char32_t currentCodePoint) const
 {
     FreeTypeFontGlyph* glyph = getGlyphForCodepoint(currentCodePoint);
@@ -32,6 +32,7 @@
 #include "CEGUI/Window.h"
 #include "CEGUI/widgets/Tooltip.h"
 #include "CEGUI/SimpleTimer.h"
+#include "CEGUI/System.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -96,6 +97,12 @@ Window* GUIContext::getRootWindow() const
     return d_rootWindow;
 }
 
+//----------------------------------------------------------------------------//
+RenderStats& GUIContext::getRenderStats() const
+{
+    return System::getSingleton().getRenderStats();
+}
+
 //----------------------------------------------------------------------------//
 void GUIContext::setRootWindow(Window* new_root)
 {
@@ -117,6 +124,8 @@ void GUIContext::setRootWindow(Window* new_root)
     if (d_rootWindow)
     {
         d_rootWindow->setGUIContext(this);
+        // the new hierarchy may carry layout deferred elsewhere
+        markLayoutDirty();
         updateRootWindowAreaRects();
     }
 
@@ -240,9 +249,40 @@ void GUIContext::markAsDirty(std::uint32_t drawModeMask)
     d_dirtyDrawModeMask |= drawModeMask;
 }
 
+//----------------------------------------------------------------------------//
+void GUIContext::setDeferredLayoutEnabled(bool enabled)
+{
+    if (d_deferredLayoutEnabled == enabled)
+        return;
+
+    flushLayout();
+    d_deferredLayoutEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::flushLayout() const
+{
+    if (!d_layoutDirty || d_flushingLayout)
+        return;
+
+    d_flushingLayout = true;
+
+    // windows attached during the pass may bring their own pending layout
+    while (d_layoutDirty && d_rootWindow)
+    {
+        d_layoutDirty = false;
+        d_rootWindow->performPendingLayout();
+    }
+
+    d_layoutDirty = false;
+    d_flushingLayout = false;
+}
+
 //----------------------------------------------------------------------------//
 void GUIContext::draw(std::uint32_t drawModeMask)
 {
+    flushLayout();
+
     // Cursor is always dirty because it must be redrawn each frame
     const bool drawCursor = (drawModeMask & DrawModeFlagMouseCursor);
     
@@ -454,6 +494,9 @@ Window* GUIContext::getTargetWindow(const glm::vec2& pt,
     if (!d_rootWindow || !d_rootWindow->isEffectiveVisible())
         return nullptr;
 
+    // hit-testing needs the current window areas
+    flushLayout();
+
     Window* dest_window = d_captureWindow;
 
     if (!dest_window)
@@ -503,6 +546,8 @@ Window* GUIContext::getInputTargetWindow() const
 //----------------------------------------------------------------------------//
 bool GUIContext::injectInputEvent(const InputEvent& event)
 {
+    flushLayout();
+
     if (event.d_eventType == InputEventType::TextInputEventType)
         return handleTextInputEvent(static_cast<const TextInputEvent&>(event));
 
@@ -527,6 +572,8 @@ bool GUIContext::injectTimePulse(float timeElapsed)
     if (!d_rootWindow || !d_rootWindow->isEffectiveVisible())
         return false;
 
+    flushLayout();
+
     // ensure window containing cursor is now valid
     getWindowContainingCursor();
 
@@ -33,11 +33,27 @@
 
 #include <vector>
 #include <algorithm>
-#include <iterator>
+#include <cstring>
 #include <stddef.h>
 
 namespace CEGUI
 {
+//---------------------------------------------------------------------------//
+// The vertex structs are written directly into the vertex data, so their
+// memory layout has to match the default vertex layouts exactly
+static const std::size_t TexturedVertexElementCount = 9;
+static const std::size_t ColouredVertexElementCount = 7;
+
+static_assert(sizeof(TexturedColouredVertex) == TexturedVertexElementCount * sizeof(float),
+              "TexturedColouredVertex must be tightly packed");
+static_assert(offsetof(TexturedColouredVertex, d_colour) == 3 * sizeof(float) &&
+              offsetof(TexturedColouredVertex, d_texCoords) == 7 * sizeof(float),
+              "TexturedColouredVertex must match the default vertex layout");
+static_assert(sizeof(ColouredVertex) == ColouredVertexElementCount * sizeof(float),
+              "ColouredVertex must be tightly packed");
+static_assert(offsetof(ColouredVertex, d_colour) == 3 * sizeof(float),
+              "ColouredVertex must match the default vertex layout");
+
 //---------------------------------------------------------------------------//
 GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
     d_renderMaterial(renderMaterial),
@@ -89,32 +105,15 @@ void GeometryBuffer::appendGeometry(const std::vector<ColouredVertex>& coloured_
 void GeometryBuffer::appendGeometry(const ColouredVertex* vertex_array,
                                     std::size_t vertex_count)
 {
-    // Create a temporary array to contain our data
-    static const std::size_t vertexDataSize = 7;
-    std::size_t fullArraySize = vertexDataSize * vertex_count;
-    float* vertexData = new float[fullArraySize];
-
-    // Add the vertex data in their default order into an array
-    const ColouredVertex* vs = vertex_array;
-    for (std::size_t i = 0; i < vertex_count; ++i, ++vs)
-    {
-        // Add all the elements in the default order for textured and coloured
-        // geometry into the vector
-        std::size_t currentIndex = i * vertexDataSize;
-
-        vertexData[currentIndex + 0] = vs->d_position.x;
-        vertexData[currentIndex + 1] = vs->d_position.y;
-        vertexData[currentIndex + 2] = vs->d_position.z;
-        vertexData[currentIndex + 3] = vs->d_colour.x;
-        vertexData[currentIndex + 4] = vs->d_colour.y;
-        vertexData[currentIndex + 5] = vs->d_colour.z;
-        vertexData[currentIndex + 6] = vs->d_colour.w;
-    }
+    if (vertex_count == 0)
+        return;
 
-    // Append the prepared geometry data
-    appendGeometry(vertexData, fullArraySize);
+    // The vertex struct matches the default vertex layout of coloured
+    // geometry, so it can be copied into our storage in one go
+    std::memcpy(beginAppendColouredGeometry(vertex_count), vertex_array,
+                vertex_count * sizeof(ColouredVertex));
 
-    delete[] vertexData;
+    endAppendGeometry();
 }
 
 //---------------------------------------------------------------------------//
@@ -130,83 +129,83 @@ void GeometryBuffer::appendGeometry(const std::vector<TexturedColouredVertex>& t
 void GeometryBuffer::appendGeometry(const TexturedColouredVertex* vertex_array,
                                     std::size_t vertex_count)
 {
-    // Create a temporary array to contain our data
-    static const std::size_t vertexDataSize = 9;
-    std::size_t fullArraySize = vertexDataSize * vertex_count;
-    float* vertexData = new float[fullArraySize];
-
-    // Add the vertex data in their default order into an array
-    const TexturedColouredVertex* vs = vertex_array;
-    for (std::size_t i = 0; i < vertex_count; ++i, ++vs)
-    {
-        // Add all the elements in the default order for textured and coloured
-        // geometry into the vector
-        std::size_t currentIndex = i * vertexDataSize;
-        
-        vertexData[currentIndex + 0] = vs->d_position.x;
-        vertexData[currentIndex + 1] = vs->d_position.y;
-        vertexData[currentIndex + 2] = vs->d_position.z;
-        vertexData[currentIndex + 3] = vs->d_colour.x;
-        vertexData[currentIndex + 4] = vs->d_colour.y;
-        vertexData[currentIndex + 5] = vs->d_colour.z;
-        vertexData[currentIndex + 6] = vs->d_colour.w;
-        vertexData[currentIndex + 7] = vs->d_texCoords.x;
-        vertexData[currentIndex + 8] = vs->d_texCoords.y;
-    }
+    if (vertex_count == 0)
+        return;
 
-    // Append the prepared geometry data
-    appendGeometry(vertexData, fullArraySize);
+    // The vertex struct matches the default vertex layout of textured and
+    // coloured geometry, so it can be copied into our storage in one go
+    std::memcpy(beginAppendTexturedGeometry(vertex_count), vertex_array,
+                vertex_count * sizeof(TexturedColouredVertex));
 
-    delete[] vertexData;
+    endAppendGeometry();
 }
 
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendGeometry(const float* vertex_data,
                                     std::size_t array_size)
 {
-    d_vertexData.reserve(d_vertexData.size() + array_size);
-    std::copy(vertex_data, vertex_data + array_size, std::back_inserter(d_vertexData));
+    if (array_size == 0)
+        return;
 
-    // Update size of geometry buffer
-    d_vertexCount = d_vertexData.size() / getVertexAttributeElementCount();
+    std::memcpy(growVertexData(array_size), vertex_data,
+                array_size * sizeof(float));
+
+    endAppendGeometry();
 }
 
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendVertex(const TexturedColouredVertex& vertex)
 {
-    // Add the vertex data in their default order into an array
-    float vertexData[9];
+    *beginAppendTexturedGeometry(1) = vertex;
+    endAppendGeometry();
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendVertex(const ColouredVertex& vertex)
+{
+    *beginAppendColouredGeometry(1) = vertex;
+    endAppendGeometry();
+}
 
-    // Copy the vertex attributes into the array
-    vertexData[0] = vertex.d_position.x;
-    vertexData[1] = vertex.d_position.y;
-    vertexData[2] = vertex.d_position.z;
-    vertexData[3] = vertex.d_colour.x;
-    vertexData[4] = vertex.d_colour.y;
-    vertexData[5] = vertex.d_colour.z;
-    vertexData[6] = vertex.d_colour.w;
-    vertexData[7] = vertex.d_texCoords.x;
-    vertexData[8] = vertex.d_texCoords.y;
+//---------------------------------------------------------------------------//
+TexturedColouredVertex* GeometryBuffer::beginAppendTexturedGeometry(
+    std::size_t vertex_count)
+{
+    return reinterpret_cast<TexturedColouredVertex*>(
+        growVertexData(vertex_count * TexturedVertexElementCount));
+}
 
-    appendGeometry(vertexData, 9);
+//---------------------------------------------------------------------------//
+ColouredVertex* GeometryBuffer::beginAppendColouredGeometry(
+    std::size_t vertex_count)
+{
+    return reinterpret_cast<ColouredVertex*>(
+        growVertexData(vertex_count * ColouredVertexElementCount));
 }
 
 //---------------------------------------------------------------------------//
-void GeometryBuffer::appendVertex(const ColouredVertex& vertex)
+void GeometryBuffer::endAppendGeometry()
+{
+    // Update size of geometry buffer
+    d_vertexCount = d_vertexData.size() / getVertexAttributeElementCount();
+
+    onGeometryAppended();
+}
+
+//---------------------------------------------------------------------------//
+float* GeometryBuffer::growVertexData(std::size_t element_count)
 {
-    // Add the vertex data in their default order into an array
-    float vertexData[7];
+    // resize() grows the capacity geometrically, unlike an exact reserve()
+    // which would reallocate on every single appended vertex
+    const std::size_t offset = d_vertexData.size();
+    d_vertexData.resize(offset + element_count);
 
-    // Copy the vertex attributes into the array
-    vertexData[0] = vertex.d_position.x;
-    vertexData[1] = vertex.d_position.y;
-    vertexData[2] = vertex.d_position.z;
-    vertexData[3] = vertex.d_colour.x;
-    vertexData[4] = vertex.d_colour.y;
-    vertexData[5] = vertex.d_colour.z;
-    vertexData[6] = vertex.d_colour.w;
+    return d_vertexData.data() + offset;
+}
 
-    appendGeometry(vertexData, 7);
+//---------------------------------------------------------------------------//
+void GeometryBuffer::onGeometryAppended()
+{
 }
 
 //---------------------------------------------------------------------------//
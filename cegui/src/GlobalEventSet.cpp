@@ -26,7 +26,6 @@
  ***************************************************************************/
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/Logger.h"
-#include "CEGUI/SharedStringStream.h"
 
 
 // Start of CEGUI namespace section
@@ -43,7 +42,7 @@ namespace CEGUI
 	*************************************************************************/
 	GlobalEventSet::GlobalEventSet()
 	{
-        String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+        String addressStr = Logger::addressToString(this);
 
 		Logger::getSingleton().logEvent(
           "CEGUI::GlobalEventSet Singleton created. (" + addressStr + ")");
@@ -54,7 +53,7 @@ namespace CEGUI
 	*************************************************************************/
 	GlobalEventSet::~GlobalEventSet()
 	{
-        String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+        String addressStr = Logger::addressToString(this);
 
 		Logger::getSingleton().logEvent(
           "CEGUI::GlobalEventSet singleton destroyed. (" + addressStr + ")");
@@ -93,4 +92,23 @@ namespace CEGUI
         fireEvent_impl(evt_name, args);
 	}
 
+	/*************************************************************************
+		Record the name, without namespace, of an added event.
+	*************************************************************************/
+	void GlobalEventSet::onEventAdded(Event& event)
+	{
+        const String& full_name = event.getName();
+        const String::size_type separator = full_name.rfind('/');
+
+        // events are only flagged as used, never cleared on removal, which
+        // at worst costs a lookup that finds nothing.
+        const std::uint32_t id_value = EventId(separator == String::npos ?
+            full_name : full_name.substr(separator + 1)).getValue();
+
+        if (id_value >= d_usedEventNames.size())
+            d_usedEventNames.resize(id_value + 1, false);
+
+        d_usedEventNames[id_value] = true;
+	}
+
 } // End of  CEGUI namespace section
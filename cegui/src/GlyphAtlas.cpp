@@ -0,0 +1,203 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the paged glyph texture atlas
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GlyphAtlas.h"
+#include "CEGUI/TextureAtlasAllocator.h"
+#include "CEGUI/Colour.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+GlyphAtlas::GlyphAtlas(const String& name, int page_size) :
+    d_name(name),
+    d_pageSize(page_size),
+    d_createdPageCount(0),
+    d_pixelFormat(Texture::PixelFormat::Rgba)
+{
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas::~GlyphAtlas()
+{
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+Texture& GlyphAtlas::allocate(int width, int height, int& x, int& y)
+{
+    // the most recent page is the most likely to have room
+    for (size_t i = d_pages.size(); i > 0; --i)
+    {
+        if (d_pages[i - 1].d_allocator->allocate(width, height, x, y))
+            return *d_pages[i - 1].d_texture;
+    }
+
+    // glyphs larger than a page get a page of their own
+    int size = d_pageSize;
+    while (size < width || size < height)
+        size *= 2;
+
+    const int max_size = static_cast<int>(
+        System::getSingleton().getRenderer()->getMaxTextureSize());
+    if (size > max_size)
+    {
+        if (width > max_size || height > max_size)
+            throw InvalidRequestException("Can not add an area that is larger "
+                "than the maximum supported texture size to the glyph atlas.");
+
+        size = max_size;
+    }
+
+    Page& page = addPage(size);
+    if (!page.d_allocator->allocate(width, height, x, y))
+        throw InvalidRequestException(
+            "The area could not be placed into an empty glyph atlas page.");
+
+    return *page.d_texture;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::clear()
+{
+    Renderer* renderer = System::getSingleton().getRenderer();
+
+    for (size_t i = 0; i < d_pages.size(); ++i)
+    {
+        renderer->destroyTexture(*d_pages[i].d_texture);
+        delete d_pages[i].d_allocator;
+    }
+
+    d_pages.clear();
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::blitCoverage(Texture& page, const std::uint8_t* coverage,
+                              const Rectf& area) const
+{
+    if (d_pixelFormat == Texture::PixelFormat::Alpha)
+    {
+        page.blitFromMemory(coverage, area);
+        return;
+    }
+
+    const size_t pixel_count = static_cast<size_t>(area.getWidth()) *
+        static_cast<size_t>(area.getHeight());
+
+    std::vector<argb_t> pixels(pixel_count);
+    for (size_t i = 0; i < pixel_count; ++i)
+        pixels[i] = Colour::calculateArgb(coverage[i], 0xFF, 0xFF, 0xFF);
+
+    page.blitFromMemory(pixels.data(), area);
+}
+
+//----------------------------------------------------------------------------//
+Texture& GlyphAtlas::getPageTexture(size_t index) const
+{
+    if (index >= d_pages.size())
+        throw InvalidRequestException("The glyph atlas page index is out of range.");
+
+    return *d_pages[index].d_texture;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::setPageSize(int page_size)
+{
+    if (page_size <= 0)
+        throw InvalidRequestException("The glyph atlas page size must be positive.");
+
+    d_pageSize = page_size;
+}
+
+//----------------------------------------------------------------------------//
+float GlyphAtlas::getOccupancy() const
+{
+    float used_area = 0.0f;
+    float total_area = 0.0f;
+
+    for (size_t i = 0; i < d_pages.size(); ++i)
+    {
+        const TextureAtlasAllocator& allocator = *d_pages[i].d_allocator;
+        const float area = static_cast<float>(allocator.getWidth()) *
+            static_cast<float>(allocator.getHeight());
+
+        used_area += allocator.getOccupancy() * area;
+        total_area += area;
+    }
+
+    return total_area > 0.0f ? used_area / total_area : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+TextureAtlasAllocator* GlyphAtlas::createAllocator(int width, int height) const
+{
+    return new SkylineTextureAtlasAllocator(width, height);
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas::Page& GlyphAtlas::addPage(int size)
+{
+    const String texture_name(d_name + "_" +
+        PropertyHelper<std::uint32_t>::toString(d_createdPageCount++));
+
+    const Sizef texture_size(static_cast<float>(size), static_cast<float>(size));
+    Texture& texture = System::getSingleton().getRenderer()->createTexture(
+        texture_name, texture_size);
+
+    // all pages share one format, so that blitCoverage does not depend on
+    // which page a glyph ended up in.
+    if (d_pages.empty())
+        d_pixelFormat = texture.isPixelFormatSupported(Texture::PixelFormat::Alpha) ?
+            Texture::PixelFormat::Alpha : Texture::PixelFormat::Rgba;
+
+    // start from a blank page so that filtering at the glyph borders only
+    // ever samples transparent pixels.
+    const size_t pixel_count = static_cast<size_t>(size) * size;
+    if (d_pixelFormat == Texture::PixelFormat::Alpha)
+    {
+        const std::vector<std::uint8_t> blank(pixel_count, 0);
+        texture.loadFromMemory(blank.data(), texture_size, d_pixelFormat);
+    }
+    else
+    {
+        const std::vector<argb_t> blank(pixel_count, 0);
+        texture.loadFromMemory(blank.data(), texture_size, d_pixelFormat);
+    }
+
+    const Page page = { &texture, createAllocator(size, size) };
+    d_pages.push_back(page);
+
+    return d_pages.back();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
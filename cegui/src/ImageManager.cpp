@@ -27,7 +27,6 @@
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Exceptions.h"
-#include "CEGUI/SharedStringStream.h"
 
 // for the XML parsing part.
 #include "CEGUI/XMLParser.h"
@@ -105,7 +104,7 @@ static Sizef s_nativeResolution(640.0f, 480.0f);
 //----------------------------------------------------------------------------//
 ImageManager::ImageManager()
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::ImageManager Singleton created. (" + addressStr + ")");
@@ -124,7 +123,7 @@ ImageManager::~ImageManager()
     while (!d_factories.empty())
         removeImageType(d_factories.begin()->first);
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
        "CEGUI::ImageManager Singleton destroyed (" + addressStr + ")");
@@ -168,7 +167,7 @@ Image& ImageManager::create(const String& type, const String& name)
     Image& image = factory->create(name);
     d_images[name] = std::make_pair(&image, factory);
 
-        String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
+        String addressStr = Logger::addressToString(&image);
 
     Logger::getSingleton().logEvent(
         "[ImageManager] Created image: '" + name + "' (" + addressStr + 
@@ -214,7 +213,7 @@ Image& ImageManager::create(const XMLAttributes& attributes)
 
     d_images[name] = std::make_pair(&image, factory);
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
+    String addressStr = Logger::addressToString(&image);
     Logger::getSingleton().logEvent(
         "[ImageManager] Created image: '" + name + "' (" + addressStr + 
         ") of type: " + s_imagesetType);
@@ -69,8 +69,8 @@ struct MouseClickTracker
         d_click_area(0, 0, 0, 0)
     {}
 
-    //! Timer used to track clicks for this button.
-    SimpleTimer d_timer;
+    //! Time of the last down event of this button.
+    SimpleTimer::timePoint d_downTime;
     //! count of clicks made so far.
     int d_click_count;
     //! area used to detect multi-clicks
@@ -87,6 +87,8 @@ const String InputAggregator::EventMouseMoveScalingFactorChanged("MouseMoveScali
 const float InputAggregator::DefaultMouseButtonClickTimeout = 0.0f;
 const float InputAggregator::DefaultMouseButtonMultiClickTimeout = 0.3333f;
 const Sizef InputAggregator::DefaultMouseButtonMultiClickTolerance(0.01f, 0.01f);
+// a power of two, so that the ring buffer indices can be masked
+const size_t InputAggregator::InputQueueCapacity = 1024;
 
 //----------------------------------------------------------------------------//
 InputAggregator::InputAggregator(InputEventReceiver* input_receiver) :
@@ -102,7 +104,12 @@ InputAggregator::InputAggregator(InputEventReceiver* input_receiver) :
     d_handleInKeyUp(true),
     d_mouseMovementScalingFactor(1.0f),
     d_pointerPosition(0.0f, 0.0f),
-    d_keysPressed()
+    d_keysPressed(),
+    d_inputQueueingEnabled(false),
+    d_inputQueueHead(0),
+    d_inputQueueTail(0),
+    d_processingQueuedInput(false),
+    d_translatingQueuedInput(false)
 {
     // Initialise the array
     std::fill(std::begin(d_keyValuesMappings), std::end(d_keyValuesMappings), SemanticValue::NoValue);
@@ -291,7 +298,7 @@ bool InputAggregator::handleScanCode(Key::Scan scan_code, bool shift_down,
     if (value != SemanticValue::NoValue)
     {
         SemanticInputEvent semantic_event(value);
-        return d_inputReceiver->injectInputEvent(semantic_event);
+        return dispatchInputEvent(semantic_event);
     }
 
     return false;
@@ -304,6 +311,13 @@ void InputAggregator::onMouseMoveScalingFactorChanged(InputAggregatorEventArgs&
 
 bool InputAggregator::injectMouseMove(float delta_x, float delta_y)
 {
+    if (d_inputReceiver == nullptr)
+        return false;
+
+    // the pointer position is only known once the earlier input is translated
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseMove, delta_x, delta_y);
+
     return injectMousePosition(
         delta_x + d_pointerPosition.x * d_mouseMovementScalingFactor,
         delta_y + d_pointerPosition.y * d_mouseMovementScalingFactor);
@@ -314,13 +328,16 @@ bool InputAggregator::injectMousePosition(float x_pos, float y_pos)
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MousePosition, x_pos, y_pos);
+
     d_pointerPosition = glm::vec2(x_pos, y_pos);
 
     SemanticInputEvent semantic_event(SemanticValue::CursorMove);
     semantic_event.d_payload.array[0] = x_pos;
     semantic_event.d_payload.array[1] = y_pos;
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectMouseLeaves()
@@ -328,9 +345,12 @@ bool InputAggregator::injectMouseLeaves()
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseLeaves);
+
     SemanticInputEvent semantic_event(SemanticValue::PointerLeave);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectMouseButtonDown(MouseButton button)
@@ -338,16 +358,22 @@ bool InputAggregator::injectMouseButtonDown(MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseButtonDown, 0.0f, 0.0f,
+                          static_cast<std::uint32_t>(button));
+
     //
     // Handling for multi-click generation
     //
     MouseClickTracker& tkr = d_mouseClickTrackers[static_cast<int>(button)];
+    const SimpleTimer::timePoint down_time = getInputTime();
+    const std::chrono::duration<double> elapsed = down_time - tkr.d_downTime;
 
     tkr.d_click_count++;
 
     // TODO: re-add the check for different windows?
     // if multi-click requirements are not met
-    if (((d_mouseButtonMultiClickTimeout > 0) && (tkr.d_timer.elapsedTime() > d_mouseButtonMultiClickTimeout)) ||
+    if (((d_mouseButtonMultiClickTimeout > 0) && (elapsed.count() > d_mouseButtonMultiClickTimeout)) ||
         (!tkr.d_click_area.isPointInRectf(d_pointerPosition)) ||
         (tkr.d_click_count > 3))
     {
@@ -363,7 +389,7 @@ bool InputAggregator::injectMouseButtonDown(MouseButton button)
     }
 
     // reset timer for this tracker.
-    tkr.d_timer.restart();
+    tkr.d_downTime = down_time;
 
     if (d_generateMouseClickEvents)
     {
@@ -386,23 +412,31 @@ bool InputAggregator::injectMouseButtonDown(MouseButton button)
     SemanticInputEvent semantic_event(value);
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 bool InputAggregator::injectMouseButtonUp(MouseButton button)
 {
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseButtonUp, 0.0f, 0.0f,
+                          static_cast<std::uint32_t>(button));
+
     SemanticInputEvent semantic_event(SemanticValue::CursorActivate);
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectKeyDown(Key::Scan scan_code)
 {
     if (d_inputReceiver == nullptr)
         return false;
+
+    if (isInputQueued())
+        return queueInput(QueuedInputType::KeyDown, 0.0f, 0.0f,
+                          static_cast<std::uint32_t>(scan_code));
     
     d_keysPressed[static_cast<unsigned char>(scan_code)] = true;
 
@@ -417,6 +451,10 @@ bool InputAggregator::injectKeyUp(Key::Scan scan_code)
 {
     if (d_inputReceiver == nullptr)
         return false;
+
+    if (isInputQueued())
+        return queueInput(QueuedInputType::KeyUp, 0.0f, 0.0f,
+                          static_cast<std::uint32_t>(scan_code));
     
     d_keysPressed[static_cast<unsigned char>(scan_code)] = false;
 
@@ -432,10 +470,13 @@ bool InputAggregator::injectChar(char32_t code_point)
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::Char, 0.0f, 0.0f, code_point);
+
     TextInputEvent text_event;
     text_event.d_character = code_point;
 
-    return d_inputReceiver->injectInputEvent(text_event);
+    return dispatchInputEvent(text_event);
 }
 
 bool InputAggregator::injectMouseWheelChange(float delta)
@@ -443,10 +484,13 @@ bool InputAggregator::injectMouseWheelChange(float delta)
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseWheelChange, delta);
+
     SemanticInputEvent semantic_event(SemanticValue::VerticalScroll);
     semantic_event.d_payload.single = delta;
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectMouseButtonClick(const MouseButton button)
@@ -454,6 +498,10 @@ bool InputAggregator::injectMouseButtonClick(const MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseButtonClick, 0.0f, 0.0f,
+                          static_cast<std::uint32_t>(button));
+
     SemanticInputEvent semantic_event(SemanticValue::CursorActivate);
 
     if (isControlPressed())
@@ -461,7 +509,7 @@ bool InputAggregator::injectMouseButtonClick(const MouseButton button)
 
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectMouseButtonDoubleClick(const MouseButton button)
@@ -469,10 +517,14 @@ bool InputAggregator::injectMouseButtonDoubleClick(const MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseButtonDoubleClick, 0.0f, 0.0f,
+                          static_cast<std::uint32_t>(button));
+
     SemanticInputEvent semantic_event(SemanticValue::SelectWord);
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectMouseButtonTripleClick(const MouseButton button)
@@ -480,10 +532,14 @@ bool InputAggregator::injectMouseButtonTripleClick(const MouseButton button)
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::MouseButtonTripleClick, 0.0f, 0.0f,
+                          static_cast<std::uint32_t>(button));
+
     SemanticInputEvent semantic_event(SemanticValue::SelectAll);
     semantic_event.d_payload.source = convertToCursorInputSource(button);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectCopyRequest()
@@ -491,9 +547,12 @@ bool InputAggregator::injectCopyRequest()
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::CopyRequest);
+
     SemanticInputEvent semantic_event(SemanticValue::Copy);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectCutRequest()
@@ -501,9 +560,12 @@ bool InputAggregator::injectCutRequest()
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::CutRequest);
+
     SemanticInputEvent semantic_event(SemanticValue::Cut);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 bool InputAggregator::injectPasteRequest()
@@ -511,9 +573,12 @@ bool InputAggregator::injectPasteRequest()
     if (d_inputReceiver == nullptr)
         return false;
 
+    if (isInputQueued())
+        return queueInput(QueuedInputType::PasteRequest);
+
     SemanticInputEvent semantic_event(SemanticValue::Paste);
 
-    return d_inputReceiver->injectInputEvent(semantic_event);
+    return dispatchInputEvent(semantic_event);
 }
 
 void InputAggregator::initialise(bool handle_on_keyup /*= true*/)
@@ -584,6 +649,221 @@ bool InputAggregator::onDisplaySizeChanged(const EventArgs&)
     return true;
 }
 
+//----------------------------------------------------------------------------//
+void InputAggregator::setInputQueueingEnabled(bool enabled)
+{
+    if (d_inputQueueingEnabled == enabled)
+        return;
+
+    if (enabled)
+    {
+        d_inputQueueConsumer = std::this_thread::get_id();
+        d_inputQueue.resize(InputQueueCapacity);
+        d_inputQueueingEnabled = true;
+    }
+    else
+    {
+        // the injecting thread has stopped, so nothing writes to the ring buffer
+        processQueuedInput();
+        d_inputQueueingEnabled = false;
+
+        // what the handlers injected while the queue was processed
+        std::vector<QueuedInput> remaining;
+        remaining.swap(d_guiThreadInput);
+        translateQueuedInput(remaining);
+
+        d_inputQueue.clear();
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool InputAggregator::dispatchInputEvent(const InputEvent& event)
+{
+    // the input injected by the handlers is queued, not translated in the
+    // middle of this one
+    const bool translating = d_translatingQueuedInput;
+    d_translatingQueuedInput = false;
+    const bool handled = d_inputReceiver->injectInputEvent(event);
+    d_translatingQueuedInput = translating;
+
+    return handled;
+}
+
+//----------------------------------------------------------------------------//
+bool InputAggregator::isInputQueued() const
+{
+    if (!d_inputQueueingEnabled)
+        return false;
+
+    // only the GUI thread may look at the translation state
+    return std::this_thread::get_id() != d_inputQueueConsumer ||
+        !d_translatingQueuedInput;
+}
+
+//----------------------------------------------------------------------------//
+bool InputAggregator::queueInput(QueuedInputType type, float x, float y,
+                                 std::uint32_t code)
+{
+    const QueuedInput input = { type, x, y, code, std::chrono::steady_clock::now() };
+
+    if (std::this_thread::get_id() == d_inputQueueConsumer)
+    {
+        d_guiThreadInput.push_back(input);
+        return true;
+    }
+
+    const size_t tail = d_inputQueueTail.load(std::memory_order_relaxed);
+    if (tail - d_inputQueueHead.load(std::memory_order_acquire) >= InputQueueCapacity)
+        return false;
+
+    d_inputQueue[tail & (InputQueueCapacity - 1)] = input;
+
+    // publish the input to processQueuedInput
+    d_inputQueueTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+SimpleTimer::timePoint InputAggregator::getInputTime() const
+{
+    return d_translatingQueuedInput ? d_queuedInputTime :
+        std::chrono::steady_clock::now();
+}
+
+//----------------------------------------------------------------------------//
+size_t InputAggregator::processQueuedInput()
+{
+    if (!d_inputQueueingEnabled || d_processingQueuedInput)
+        return 0;
+
+    d_processingQueuedInput = true;
+
+    // the input of the GUI thread first, then that of the injecting thread
+    d_translatedInput.swap(d_guiThreadInput);
+
+    const size_t mask = InputQueueCapacity - 1;
+    size_t head = d_inputQueueHead.load(std::memory_order_relaxed);
+    const size_t tail = d_inputQueueTail.load(std::memory_order_acquire);
+
+    for (; head != tail; ++head)
+        d_translatedInput.push_back(d_inputQueue[head & mask]);
+
+    // free the ring buffer before translating, which runs the handlers
+    d_inputQueueHead.store(head, std::memory_order_release);
+
+    const size_t translated = translateQueuedInput(d_translatedInput);
+
+    d_translatedInput.clear();
+    d_processingQueuedInput = false;
+
+    return translated;
+}
+
+//----------------------------------------------------------------------------//
+size_t InputAggregator::translateQueuedInput(const std::vector<QueuedInput>& inputs)
+{
+    const auto isCursorMove = [](QueuedInputType type)
+    {
+        return type == QueuedInputType::MousePosition ||
+            type == QueuedInputType::MouseMove;
+    };
+
+    size_t translated = 0;
+    size_t i = 0;
+
+    while (i < inputs.size())
+    {
+        const QueuedInput& input = inputs[i];
+        const MouseButton button = static_cast<MouseButton>(input.d_code);
+        const Key::Scan scan_code = static_cast<Key::Scan>(input.d_code);
+
+        d_queuedInputTime = input.d_time;
+        d_translatingQueuedInput = true;
+
+        if (isCursorMove(input.d_type))
+        {
+            // only the final position of a run of moves is passed on
+            glm::vec2 position(d_pointerPosition);
+            do
+            {
+                const QueuedInput& move = inputs[i];
+                if (move.d_type == QueuedInputType::MousePosition)
+                    position = glm::vec2(move.d_x, move.d_y);
+                else
+                    position = glm::vec2(
+                        move.d_x + position.x * d_mouseMovementScalingFactor,
+                        move.d_y + position.y * d_mouseMovementScalingFactor);
+            }
+            while (++i < inputs.size() && isCursorMove(inputs[i].d_type));
+
+            injectMousePosition(position.x, position.y);
+        }
+        else if (input.d_type == QueuedInputType::MouseWheelChange)
+        {
+            float delta = 0.0f;
+            do
+            {
+                delta += inputs[i].d_x;
+            }
+            while (++i < inputs.size() &&
+                   inputs[i].d_type == QueuedInputType::MouseWheelChange);
+
+            injectMouseWheelChange(delta);
+        }
+        else
+        {
+            ++i;
+
+            switch (input.d_type)
+            {
+            case QueuedInputType::MouseLeaves:
+                injectMouseLeaves();
+                break;
+            case QueuedInputType::MouseButtonDown:
+                injectMouseButtonDown(button);
+                break;
+            case QueuedInputType::MouseButtonUp:
+                injectMouseButtonUp(button);
+                break;
+            case QueuedInputType::MouseButtonClick:
+                injectMouseButtonClick(button);
+                break;
+            case QueuedInputType::MouseButtonDoubleClick:
+                injectMouseButtonDoubleClick(button);
+                break;
+            case QueuedInputType::MouseButtonTripleClick:
+                injectMouseButtonTripleClick(button);
+                break;
+            case QueuedInputType::KeyDown:
+                injectKeyDown(scan_code);
+                break;
+            case QueuedInputType::KeyUp:
+                injectKeyUp(scan_code);
+                break;
+            case QueuedInputType::Char:
+                injectChar(static_cast<char32_t>(input.d_code));
+                break;
+            case QueuedInputType::CopyRequest:
+                injectCopyRequest();
+                break;
+            case QueuedInputType::CutRequest:
+                injectCutRequest();
+                break;
+            case QueuedInputType::PasteRequest:
+                injectPasteRequest();
+                break;
+            default:
+                break;
+            }
+        }
+
+        d_translatingQueuedInput = false;
+        ++translated;
+    }
+
+    return translated;
+}
+
 #if defined (_MSC_VER)
 #   pragma warning(pop)
 #endif
@@ -96,6 +96,9 @@ float KeyFrame::getPosition() const
 void KeyFrame::setValue(const String& value)
 {
     d_value = value;
+
+    if (d_parent)
+        d_parent->notifyKeyFrameValueChanged();
 }
 
 //----------------------------------------------------------------------------//
@@ -108,6 +111,9 @@ const String& KeyFrame::getValue() const
 void KeyFrame::setSourceProperty(const String& sourceProperty)
 {
     d_sourceProperty = sourceProperty;
+
+    if (d_parent)
+        d_parent->notifyKeyFrameValueChanged();
 }
 
 //----------------------------------------------------------------------------//
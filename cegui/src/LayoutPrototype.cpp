@@ -0,0 +1,443 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the parsed layout windows are created from
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/LayoutPrototype.h"
+#include "CEGUI/GUILayout_xmlHandler.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+//! A window of the prototype and what the layout sets on it, in order.
+struct LayoutPrototype::WindowNode
+{
+    enum class EntryType
+    {
+        Property,
+        UserString,
+        Event,
+        Child
+    };
+
+    struct Entry
+    {
+        EntryType d_type;
+        String d_name;
+        String d_value;
+        //! the node of the child window, for EntryType::Child.
+        WindowNode* d_child;
+        //! the property d_preparedValue was prepared by.
+        mutable Property* d_preparedProperty;
+        //! the WidgetLookManager revision d_preparedProperty was valid for.
+        mutable std::uint32_t d_lookRevision;
+        mutable PreparedPropertyValue* d_preparedValue;
+    };
+
+    WindowNode(const String& type, const String& name, bool auto_window) :
+        d_type(type),
+        d_name(name),
+        d_isAutoWindow(auto_window)
+    {}
+
+    ~WindowNode()
+    {
+        for (Entry& entry : d_entries)
+        {
+            delete entry.d_child;
+            delete entry.d_preparedValue;
+        }
+    }
+
+    void addEntry(EntryType type, const String& name, const String& value,
+                  WindowNode* child = nullptr)
+    {
+        const Entry entry = { type, name, value, child, nullptr, 0, nullptr };
+        d_entries.push_back(entry);
+    }
+
+    //! window type, unused for auto windows.
+    String d_type;
+    //! window name, or name path of an auto window.
+    String d_name;
+    bool d_isAutoWindow;
+    std::vector<Entry> d_entries;
+};
+
+//----------------------------------------------------------------------------//
+//! Handler building the prototype from a gui-layout, see GUILayout_xmlHandler.
+class LayoutPrototype::LayoutHandler : public XMLHandler
+{
+public:
+    LayoutHandler() :
+        d_root(nullptr)
+    {}
+
+    ~LayoutHandler()
+    {
+        delete d_root;
+    }
+
+    const String& getSchemaName() const override
+    {
+        return WindowManager::GUILayoutSchemaName;
+    }
+
+    const String& getDefaultResourceGroup() const override
+    {
+        return WindowManager::getSingleton().getDefaultResourceGroup();
+    }
+
+    void elementStart(const String& element,
+                      const XMLAttributes& attributes) override;
+    void elementEnd(const String& element) override;
+    void text(const String& text) override { d_stringItemValue += text; }
+
+    //! return the built tree, which the caller then owns.
+    WindowNode* releaseRoot()
+    {
+        WindowNode* root = d_root;
+        d_root = nullptr;
+        return root;
+    }
+
+private:
+    void addNode(WindowNode* node);
+    void elementItemStart(WindowNode::EntryType type, const String& name,
+                          const String& value);
+
+    WindowNode* d_root;
+    std::vector<WindowNode*> d_stack;
+    String d_stringItemName;
+    String d_stringItemValue;
+};
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::LayoutHandler::elementStart(
+    const String& element, const XMLAttributes& attributes)
+{
+    if (element == GUILayout_xmlHandler::GUILayoutElement)
+    {
+        const String version(attributes.getValueAsString(
+            GUILayout_xmlHandler::GUILayoutVersionAttribute, "unknown"));
+
+        if (version != GUILayout_xmlHandler::NativeVersion)
+            throw InvalidRequestException(
+                "You are attempting to load a layout of version '" + version +
+                "' but this CEGUI version is only meant to load layouts of "
+                "version '" + GUILayout_xmlHandler::NativeVersion + "'.");
+    }
+    else if (element == Window::WindowXMLElementName)
+    {
+        addNode(new WindowNode(
+            attributes.getValueAsString(Window::WindowTypeXMLAttributeName),
+            attributes.getValueAsString(Window::WindowNameXMLAttributeName),
+            false));
+    }
+    else if (element == Window::AutoWindowXMLElementName)
+    {
+        if (!d_stack.empty())
+            addNode(new WindowNode("", attributes.getValueAsString(
+                Window::AutoWindowNamePathXMLAttributeName), true));
+    }
+    else if (element == Window::UserStringXMLElementName)
+    {
+        elementItemStart(WindowNode::EntryType::UserString,
+            attributes.getValueAsString(Window::UserStringNameXMLAttributeName),
+            attributes.getValueAsString(Window::UserStringValueXMLAttributeName));
+    }
+    else if (element == Property::XMLElementName)
+    {
+        elementItemStart(WindowNode::EntryType::Property,
+            attributes.getValueAsString(Property::NameXMLAttributeName),
+            attributes.getValueAsString(Property::ValueXMLAttributeName));
+    }
+    else if (element == GUILayout_xmlHandler::LayoutImportElement)
+    {
+        LayoutPrototype imported;
+        imported.loadFromFile(
+            attributes.getValueAsString(
+                GUILayout_xmlHandler::LayoutImportFilenameAttribute),
+            attributes.getValueAsString(
+                GUILayout_xmlHandler::LayoutImportResourceGroupAttribute));
+
+        if (!d_stack.empty())
+        {
+            d_stack.back()->addEntry(WindowNode::EntryType::Child, "", "",
+                                     imported.d_root);
+            imported.d_root = nullptr;
+        }
+    }
+    else if (element == GUILayout_xmlHandler::EventElement)
+    {
+        if (!d_stack.empty())
+            d_stack.back()->addEntry(WindowNode::EntryType::Event,
+                attributes.getValueAsString(
+                    GUILayout_xmlHandler::EventNameAttribute),
+                attributes.getValueAsString(
+                    GUILayout_xmlHandler::EventFunctionAttribute));
+    }
+    else
+    {
+        Logger::getSingleton().logEvent("LayoutPrototype::LayoutHandler::elementStart - "
+            "Unexpected data was found while parsing the gui-layout file: '" +
+            element + "' is unknown.", LoggingLevel::Error);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::LayoutHandler::elementEnd(const String& element)
+{
+    if (element == Window::WindowXMLElementName ||
+        element == Window::AutoWindowXMLElementName)
+    {
+        if (!d_stack.empty())
+            d_stack.pop_back();
+    }
+    else if (element == Window::UserStringXMLElementName ||
+             element == Property::XMLElementName)
+    {
+        // only do something if this is a "long" item
+        if (!d_stringItemName.empty() && !d_stack.empty())
+            d_stack.back()->addEntry(
+                element == Property::XMLElementName ?
+                    WindowNode::EntryType::Property :
+                    WindowNode::EntryType::UserString,
+                d_stringItemName, d_stringItemValue);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::LayoutHandler::addNode(WindowNode* node)
+{
+    if (!d_stack.empty())
+        d_stack.back()->addEntry(WindowNode::EntryType::Child, "", "", node);
+    else if (!d_root)
+        d_root = node;
+    else
+    {
+        delete node;
+        throw InvalidRequestException(
+            "A gui-layout can only have one root window.");
+    }
+
+    d_stack.push_back(node);
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::LayoutHandler::elementItemStart(
+    WindowNode::EntryType type, const String& name, const String& value)
+{
+    // short item
+    if (!value.empty())
+    {
+        d_stringItemName.clear();
+
+        if (!d_stack.empty())
+            d_stack.back()->addEntry(type, name, value);
+    }
+    // long item, the value is the text of the element
+    else
+    {
+        d_stringItemName = name;
+        d_stringItemValue.clear();
+    }
+}
+
+//----------------------------------------------------------------------------//
+LayoutPrototype::LayoutPrototype() :
+    d_root(nullptr)
+{
+}
+
+//----------------------------------------------------------------------------//
+LayoutPrototype::~LayoutPrototype()
+{
+    delete d_root;
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::loadFromFile(const String& filename,
+                                   const String& resourceGroup)
+{
+    if (filename.empty())
+        throw InvalidRequestException(
+            "Filename supplied for gui-layout loading must be valid.");
+
+    LayoutHandler handler;
+    WindowManager& wm = WindowManager::getSingleton();
+    System::getSingleton().getXMLParser()->parseXMLFile(handler, filename,
+        WindowManager::GUILayoutSchemaName,
+        resourceGroup.empty() ? wm.getDefaultResourceGroup() : resourceGroup);
+
+    setRoot(handler.releaseRoot());
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::loadFromContainer(const RawDataContainer& source)
+{
+    LayoutHandler handler;
+    System::getSingleton().getXMLParser()->parseXML(handler, source,
+        WindowManager::GUILayoutSchemaName);
+
+    setRoot(handler.releaseRoot());
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::loadFromString(const String& source)
+{
+    LayoutHandler handler;
+    System::getSingleton().getXMLParser()->parseXMLString(handler, source,
+        WindowManager::GUILayoutSchemaName);
+
+    setRoot(handler.releaseRoot());
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::setRoot(WindowNode* root)
+{
+    delete d_root;
+    d_root = root;
+}
+
+//----------------------------------------------------------------------------//
+Window* LayoutPrototype::instantiate() const
+{
+    if (!d_root)
+        throw InvalidRequestException(
+            "No gui-layout has been loaded into the prototype.");
+
+    WindowManager& wm = WindowManager::getSingleton();
+    Window* root = nullptr;
+
+    try
+    {
+        root = wm.createWindow(d_root->d_type, d_root->d_name);
+        initialiseWindow(*d_root, *root);
+    }
+    catch (Exception& e)
+    {
+        if (root)
+            wm.destroyWindow(root);
+
+        throw InvalidRequestException(
+            String("Layout instancing has been aborted with error:\n") +
+            e.getMessage());
+    }
+
+    return root;
+}
+
+//----------------------------------------------------------------------------//
+void LayoutPrototype::initialiseWindow(const WindowNode& node,
+                                       Window& window) const
+{
+    if (!node.d_isAutoWindow)
+        window.beginInitialisation();
+
+    for (const WindowNode::Entry& entry : node.d_entries)
+    {
+        switch (entry.d_type)
+        {
+        case WindowNode::EntryType::Property:
+            try
+            {
+                Property* property = window.getPropertyInstance(entry.d_name);
+                const std::uint32_t look_revision =
+                    WidgetLookManager::getSingleton().getRevision();
+
+                // a value is only valid for the property that prepared it;
+                // a property of a replaced look may have the same address.
+                if (entry.d_preparedProperty != property ||
+                    entry.d_lookRevision != look_revision)
+                {
+                    delete entry.d_preparedValue;
+                    entry.d_preparedValue = nullptr;
+                    entry.d_preparedValue = property->prepareValue(entry.d_value);
+                    entry.d_preparedProperty = property;
+                    entry.d_lookRevision = look_revision;
+                }
+
+                entry.d_preparedValue->apply(&window);
+            }
+            catch (Exception&)
+            {
+                // Don't do anything here, but the error will have been logged.
+            }
+            break;
+
+        case WindowNode::EntryType::UserString:
+            window.setUserString(entry.d_name, entry.d_value);
+            break;
+
+        case WindowNode::EntryType::Event:
+            try
+            {
+                window.subscribeScriptedEvent(entry.d_name, entry.d_value);
+            }
+            catch (Exception&)
+            {
+                // Don't do anything here, but the error will have been logged.
+            }
+            break;
+
+        case WindowNode::EntryType::Child:
+        {
+            const WindowNode& child_node = *entry.d_child;
+            Window* child;
+
+            if (child_node.d_isAutoWindow)
+                child = window.getChildAutoWindow(child_node.d_name);
+            else
+            {
+                child = WindowManager::getSingleton().createWindow(
+                    child_node.d_type, child_node.d_name);
+                window.addChild(child);
+            }
+
+            initialiseWindow(child_node, *child);
+            break;
+        }
+        }
+    }
+
+    if (!node.d_isAutoWindow)
+        window.endInitialisation();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -28,6 +28,8 @@
  ***************************************************************************/
 #include "CEGUI/Logger.h"
 
+#include <cstdint>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -53,4 +55,24 @@ namespace CEGUI
     {
     }
 
+    /*************************************************************************
+        Return the hexadecimal representation of an address
+    *************************************************************************/
+    String Logger::addressToString(const void* address)
+    {
+        // written the way an ostream writes a pointer
+        std::uintptr_t value = reinterpret_cast<std::uintptr_t>(address);
+        if (value == 0)
+            return String("0");
+
+        char buffer[2 + 2 * sizeof(value)];
+        char* digit = buffer + sizeof(buffer);
+        for (; value != 0; value >>= 4)
+            *--digit = "0123456789abcdef"[value & 0xF];
+        *--digit = 'x';
+        *--digit = '0';
+
+        return String(digit, static_cast<String::size_type>(buffer + sizeof(buffer) - digit));
+    }
+
 } // End of  CEGUI namespace section
@@ -74,8 +74,8 @@ void NamedElement::setName(const String& name)
     }
 
     // log this under informative level
-    Logger::getSingleton().logEvent("Renamed element at: " + getNamePath() +
-                                    " as: " + name, LoggingLevel::Informative);
+    CEGUI_LOG(LoggingLevel::Informative,
+              "Renamed element at: " + getNamePath() + " as: " + name);
 
     d_name = name;
 
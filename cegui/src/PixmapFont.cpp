@@ -31,7 +31,7 @@
 #include "CEGUI/Font_xmlHandler.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Logger.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/StreamHelper.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -195,8 +195,8 @@ void PixmapFont::defineMapping(const String& value)
     float adv;
     unsigned int codePoint;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << value;
+    std::stringstream sstream;
+    prepareStream(sstream, value);
 
     sstream >> codePoint;
     if (sstream.fail())
@@ -32,6 +32,33 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+namespace
+{
+//! Prepared value of a property that can only be set from a string.
+class StringPreparedPropertyValue : public PreparedPropertyValue
+{
+public:
+    StringPreparedPropertyValue(Property& property, const String& value) :
+        d_property(property),
+        d_value(value)
+    {}
+
+    void apply(PropertyReceiver* receiver) const override
+    {
+        d_property.set(receiver, d_value);
+    }
+
+    bool isApplied(const PropertyReceiver* receiver) const override
+    {
+        return d_property.get(receiver) == d_value;
+    }
+
+private:
+    Property& d_property;
+    String d_value;
+};
+}
+
 //----------------------------------------------------------------------------//
 const String Property::XMLElementName("Property");
 const String Property::NameXMLAttributeName("name");
@@ -77,6 +104,18 @@ bool Property::isReadable() const
 	return true;
 }
 
+//----------------------------------------------------------------------------//
+PreparedPropertyValue* Property::prepareValue(const String& value)
+{
+    return new StringPreparedPropertyValue(*this, value);
+}
+
+//----------------------------------------------------------------------------//
+PreparedPropertyValue* Property::prepareCurrentValue(const PropertyReceiver* receiver)
+{
+    return prepareValue(get(receiver));
+}
+
 //----------------------------------------------------------------------------//
 bool Property::isWritable() const
 {
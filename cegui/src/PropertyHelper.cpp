@@ -32,11 +32,15 @@
 #include "CEGUI/FontManager.h"
 #include "CEGUI/Font.h"
 #include "CEGUI/Exceptions.h"
-#include "CEGUI/StreamHelper.h"
-#include "CEGUI/SharedStringStream.h"
 #include "CEGUI/AspectMode.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <locale>
 #include <sstream>
+#include <string>
 
 
 namespace CEGUI
@@ -63,6 +67,714 @@ namespace
             "PropertyHelper::fromString could not parse the type " + typeName + " from the string: \"" + parsedstring +
             "\"");
     }
+
+    /*
+        The conversions below work directly on the code units of the strings, in
+        the manner of std::from_chars and std::to_chars: they neither allocate nor
+        depend on a locale, so unlike a (shared) stringstream they may be used
+        from any thread and from within other conversions. The formats they read
+        and write are the ones of the stream operators of the respective types.
+    */
+
+    //! Powers of ten that are represented exactly by a double
+    const double ExactPowersOf10[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const int MaxExactPowerOf10 = 22;
+
+    const std::uint64_t IntegerPowersOf10[] =
+    {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+        10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+        100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+        100000000000000000ull, 1000000000000000000ull,
+        10000000000000000000ull
+    };
+    const int MaxMantissaDigits = 19;
+
+    //! Largest integer up to which every integer is represented exactly by a double
+    const std::uint64_t MaxExactDoubleInteger = 1ull << 53;
+
+    //! Number of significant digits the property strings used to be written with
+    const int DefaultPrecision = 8;
+
+    /*!
+    \brief
+        A decimal number: its value is d_mantissa * 10^d_exponent, unless
+        d_truncated is set, in which case the mantissa only holds the leading
+        digits and the exact value has to be read from the text of the number.
+    */
+    struct DecimalNumber
+    {
+        bool d_negative;
+        bool d_truncated;
+        std::uint64_t d_mantissa;
+        int d_exponent;
+        //! The text the number was read from, if any; it only consists of ASCII characters
+        const String::value_type* d_begin;
+        const String::value_type* d_end;
+    };
+
+    //! Multiplies a value by 10^exponent, in as few roundings as possible
+    double scaleByPowerOf10(double value, int exponent)
+    {
+        while (exponent > MaxExactPowerOf10)
+        {
+            value *= ExactPowersOf10[MaxExactPowerOf10];
+            exponent -= MaxExactPowerOf10;
+        }
+        while (exponent < -MaxExactPowerOf10)
+        {
+            value /= ExactPowersOf10[MaxExactPowerOf10];
+            exponent += MaxExactPowerOf10;
+        }
+
+        return exponent >= 0 ? value * ExactPowersOf10[exponent] :
+                               value / ExactPowersOf10[-exponent];
+    }
+
+    /*!
+    \brief
+        Computes the double closest to the mantissa of a number scaled by its
+        exponent. This is only possible when both factors are exact doubles,
+        as the single rounding of their product or quotient is then the correct
+        one. Returns false when the number is outside of that range.
+    */
+    bool decimalToDoubleFast(const DecimalNumber& number, double& value)
+    {
+        if (number.d_truncated || number.d_mantissa > MaxExactDoubleInteger)
+            return false;
+
+        std::uint64_t mantissa = number.d_mantissa;
+        int exponent = number.d_exponent;
+
+        // "1e30" can still be computed exactly as 1e8 * 1e22
+        while (exponent > MaxExactPowerOf10 && mantissa <= MaxExactDoubleInteger / 10)
+        {
+            mantissa *= 10;
+            --exponent;
+        }
+
+        if (exponent > MaxExactPowerOf10 || exponent < -MaxExactPowerOf10)
+            return false;
+
+        value = exponent >= 0 ?
+            static_cast<double>(mantissa) * ExactPowersOf10[exponent] :
+            static_cast<double>(mantissa) / ExactPowersOf10[-exponent];
+
+        if (number.d_negative)
+            value = -value;
+
+        return true;
+    }
+
+    //! Reads the number using the "C" locale, for the rare cases not handled exactly above
+    template<typename T>
+    bool decimalToValueSlow(const DecimalNumber& number, T& value)
+    {
+        std::string text;
+        if (number.d_begin)
+        {
+            text.reserve(number.d_end - number.d_begin);
+            for (const String::value_type* c = number.d_begin; c != number.d_end; ++c)
+                text += static_cast<char>(*c);
+        }
+        else
+        {
+            text = (number.d_negative ? "-" : "") + std::to_string(number.d_mantissa) +
+                "e" + std::to_string(number.d_exponent);
+        }
+
+        std::istringstream stream(text);
+        stream.imbue(std::locale::classic());
+        stream >> value;
+
+        return !stream.fail();
+    }
+
+    bool decimalToValue(const DecimalNumber& number, double& value)
+    {
+        if (number.d_mantissa == 0 && !number.d_truncated)
+        {
+            value = number.d_negative ? -0.0 : 0.0;
+            return true;
+        }
+
+        if (decimalToDoubleFast(number, value))
+            return true;
+
+        return decimalToValueSlow(number, value);
+    }
+
+    //! Returns whether a double lies exactly halfway between two floats
+    bool isFloatMidpoint(double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        // a double has 29 more mantissa bits than a float
+        return (bits & 0x1FFFFFFFull) == 0x10000000ull;
+    }
+
+    bool decimalToValue(const DecimalNumber& number, float& value)
+    {
+        if (number.d_mantissa == 0 && !number.d_truncated)
+        {
+            value = number.d_negative ? -0.0f : 0.0f;
+            return true;
+        }
+
+        // Rounding the correctly rounded double to a float gives the correctly
+        // rounded float, except when the double lands exactly between two floats.
+        double exactValue;
+        if (decimalToDoubleFast(number, exactValue))
+        {
+            const double magnitude = std::fabs(exactValue);
+            if (magnitude >= std::numeric_limits<float>::min() &&
+                magnitude <= std::numeric_limits<float>::max() &&
+                !isFloatMidpoint(exactValue))
+            {
+                value = static_cast<float>(exactValue);
+                return true;
+            }
+        }
+
+        return decimalToValueSlow(number, value);
+    }
+
+    //! Returns whether a character is a white space in the "C" locale
+    bool isSpace(String::value_type c)
+    {
+        return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+
+    bool isDigit(String::value_type c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    //! Returns the value of a hexadecimal digit, or -1 if the character is none
+    int hexDigitValue(String::value_type c)
+    {
+        if (c >= '0' && c <= '9')
+            return static_cast<int>(c - '0');
+        if (c >= 'a' && c <= 'f')
+            return static_cast<int>(c - 'a') + 10;
+        if (c >= 'A' && c <= 'F')
+            return static_cast<int>(c - 'A') + 10;
+        return -1;
+    }
+
+    /*!
+    \brief
+        Reads values from a String the way the stream extraction operators and
+        the helpers of StreamHelper.h do: leading whitespace is skipped and
+        characters remaining after the last value are ignored. Once a read
+        fails, all subsequent reads fail as well.
+    */
+    class ValueReader
+    {
+    public:
+        explicit ValueReader(const String& str) :
+            d_pos(str.c_str()),
+            d_end(str.c_str() + str.length()),
+            d_failed(false)
+        {}
+
+        bool failed() const { return d_failed; }
+
+        //! Skips the character if it comes next, as optionalChar does
+        ValueReader& optionalChar(char c)
+        {
+            if (!d_failed)
+            {
+                skipSpace();
+                if (d_pos != d_end && *d_pos == static_cast<String::value_type>(c))
+                    ++d_pos;
+            }
+            return *this;
+        }
+
+        //! Skips the character, which has to come next, as mandatoryChar does
+        ValueReader& mandatoryChar(char c)
+        {
+            if (!d_failed)
+            {
+                skipSpace();
+                if (d_pos != d_end && *d_pos == static_cast<String::value_type>(c))
+                    ++d_pos;
+                else
+                    d_failed = true;
+            }
+            return *this;
+        }
+
+        //! Matches the characters, a space standing for any whitespace, as MandatoryString does
+        ValueReader& mandatoryString(const char* chars)
+        {
+            for (; !d_failed && *chars != '\0'; ++chars)
+            {
+                if (*chars == ' ')
+                    skipSpace();
+                else if (d_pos != d_end && *d_pos == static_cast<String::value_type>(*chars))
+                    ++d_pos;
+                else
+                    d_failed = true;
+            }
+            return *this;
+        }
+
+        ValueReader& read(float& value)
+        {
+            DecimalNumber number;
+            if (readDecimal(number) && !decimalToValue(number, value))
+                d_failed = true;
+            return *this;
+        }
+
+        ValueReader& read(double& value)
+        {
+            DecimalNumber number;
+            if (readDecimal(number) && !decimalToValue(number, value))
+                d_failed = true;
+            return *this;
+        }
+
+        //! Reads a UDim, whose braces and comma are optional
+        ValueReader& read(UDim& value)
+        {
+            return optionalChar('{').read(value.d_scale).optionalChar(',').
+                read(value.d_offset).optionalChar('}');
+        }
+
+        //! Reads a UVector2, whose braces and comma are optional
+        ValueReader& read(UVector2& value)
+        {
+            return optionalChar('{').read(value.d_x).optionalChar(',').
+                read(value.d_y).optionalChar('}');
+        }
+
+        //! Reads the hexadecimal ARGB value of a Colour
+        ValueReader& read(Colour& value)
+        {
+            argb_t argb = 0;
+            readInteger(argb, 16);
+            if (!d_failed)
+                value.setARGB(argb);
+            return *this;
+        }
+
+        /*!
+        \brief
+            Reads an integer with an optional sign and, in base 16, an optional
+            "0x" prefix. Values out of the range of the type are an error; a
+            minus sign negates unsigned values, as in num_get.
+        */
+        template<typename T>
+        ValueReader& readInteger(T& value, unsigned int base = 10)
+        {
+            if (d_failed)
+                return *this;
+
+            skipSpace();
+            const bool negative = readSign();
+
+            if (base == 16 && d_end - d_pos >= 2 && d_pos[0] == '0' &&
+                (d_pos[1] == 'x' || d_pos[1] == 'X'))
+                d_pos += 2;
+
+            const std::uint64_t maxMagnitude = std::numeric_limits<T>::is_signed && negative ?
+                static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + 1 :
+                static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+
+            std::uint64_t magnitude = 0;
+            bool hasDigits = false;
+            int digit;
+            while (d_pos != d_end &&
+                   (digit = hexDigitValue(*d_pos)) >= 0 && digit < static_cast<int>(base))
+            {
+                if (magnitude > (maxMagnitude - digit) / base)
+                {
+                    d_failed = true;
+                    return *this;
+                }
+
+                magnitude = magnitude * base + digit;
+                hasDigits = true;
+                ++d_pos;
+            }
+
+            if (!hasDigits)
+            {
+                d_failed = true;
+                return *this;
+            }
+
+            value = negative ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude);
+            return *this;
+        }
+
+    private:
+        void skipSpace()
+        {
+            while (d_pos != d_end && isSpace(*d_pos))
+                ++d_pos;
+        }
+
+        //! Skips an optional sign and returns whether it was a minus
+        bool readSign()
+        {
+            if (d_pos != d_end && (*d_pos == '-' || *d_pos == '+'))
+                return *d_pos++ == '-';
+
+            return false;
+        }
+
+        /*!
+        \brief
+            Reads a decimal number with an optional fraction and exponent, as
+            num_get does for floating point values. Sets the error state and
+            returns false if there is no number.
+        */
+        bool readDecimal(DecimalNumber& number)
+        {
+            if (d_failed)
+                return false;
+
+            skipSpace();
+            number.d_begin = d_pos;
+            number.d_negative = readSign();
+            number.d_truncated = false;
+            number.d_mantissa = 0;
+            number.d_exponent = 0;
+
+            int mantissaDigits = 0;
+            bool hasDigits = false;
+            bool inFraction = false;
+            for (; d_pos != d_end; ++d_pos)
+            {
+                if (*d_pos == '.' && !inFraction)
+                {
+                    inFraction = true;
+                    continue;
+                }
+                if (!isDigit(*d_pos))
+                    break;
+
+                hasDigits = true;
+                const unsigned int digit = static_cast<unsigned int>(*d_pos - '0');
+                if (mantissaDigits < MaxMantissaDigits)
+                {
+                    // leading zeros do not count towards the precision
+                    if (number.d_mantissa != 0 || digit != 0)
+                        ++mantissaDigits;
+                    number.d_mantissa = number.d_mantissa * 10 + digit;
+                    if (inFraction)
+                        --number.d_exponent;
+                }
+                else
+                {
+                    number.d_truncated |= digit != 0;
+                    if (!inFraction)
+                        ++number.d_exponent;
+                }
+            }
+
+            if (!hasDigits)
+            {
+                d_failed = true;
+                return false;
+            }
+
+            if (d_pos != d_end && (*d_pos == 'e' || *d_pos == 'E'))
+            {
+                ++d_pos;
+                const bool negativeExponent = readSign();
+
+                if (d_pos == d_end || !isDigit(*d_pos))
+                {
+                    d_failed = true;
+                    return false;
+                }
+
+                int exponent = 0;
+                for (; d_pos != d_end && isDigit(*d_pos); ++d_pos)
+                {
+                    // anything this large under- or overflows anyway
+                    if (exponent < 100000)
+                        exponent = exponent * 10 + static_cast<int>(*d_pos - '0');
+                }
+
+                number.d_exponent += negativeExponent ? -exponent : exponent;
+            }
+
+            number.d_end = d_pos;
+            return true;
+        }
+
+        const String::value_type* d_pos;
+        const String::value_type* d_end;
+        bool d_failed;
+    };
+
+    //! Returns whether the String contains the (ASCII) character
+    bool containsChar(const String& str, char c)
+    {
+        const String::value_type* const end = str.c_str() + str.length();
+        return std::find(str.c_str(), end, static_cast<String::value_type>(c)) != end;
+    }
+
+    /*!
+    \brief
+        Rounds a positive value to the given number of significant digits.
+        Returns those digits as an integer, and adjusts \a exponent, the
+        initial estimate of the decimal exponent of the value, to the one of
+        the first digit.
+    */
+    std::uint64_t roundToDigits(double value, int digitCount, int& exponent)
+    {
+        for (;;)
+        {
+            const double scaled = scaleByPowerOf10(value, digitCount - 1 - exponent);
+            const std::uint64_t digits = static_cast<std::uint64_t>(scaled + 0.5);
+
+            if (digits >= IntegerPowersOf10[digitCount])
+                ++exponent;
+            else if (digits < IntegerPowersOf10[digitCount - 1])
+                --exponent;
+            else
+                return digits;
+        }
+    }
+
+    /*!
+    \brief
+        Writes a value given by its significant digits and the decimal exponent
+        of the first one, the way an ostream in its default float format does:
+        trailing zeros are dropped and the scientific notation is used for very
+        large and very small values.
+    */
+    char* writeDecimal(char* out, bool negative, std::uint64_t digits,
+                       int digitCount, int exponent)
+    {
+        while (digitCount > 1 && digits % 10 == 0)
+        {
+            digits /= 10;
+            --digitCount;
+        }
+
+        char digitChars[MaxMantissaDigits + 1] = {};
+        for (int i = digitCount - 1; i >= 0; --i)
+        {
+            digitChars[i] = static_cast<char>('0' + digits % 10);
+            digits /= 10;
+        }
+
+        if (negative)
+            *out++ = '-';
+
+        if (exponent < -4 || exponent >= std::max(digitCount, DefaultPrecision))
+        {
+            *out++ = digitChars[0];
+            if (digitCount > 1)
+            {
+                *out++ = '.';
+                for (int i = 1; i < digitCount; ++i)
+                    *out++ = digitChars[i];
+            }
+
+            *out++ = 'e';
+            *out++ = exponent < 0 ? '-' : '+';
+            const int exponentMagnitude = std::abs(exponent);
+            if (exponentMagnitude >= 100)
+                *out++ = static_cast<char>('0' + exponentMagnitude / 100);
+            *out++ = static_cast<char>('0' + exponentMagnitude / 10 % 10);
+            *out++ = static_cast<char>('0' + exponentMagnitude % 10);
+        }
+        else if (exponent < 0)
+        {
+            *out++ = '0';
+            *out++ = '.';
+            for (int i = -1; i > exponent; --i)
+                *out++ = '0';
+            for (int i = 0; i < digitCount; ++i)
+                *out++ = digitChars[i];
+        }
+        else
+        {
+            for (int i = 0; i < digitCount || i <= exponent; ++i)
+            {
+                if (i == exponent + 1)
+                    *out++ = '.';
+                *out++ = i < digitCount ? digitChars[i] : '0';
+            }
+        }
+
+        return out;
+    }
+
+    //! Writes a value that is not finite the way an ostream does
+    char* writeNonFinite(char* out, double value)
+    {
+        if (std::signbit(value))
+            *out++ = '-';
+
+        const char* text = std::isnan(value) ? "nan" : "inf";
+        while (*text != '\0')
+            *out++ = *text++;
+
+        return out;
+    }
+
+    //! Writes a value with the given precision, for the rare cases not handled exactly above
+    template<typename T>
+    char* writeValueSlow(char* out, T value, int precision)
+    {
+        std::ostringstream stream;
+        stream.imbue(std::locale::classic());
+        stream.precision(precision);
+        stream << value;
+
+        const std::string text(stream.str());
+        return std::copy(text.begin(), text.end(), out);
+    }
+
+    /*!
+    \brief
+        Writes the shortest decimal representation of a value that reads back
+        as the very same value, trying up to \a maxDigits significant digits.
+    */
+    template<typename T>
+    char* writeShortest(char* out, T value, int maxDigits)
+    {
+        if (!std::isfinite(value))
+            return writeNonFinite(out, value);
+
+        const bool negative = std::signbit(value);
+        if (value == 0)
+            return writeDecimal(out, negative, 0, 1, 0);
+
+        const double magnitude = std::fabs(static_cast<double>(value));
+        int exponent = static_cast<int>(std::floor(std::log10(magnitude)));
+
+        for (int digitCount = 1; digitCount <= maxDigits; ++digitCount)
+        {
+            const std::uint64_t digits = roundToDigits(magnitude, digitCount, exponent);
+
+            DecimalNumber number;
+            number.d_negative = false;
+            number.d_truncated = false;
+            number.d_mantissa = digits;
+            number.d_exponent = exponent - (digitCount - 1);
+            number.d_begin = nullptr;
+            number.d_end = nullptr;
+
+            T readBack;
+            if (decimalToValue(number, readBack) &&
+                readBack == static_cast<T>(magnitude))
+                return writeDecimal(out, negative, digits, digitCount, exponent);
+        }
+
+        return writeValueSlow(out, value, std::numeric_limits<T>::max_digits10);
+    }
+
+    /*!
+    \brief
+        Writes values into a fixed buffer, which is large enough for the
+        string of any of the property types, and turns them into a String.
+    */
+    class ValueWriter
+    {
+    public:
+        ValueWriter() :
+            d_end(d_buffer)
+        {}
+
+        String toString() const
+        {
+            return String(d_buffer, static_cast<String::size_type>(d_end - d_buffer));
+        }
+
+        ValueWriter& write(const char* text)
+        {
+            while (*text != '\0')
+                *d_end++ = *text++;
+            return *this;
+        }
+
+        //! Writes the shortest text that reads back as the same float
+        ValueWriter& write(float value)
+        {
+            d_end = writeShortest(d_end, value, std::numeric_limits<float>::max_digits10);
+            return *this;
+        }
+
+        /*!
+        \brief
+            Writes the shortest text that reads back as the same double. Values
+            that need more than 15 digits are written with all 17 digits.
+        */
+        ValueWriter& write(double value)
+        {
+            d_end = writeShortest(d_end, value, std::numeric_limits<double>::digits10);
+            return *this;
+        }
+
+        ValueWriter& write(const UDim& value)
+        {
+            return write("{").write(value.d_scale).write(",").write(value.d_offset).write("}");
+        }
+
+        ValueWriter& write(const UVector2& value)
+        {
+            return write(value.d_x).write(",").write(value.d_y);
+        }
+
+        //! Writes the ARGB value of a Colour as 8 hexadecimal digits
+        ValueWriter& write(const Colour& value)
+        {
+            static const char HexDigits[] = "0123456789abcdef";
+
+            const argb_t argb = value.getARGB();
+            for (int shift = 28; shift >= 0; shift -= 4)
+                *d_end++ = HexDigits[(argb >> shift) & 0xF];
+            return *this;
+        }
+
+        ValueWriter& writeInteger(std::int64_t value)
+        {
+            // negate in unsigned arithmetic, which also handles the minimum value
+            if (value < 0)
+            {
+                *d_end++ = '-';
+                return writeUnsigned(0 - static_cast<std::uint64_t>(value));
+            }
+
+            return writeUnsigned(static_cast<std::uint64_t>(value));
+        }
+
+        ValueWriter& writeUnsigned(std::uint64_t value)
+        {
+            char digits[MaxMantissaDigits + 1];
+            char* digit = digits + sizeof(digits);
+            do
+            {
+                *--digit = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+
+            d_end = std::copy(digit, digits + sizeof(digits), d_end);
+            return *this;
+        }
+
+    private:
+        //! Enough for the longest of the strings, the one of a UBox
+        char d_buffer[256];
+        char* d_end;
+    };
 }
 
 bool ParserHelper::IsEmptyOrContainingOnlyDecimalPointOrSign(const CEGUI::String& text)
@@ -75,9 +787,7 @@ bool ParserHelper::IsEmptyOrContainingOnlyDecimalPointOrSign(const CEGUI::String
     if (text.length() == 1)
     {
         CEGUI::String::value_type character = text[0];
-        if ((character == SharedStringstream::GetDecimalPoint()) ||
-            (character == SharedStringstream::GetNegativeSign()) ||
-            (character == SharedStringstream::GetPositiveSign()))
+        if (character == '.' || character == '-' || character == '+')
         {
             return true;
         }
@@ -96,8 +806,7 @@ bool ParserHelper::IsEmptyOrContainingSign(const CEGUI::String& text)
     if (text.length() == 1)
     {
         CEGUI::String::value_type character = text[0];
-        if ((character == SharedStringstream::GetNegativeSign()) ||
-            (character == SharedStringstream::GetPositiveSign()))
+        if (character == '-' || character == '+')
         {
             return true;
         }
@@ -270,10 +979,7 @@ PropertyHelper<float>::fromString(const String& str)
     }
     
     float val = 0.0f;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).read(val).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -282,10 +988,7 @@ PropertyHelper<float>::fromString(const String& str)
 PropertyHelper<float>::string_return_type PropertyHelper<float>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write(val).toString();
 }
 
 const String& PropertyHelper<UDim>::getDataTypeName()
@@ -303,9 +1006,7 @@ PropertyHelper<UDim>::fromString(const String& str)
     if (str.empty())
         return ud;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> ud;
-    if (sstream.fail())
+    if (ValueReader(str).read(ud).failed())
         throwParsingException(getDataTypeName(), str);
 
     return ud;
@@ -314,10 +1015,7 @@ PropertyHelper<UDim>::fromString(const String& str)
 PropertyHelper<UDim>::string_return_type PropertyHelper<UDim>::toString(
     PropertyHelper<UDim>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write(val).toString();
 }
 
 const String& PropertyHelper<UVector2>::getDataTypeName()
@@ -335,9 +1033,7 @@ PropertyHelper<UVector2>::fromString(const String& str)
     if (str.empty())
         return uv;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> uv;
-    if (sstream.fail())
+    if (ValueReader(str).read(uv).failed())
         throwParsingException(getDataTypeName(), str);
 
     return uv;
@@ -346,10 +1042,7 @@ PropertyHelper<UVector2>::fromString(const String& str)
 PropertyHelper<UVector2>::string_return_type PropertyHelper<UVector2>::toString(
     PropertyHelper<UVector2>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write(val).toString();
 }
 
 const String& PropertyHelper<UVector3>::getDataTypeName()
@@ -367,9 +1060,8 @@ PropertyHelper<UVector3>::fromString(const String& str)
     if (str.empty())
         return uv;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> uv;
-    if (sstream.fail())
+    if (ValueReader(str).optionalChar('{').read(uv.d_x).optionalChar(',').
+            read(uv.d_y).optionalChar(',').read(uv.d_z).optionalChar('}').failed())
         throwParsingException(getDataTypeName(), str);
 
     return uv;
@@ -378,10 +1070,7 @@ PropertyHelper<UVector3>::fromString(const String& str)
 PropertyHelper<UVector3>::string_return_type PropertyHelper<UVector3>::toString(
     PropertyHelper<UVector3>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write(val.d_x).write(",").write(val.d_y).write(",").write(val.d_z).toString();
 }
 
 const String& PropertyHelper<USize>::getDataTypeName()
@@ -399,9 +1088,8 @@ PropertyHelper<USize>::fromString(const String& str)
     if (str.empty())
         return uv;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> uv;
-    if (sstream.fail())
+    if (ValueReader(str).mandatoryChar('{').read(uv.d_width).optionalChar(',').
+            read(uv.d_height).optionalChar('}').failed())
         throwParsingException(getDataTypeName(), str);
 
     return uv;
@@ -410,10 +1098,7 @@ PropertyHelper<USize>::fromString(const String& str)
 PropertyHelper<USize>::string_return_type PropertyHelper<USize>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write("{").write(val.d_width).write(",").write(val.d_height).write("}").toString();
 }
 
 const String& PropertyHelper<URect>::getDataTypeName()
@@ -431,9 +1116,8 @@ PropertyHelper<URect>::fromString(const String& str)
     if (str.empty())
         return ur;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> ur;
-    if (sstream.fail())
+    if (ValueReader(str).optionalChar('{').read(ur.d_min).optionalChar(',').
+            read(ur.d_max).optionalChar('}').failed())
         throwParsingException(getDataTypeName(), str);
 
     return ur;
@@ -442,10 +1126,7 @@ PropertyHelper<URect>::fromString(const String& str)
 PropertyHelper<URect>::string_return_type PropertyHelper<URect>::toString(
     PropertyHelper<URect>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write("{").write(val.d_min).write(",").write(val.d_max).write("}").toString();
 }
 
 const String& PropertyHelper<UBox>::getDataTypeName()
@@ -463,9 +1144,15 @@ PropertyHelper<UBox>::fromString(const String& str)
     if (str.empty())
         return ret;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> ret;
-    if (sstream.fail())
+    if (ValueReader(str).optionalChar('{').
+            mandatoryString(" top : {").read(ret.d_top.d_scale).optionalChar(',').
+            read(ret.d_top.d_offset).mandatoryChar('}').optionalChar(',').
+            mandatoryString(" left : {").read(ret.d_left.d_scale).optionalChar(',').
+            read(ret.d_left.d_offset).mandatoryChar('}').optionalChar(',').
+            mandatoryString(" bottom : {").read(ret.d_bottom.d_scale).optionalChar(',').
+            read(ret.d_bottom.d_offset).mandatoryChar('}').optionalChar(',').
+            mandatoryString(" right : {").read(ret.d_right.d_scale).optionalChar(',').
+            read(ret.d_right.d_offset).failed())
         throwParsingException(getDataTypeName(), str);
 
     return ret;
@@ -474,10 +1161,10 @@ PropertyHelper<UBox>::fromString(const String& str)
 PropertyHelper<UBox>::string_return_type PropertyHelper<UBox>::toString(
     PropertyHelper<UBox>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write("{top:").write(val.d_top).
+        write(",left:").write(val.d_left).
+        write(",bottom:").write(val.d_bottom).
+        write(",right:").write(val.d_right).write("}").toString();
 }
 
 const String& PropertyHelper<ColourRect>::getDataTypeName()
@@ -495,14 +1182,11 @@ PropertyHelper<ColourRect>::fromString(const String& str)
     if (str.empty())
          return val;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
     if (str.length() == 8)
     {
         CEGUI::Colour colourForEntireRect(0xFF000000);
 
-        sstream >> colourForEntireRect;
-        if (sstream.fail())
+        if (ValueReader(str).read(colourForEntireRect).failed())
             throwParsingException(getDataTypeName(), str);
 
         val = ColourRect(colourForEntireRect);
@@ -511,8 +1195,10 @@ PropertyHelper<ColourRect>::fromString(const String& str)
     }
     else
     {
-        sstream >> val;
-        if (sstream.fail())
+        if (ValueReader(str).mandatoryString(" tl : ").read(val.d_top_left).
+                mandatoryString(" tr : ").read(val.d_top_right).
+                mandatoryString(" bl : ").read(val.d_bottom_left).
+                mandatoryString(" br : ").read(val.d_bottom_right).failed())
             throwParsingException(getDataTypeName(), str);
 
         return val;
@@ -522,14 +1208,13 @@ PropertyHelper<ColourRect>::fromString(const String& str)
 PropertyHelper<ColourRect>::string_return_type PropertyHelper<ColourRect>::toString(
     PropertyHelper<ColourRect>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-
     if(val.isMonochromatic())
-        sstream << val.d_top_left;
-    else
-        sstream << val;
+        return ValueWriter().write(val.d_top_left).toString();
 
-    return String(sstream.str());
+    return ValueWriter().write("tl:").write(val.d_top_left).
+        write(" tr:").write(val.d_top_right).
+        write(" bl:").write(val.d_bottom_left).
+        write(" br:").write(val.d_bottom_right).toString();
 }
 
 const String& PropertyHelper<Colour>::getDataTypeName()
@@ -547,22 +1232,16 @@ PropertyHelper<Colour>::fromString(const String& str)
     if (str.empty())
         return val;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).read(val).failed())
         throwParsingException(getDataTypeName(), str);
-    
 
-    return Colour(val);
+    return val;
 }
 
 PropertyHelper<Colour>::string_return_type PropertyHelper<Colour>::toString(
     PropertyHelper<Colour>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write(val).toString();
 }
 
 const String& PropertyHelper<Rectf>::getDataTypeName()
@@ -580,9 +1259,10 @@ PropertyHelper<Rectf>::fromString(const String& str)
     if (str.empty())
         return val;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).mandatoryString(" l :").read(val.d_min.x).
+            mandatoryString(" t :").read(val.d_min.y).
+            mandatoryString(" r :").read(val.d_max.x).
+            mandatoryString(" b :").read(val.d_max.y).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -591,10 +1271,8 @@ PropertyHelper<Rectf>::fromString(const String& str)
 PropertyHelper<Rectf>::string_return_type PropertyHelper<Rectf>::toString(
     PropertyHelper<Rectf>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write("l:").write(val.d_min.x).write(" t:").write(val.d_min.y).
+        write(" r:").write(val.d_max.x).write(" b:").write(val.d_max.y).toString();
 }
 
 const String& PropertyHelper<Sizef>::getDataTypeName()
@@ -612,9 +1290,8 @@ PropertyHelper<Sizef>::fromString(const String& str)
     if (str.empty())
         return val;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).mandatoryString(" w :").read(val.d_width).
+            mandatoryString(" h :").read(val.d_height).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -623,10 +1300,7 @@ PropertyHelper<Sizef>::fromString(const String& str)
 PropertyHelper<Sizef>::string_return_type PropertyHelper<Sizef>::toString(
     PropertyHelper<Sizef>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write("w:").write(val.d_width).write(" h:").write(val.d_height).toString();
 }
 
 const String& PropertyHelper<double>::getDataTypeName()
@@ -644,11 +1318,8 @@ PropertyHelper<double>::fromString(const String& str)
         return 0.0;
     }
 
-    double val;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
-    sstream >> val;
-    if (sstream.fail())
+    double val = 0.0;
+    if (ValueReader(str).read(val).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -658,10 +1329,7 @@ PropertyHelper<double>::fromString(const String& str)
 PropertyHelper<double>::string_return_type PropertyHelper<double>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().write(val).toString();
 }
 
 
@@ -681,10 +1349,7 @@ PropertyHelper<std::int16_t>::fromString(const String& str)
     }
     
     std::int16_t val = 0;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).readInteger(val).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -694,10 +1359,7 @@ PropertyHelper<std::int16_t>::fromString(const String& str)
 PropertyHelper<std::int16_t>::string_return_type PropertyHelper<std::int16_t>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().writeInteger(val).toString();
 }
 
 
@@ -717,10 +1379,7 @@ PropertyHelper<std::int32_t>::fromString(const String& str)
     }
     
     std::int32_t val = 0;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).readInteger(val).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -730,10 +1389,7 @@ PropertyHelper<std::int32_t>::fromString(const String& str)
 PropertyHelper<std::int32_t>::string_return_type PropertyHelper<std::int32_t>::toString(
     PropertyHelper<std::int32_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().writeInteger(val).toString();
 }
 
 const String& PropertyHelper<std::int64_t>::getDataTypeName()
@@ -752,10 +1408,7 @@ PropertyHelper<std::int64_t>::fromString(const String& str)
     }
     
     std::int64_t val = 0;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).readInteger(val).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -765,10 +1418,7 @@ PropertyHelper<std::int64_t>::fromString(const String& str)
 PropertyHelper<std::int64_t>::string_return_type PropertyHelper<std::int64_t>::toString(
     PropertyHelper<std::int64_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().writeInteger(val).toString();
 }
 
 
@@ -788,10 +1438,7 @@ PropertyHelper<std::uint32_t>::fromString(const String& str)
     }
     
     std::uint32_t val = 0;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).readInteger(val).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -801,10 +1448,7 @@ PropertyHelper<std::uint32_t>::fromString(const String& str)
 PropertyHelper<std::uint32_t>::string_return_type PropertyHelper<std::uint32_t>::toString(
     PropertyHelper<std::uint32_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().writeUnsigned(val).toString();
 }
 
 const String& PropertyHelper<std::uint64_t>::getDataTypeName()
@@ -823,10 +1467,7 @@ PropertyHelper<std::uint64_t>::fromString(const String& str)
     }
     
     std::uint64_t val = 0;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-
-    sstream >> val;
-    if (sstream.fail())
+    if (ValueReader(str).readInteger(val).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -836,10 +1477,7 @@ PropertyHelper<std::uint64_t>::fromString(const String& str)
 PropertyHelper<std::uint64_t>::string_return_type PropertyHelper<std::uint64_t>::toString(
     PropertyHelper<std::uint64_t>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << val;
-
-    return String(sstream.str());
+    return ValueWriter().writeUnsigned(val).toString();
 }
 
 const String& PropertyHelper<glm::vec2>::getDataTypeName()
@@ -857,9 +1495,8 @@ PropertyHelper<glm::vec2>::fromString(const String& str)
     if (str.empty())
         return val;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y;
-    if (sstream.fail())
+    if (ValueReader(str).mandatoryString(" x :").read(val.x).
+            mandatoryString(" y :").read(val.y).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -868,10 +1505,7 @@ PropertyHelper<glm::vec2>::fromString(const String& str)
 PropertyHelper<glm::vec2>::string_return_type PropertyHelper<glm::vec2>::toString(
     PropertyHelper<glm::vec2>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "x:" << val.x << " y:" << val.y;
-
-    return String(sstream.str());
+    return ValueWriter().write("x:").write(val.x).write(" y:").write(val.y).toString();
 }
 
 const String& PropertyHelper<glm::vec3>::getDataTypeName()
@@ -889,9 +1523,9 @@ PropertyHelper<glm::vec3>::fromString(const String& str)
     if (str.empty())
         return val;
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-    sstream >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y >> MandatoryString(" z :") >> val.z;
-    if (sstream.fail())
+    if (ValueReader(str).mandatoryString(" x :").read(val.x).
+            mandatoryString(" y :").read(val.y).
+            mandatoryString(" z :").read(val.z).failed())
         throwParsingException(getDataTypeName(), str);
 
     return val;
@@ -900,10 +1534,8 @@ PropertyHelper<glm::vec3>::fromString(const String& str)
 PropertyHelper<glm::vec3>::string_return_type PropertyHelper<glm::vec3>::toString(
     PropertyHelper<glm::vec3>::pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "x:" << val.x << " y:" << val.y << " z:" << val.z;
-
-    return String(sstream.str());
+    return ValueWriter().write("x:").write(val.x).write(" y:").write(val.y).
+        write(" z:").write(val.z).toString();
 }
 
 const String& PropertyHelper<glm::quat>::getDataTypeName()
@@ -920,17 +1552,12 @@ PropertyHelper<glm::quat>::fromString(const String& str)
 
     if (str.empty())
         return val;
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-    else if (str.find("w", 0) != std::string::npos || 
-             str.find("W", 0) != std::string::npos)
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-    else if (str.getString().find(String("w").c_str(), 0) != std::string::npos || 
-             str.getString().find(String("W").c_str(), 0) != std::string::npos)
-#endif
-    {
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-        sstream >> MandatoryString(" w :") >> val.w >> MandatoryString(" x :") >> val.x >> MandatoryString(" y :") >> val.y >> MandatoryString(" z :") >> val.z;
-        if (sstream.fail())
+    else if (containsChar(str, 'w') || containsChar(str, 'W'))
+    {
+        if (ValueReader(str).mandatoryString(" w :").read(val.w).
+                mandatoryString(" x :").read(val.x).
+                mandatoryString(" y :").read(val.y).
+                mandatoryString(" z :").read(val.z).failed())
             throwParsingException(getDataTypeName(), str);
         return val;
     }
@@ -938,9 +1565,9 @@ PropertyHelper<glm::quat>::fromString(const String& str)
     {
         float x, y, z;
         // CEGUI takes degrees because it's easier to work with
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
-        sstream >> MandatoryString(" x :") >> x >> MandatoryString(" y :") >> y >> MandatoryString(" z :") >> z;
-        if (sstream.fail())
+        if (ValueReader(str).mandatoryString(" x :").read(x).
+                mandatoryString(" y :").read(y).
+                mandatoryString(" z :").read(z).failed())
             throwParsingException(getDataTypeName(), str);
 
         // glm::radians converts from degrees to radians
@@ -951,10 +1578,8 @@ PropertyHelper<glm::quat>::fromString(const String& str)
 PropertyHelper<glm::quat>::string_return_type PropertyHelper<glm::quat>::toString(
     pass_type val)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << "w:" << val.w << " x:" << val.x << " y:" << val.y << " z:" << val.z;
-
-    return String(sstream.str());
+    return ValueWriter().write("w:").write(val.w).write(" x:").write(val.x).
+        write(" y:").write(val.y).write(" z:").write(val.z).toString();
 }
 
 const String& PropertyHelper<String>::getDataTypeName()
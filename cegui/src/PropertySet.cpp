@@ -49,6 +49,7 @@ void PropertySet::addProperty(Property* property)
 		throw AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet.");
 	}
 
+    ++d_propertyRevision;
     property->initialisePropertyReceiver(this);
 }
 
@@ -62,6 +63,7 @@ void PropertySet::removeProperty(const String& name)
 	if (pos != d_properties.end())
 	{
 		d_properties.erase(pos);
+		++d_propertyRevision;
 	}
 }
 
@@ -86,6 +88,7 @@ Property* PropertySet::getPropertyInstance(const String& name) const
 void PropertySet::clearProperties(void)
 {
 	d_properties.clear();
+	++d_propertyRevision;
 }
 
 /*************************************************************************
@@ -25,7 +25,6 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/RenderEffectManager.h"
-#include "CEGUI/SharedStringStream.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -37,7 +36,7 @@ RenderEffectManager* Singleton<RenderEffectManager>::ms_Singleton = nullptr;
 //---------------------------------------------------------------------------//
 RenderEffectManager::RenderEffectManager()
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::RenderEffectManager Singleton created. (" + addressStr + ")");
@@ -54,7 +53,7 @@ RenderEffectManager::~RenderEffectManager()
     while (!d_effectRegistry.empty())
         removeEffect(d_effectRegistry.begin()->first);
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::RenderEffectManager singleton destroyed (" + addressStr + ")");
@@ -97,7 +96,7 @@ RenderEffect& RenderEffectManager::create(const String& name, Window* window)
     // here we keep track of the factory used to create the effect object.
     d_effects[&effect] = i->second;
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&effect);
+    String addressStr = Logger::addressToString(&effect);
 
     Logger::getSingleton().logEvent("RenderEffectManager::create: Created "
         "instance of effect '" + name + "' at (" + addressStr + ")");
@@ -117,7 +116,7 @@ void RenderEffectManager::destroy(RenderEffect& effect)
             "RenderEffectManager - perhaps you created it directly?");
 
     // Get string of object address before we delete it.
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&effect);
+    String addressStr = Logger::addressToString(&effect);
 
     // use the same factory to delete the RenderEffect as what created it
     i->second->destroy(effect);
@@ -26,6 +26,8 @@
  ***************************************************************************/
 #include "CEGUI/RenderQueue.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderStats.h"
+#include "CEGUI/System.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
@@ -34,10 +36,19 @@ namespace CEGUI
 //----------------------------------------------------------------------------//
 void RenderQueue::draw(std::uint32_t drawModeMask) const
 {
+    RenderStats& stats = System::getSingleton().getRenderStats();
+    RenderStats::ScopedTimer timer(stats, RenderStatsTimer::RenderQueueDraw);
+
     // draw the buffers
     BufferList::const_iterator i = d_buffers.begin();
     for ( ; i != d_buffers.end(); ++i)
         (*i)->draw(drawModeMask);
+
+    if (stats.isEnabled())
+    {
+        for (i = d_buffers.begin(); i != d_buffers.end(); ++i)
+            stats.addGeometryBufferDrawn((*i)->getVertexCount());
+    }
 }
 
 //----------------------------------------------------------------------------//
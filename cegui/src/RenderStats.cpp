@@ -0,0 +1,155 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the per-frame rendering statistics
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RenderStats.h"
+#include "CEGUI/Window.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+RenderStats::ScopedTimer::ScopedTimer(RenderStats& stats,
+                                      RenderStatsTimer timer) :
+    d_stats(stats.d_enabled ? &stats : nullptr),
+    d_timer(timer)
+{
+    if (d_stats && d_stats->beginTiming(d_timer))
+        d_startTime = std::chrono::steady_clock::now();
+}
+
+//----------------------------------------------------------------------------//
+RenderStats::ScopedTimer::~ScopedTimer()
+{
+    if (d_stats)
+        d_stats->endTiming(d_timer, d_startTime);
+}
+
+//----------------------------------------------------------------------------//
+RenderStats::RenderStats() :
+    d_enabled(false),
+    d_windowStatsEnabled(false)
+{
+    resetFrameStats(d_currentFrame);
+    resetFrameStats(d_lastFrame);
+
+    for (int i = 0; i < static_cast<int>(RenderStatsTimer::Count); ++i)
+        d_timerDepth[i] = 0;
+}
+
+//----------------------------------------------------------------------------//
+void RenderStats::setEnabled(bool enabled)
+{
+    d_enabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+void RenderStats::setWindowStatsEnabled(bool enabled)
+{
+    d_windowStatsEnabled = enabled;
+
+    if (!enabled)
+        d_currentFrameWindows.clear();
+}
+
+//----------------------------------------------------------------------------//
+void RenderStats::beginFrame()
+{
+    resetFrameStats(d_currentFrame);
+    d_currentFrameWindows.clear();
+    d_frameTimer.restart();
+}
+
+//----------------------------------------------------------------------------//
+void RenderStats::endFrame()
+{
+    if (!d_enabled)
+        return;
+
+    d_currentFrame.d_frameTime = d_frameTimer.elapsedTime();
+    d_lastFrame = d_currentFrame;
+    d_lastFrameWindows.swap(d_currentFrameWindows);
+
+    resetFrameStats(d_currentFrame);
+    d_currentFrameWindows.clear();
+}
+
+//----------------------------------------------------------------------------//
+void RenderStats::addWindowRebuffered(const Window& window, double time,
+                                      size_t vertex_count)
+{
+    ++d_currentFrame.d_windowsRebuffered;
+
+    if (!d_windowStatsEnabled)
+        return;
+
+    WindowStats& stats = d_currentFrameWindows[&window];
+    if (stats.d_rebufferCount == 0)
+        stats.d_namePath = window.getNamePath();
+
+    ++stats.d_rebufferCount;
+    stats.d_bufferGeometryTime += time;
+    stats.d_vertexCount = vertex_count;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderStats::beginTiming(RenderStatsTimer timer)
+{
+    return ++d_timerDepth[static_cast<int>(timer)] == 1;
+}
+
+//----------------------------------------------------------------------------//
+void RenderStats::endTiming(RenderStatsTimer timer,
+                            const std::chrono::steady_clock::time_point& start)
+{
+    const int index = static_cast<int>(timer);
+
+    // only the outermost of nested measures counts
+    if (--d_timerDepth[index] == 0)
+    {
+        const std::chrono::duration<double> time =
+            std::chrono::steady_clock::now() - start;
+        d_currentFrame.d_times[index] += time.count();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderStats::resetFrameStats(FrameStats& stats)
+{
+    stats.d_geometryBuffersDrawn = 0;
+    stats.d_verticesDrawn = 0;
+    stats.d_verticesUploaded = 0;
+    stats.d_windowsDrawn = 0;
+    stats.d_windowsRebuffered = 0;
+    stats.d_frameTime = 0.0;
+
+    for (int i = 0; i < static_cast<int>(RenderStatsTimer::Count); ++i)
+        stats.d_times[i] = 0.0;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -113,10 +113,8 @@ void Direct3D11GeometryBuffer::draw(std::uint32_t drawModeMask) const
 }
 
 //----------------------------------------------------------------------------//
-void Direct3D11GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+void Direct3D11GeometryBuffer::onGeometryAppended()
 {
-    GeometryBuffer::appendGeometry(vertex_data, array_size);
-
     updateVertexBuffer();
 }
 
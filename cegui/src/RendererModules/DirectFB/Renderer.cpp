@@ -188,7 +188,7 @@ void DirectFBRenderer::logTextureCreation(DirectFBTexture* texture)
 {
     if (Logger* logger = Logger::getSingletonPtr())
     {
-        String addressStr = SharedStringstream::GetPointerAddressAsString(texture);
+        String addressStr = Logger::addressToString(texture);
 
         logger->logEvent("[DirectFBRenderer] Created texture: " +
                          texture->getName() + addr_buff);
@@ -219,7 +219,7 @@ void DirectFBRenderer::logTextureDestruction(DirectFBTexture* texture)
 {
     if (Logger* logger = Logger::getSingletonPtr())
     {
-        String addressStr = SharedStringstream::GetPointerAddressAsString(texture);
+        String addressStr = Logger::addressToString(texture);
 
         logger->logEvent("[DirectFBRenderer] Destroyed texture: " +
                          texture->getName() + addr_buff);
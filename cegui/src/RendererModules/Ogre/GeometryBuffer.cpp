@@ -182,10 +182,8 @@ void OgreGeometryBuffer::draw(std::uint32_t drawModeMask) const
 }
 
 //----------------------------------------------------------------------------//
-void OgreGeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+void OgreGeometryBuffer::onGeometryAppended()
 {
-    GeometryBuffer::appendGeometry(vertex_data, array_size);
-
     d_dataAppended = true;
 }
 
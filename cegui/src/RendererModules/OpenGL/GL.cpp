@@ -51,7 +51,8 @@ OpenGLInfo::OpenGLInfo() :
     d_isPolygonModeSupported(false),
     d_isSeperateReadAndDrawFramebufferSupported(false),
     d_isVaoSupported(false),
-    d_isSizedInternalFormatSupported(false)
+    d_isSizedInternalFormatSupported(false),
+    d_isTextureSwizzleSupported(false)
 {
 }
 
@@ -120,6 +121,10 @@ void OpenGLInfo::initSupportedFeatures()
       ||  (isUsingOpenglEs() && verMajor() >= 3);
     d_isVaoSupported =     (isUsingDesktopOpengl() && verAtLeast(3, 2))
                        ||  (isUsingOpenglEs() && verMajor() >= 3);
+    d_isTextureSwizzleSupported =
+          (isUsingDesktopOpengl() && verAtLeast(3, 3))
+      ||  (isUsingOpenglEs() && verMajor() >= 3)
+      ||  epoxy_has_gl_extension("GL_ARB_texture_swizzle");
       
 #elif defined CEGUI_USE_GLEW
 
@@ -155,6 +160,8 @@ void OpenGLInfo::initSupportedFeatures()
       = (GLEW_VERSION_1_3 == GL_TRUE);
     d_isSeperateReadAndDrawFramebufferSupported = (GLEW_VERSION_3_1 == GL_TRUE);
     d_isVaoSupported = (GLEW_VERSION_3_2 == GL_TRUE);
+    d_isTextureSwizzleSupported = (GLEW_VERSION_3_3 == GL_TRUE)
+      ||  (GLEW_ARB_texture_swizzle == GL_TRUE);
     
 #endif
 
@@ -279,10 +279,8 @@ void OpenGL3GeometryBuffer::updateOpenGLBuffers()
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+void OpenGL3GeometryBuffer::onGeometryAppended()
 {
-    OpenGLGeometryBufferBase::appendGeometry(vertex_data, array_size);
-
     updateOpenGLBuffers();
 }
 
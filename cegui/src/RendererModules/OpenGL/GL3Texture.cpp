@@ -52,6 +52,64 @@ void OpenGL3Texture::setTextureEnvironment()
 {
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL3Texture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    if (fmt != PixelFormat::Alpha)
+        return OpenGL1Texture::isPixelFormatSupported(fmt);
+
+    /* OpenGL ES grabs textures with "glReadPixels", which ignores the swizzle,
+       so only desktop OpenGL keeps single channel textures intact over a
+       grab/restore cycle. */
+    const OpenGLInfo& info = OpenGLInfo::getSingleton();
+    return info.isUsingDesktopOpengl() && info.isTextureSwizzleSupported();
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Texture::initInternalPixelFormatFields(const PixelFormat fmt)
+{
+    if (fmt != PixelFormat::Alpha)
+    {
+        OpenGL1Texture::initInternalPixelFormatFields(fmt);
+        return;
+    }
+
+    d_isCompressed = false;
+    d_pixelDataFormat = GL_RED;
+    d_pixelDataType = GL_UNSIGNED_BYTE;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Texture::setTextureSize_impl(const Sizef& sz)
+{
+    OpenGL1Texture::setTextureSize_impl(sz);
+
+    if (!OpenGLInfo::getSingleton().isTextureSwizzleSupported())
+        return;
+
+    const bool single_channel = (d_pixelDataFormat == GL_RED);
+    const GLint swizzle[] =
+    {
+        single_channel ? GL_ONE : GL_RED,
+        single_channel ? GL_ONE : GL_GREEN,
+        single_channel ? GL_ONE : GL_BLUE,
+        single_channel ? GL_RED : GL_ALPHA
+    };
+
+    // save old texture binding
+    GLuint old_tex;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&old_tex));
+
+    glBindTexture(GL_TEXTURE_2D, d_ogltexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, swizzle[0]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, swizzle[1]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, swizzle[2]);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, swizzle[3]);
+
+    // restore previous texture binding.
+    glBindTexture(GL_TEXTURE_2D, old_tex);
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -93,6 +93,11 @@ void OpenGL1Texture::initInternalPixelFormatFields(const PixelFormat fmt)
         d_isCompressed = true;
         break;
 
+    case PixelFormat::Alpha:
+        d_pixelDataFormat = GL_ALPHA;
+        d_pixelDataType = GL_UNSIGNED_BYTE;
+        break;
+
     default:
         throw RendererException(
                         "invalid or unsupported CEGUI::PixelFormat.");
@@ -104,6 +109,17 @@ OpenGL1Texture::~OpenGL1Texture()
 {
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL1Texture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    // GL_ALPHA textures are modulated with the vertex colour by the fixed
+    // function pipeline, which is exactly what is needed for text.
+    if (fmt == PixelFormat::Alpha)
+        return true;
+
+    return OpenGLTexture::isPixelFormatSupported(fmt);
+}
+
 //----------------------------------------------------------------------------//
 GLsizei OpenGL1Texture::getCompressedTextureSize(const Sizef& pixel_size) const
 {
@@ -95,6 +95,10 @@ GLint OpenGLTexture::getTextureFormat() const
             default:
                 throw RendererException(err);
             }
+        case GL_RED:
+            return GL_R8;
+        case GL_ALPHA:
+            return GL_ALPHA8;
         default:
             throw RendererException(err);
         }
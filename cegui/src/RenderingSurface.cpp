@@ -28,6 +28,9 @@
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/Renderer.h"
+#include "CEGUI/RenderStats.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
@@ -107,7 +110,23 @@ void RenderingSurface::draw(std::uint32_t drawMode)
 {
     d_target->activate();
     Renderer& owner = d_target->getOwner();
-    owner.uploadBuffers(*this);
+
+    RenderStats& stats = System::getSingleton().getRenderStats();
+    {
+        RenderStats::ScopedTimer timer(stats, RenderStatsTimer::UploadBuffers);
+        owner.uploadBuffers(*this);
+    }
+
+    if (stats.isEnabled())
+    {
+        for (RenderQueueList::iterator i = d_queues.begin();
+             i != d_queues.end(); ++i)
+        {
+            const RenderQueue::BufferList& buffers = i->second.getBuffers();
+            for (size_t j = 0; j < buffers.size(); ++j)
+                stats.addVerticesUploaded(buffers[j]->getVertexCount());
+        }
+    }
 
     drawContent(drawMode);
 
@@ -42,7 +42,6 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/DynamicModule.h"
-#include "CEGUI/SharedStringStream.h"
 
 #ifdef HAVE_CONFIG_H
 #   include "config.h"
@@ -86,7 +85,7 @@ Scheme::~Scheme(void)
 {
     unloadResources();
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
     Logger::getSingleton().logEvent("GUI scheme '" + d_name + "' has been "
         "unloaded (object destructor). " + addressStr, LoggingLevel::Informative);
 }
@@ -26,7 +26,6 @@
  ***************************************************************************/
 #include "CEGUI/SchemeManager.h"
 #include "CEGUI/Logger.h"
-#include "CEGUI/SharedStringStream.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -39,7 +38,7 @@ SchemeManager::SchemeManager() :
     d_resourceType("Scheme"),
     d_autoLoadResources(true)
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::SchemeManager Singleton created. (" + addressStr + ")");
@@ -53,7 +52,7 @@ SchemeManager::~SchemeManager()
 
     destroyAll();
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
     Logger::getSingleton().logEvent(
         "CEGUI::SchemeManager Singleton destroyed. (" + addressStr + ")");
 }
@@ -167,7 +166,7 @@ bool SchemeManager::isDefined(const String& object_name) const
 void SchemeManager::destroyObject(
     SchemeRegistry::iterator ob)
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(ob->second);
+    String addressStr = Logger::addressToString(ob->second);
     Logger::getSingleton().logEvent("Object of type '" + d_resourceType +
         "' named '" + ob->first + "' has been destroyed. " +
         addressStr, LoggingLevel::Informative);
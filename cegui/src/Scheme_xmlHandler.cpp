@@ -30,7 +30,6 @@
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
-#include "CEGUI/SharedStringStream.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -306,7 +305,7 @@ void Scheme_xmlHandler::elementGUISchemeEnd()
         throw InvalidRequestException(
             "Attempt to access null object.");
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(d_scheme);
+    String addressStr = Logger::addressToString(d_scheme);
     Logger::getSingleton().logEvent("Finished creation of GUIScheme '" +
         d_scheme->getName() + "' via XML file. " + addressStr, LoggingLevel::Informative);
 }
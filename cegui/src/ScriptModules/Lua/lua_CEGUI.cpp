@@ -66670,6 +66670,7 @@ int tolua_CEGUI_open (lua_State* tolua_S)
    tolua_constant(tolua_S,"PixelFormat::RgbaDxt1",CEGUI::Texture::PixelFormat::RgbaDxt1);
    tolua_constant(tolua_S,"PixelFormat::RgbaDxt3",CEGUI::Texture::PixelFormat::RgbaDxt3);
    tolua_constant(tolua_S,"PixelFormat::RgbaDxt5",CEGUI::Texture::PixelFormat::RgbaDxt5);
+   tolua_constant(tolua_S,"PixelFormat::Alpha",CEGUI::Texture::PixelFormat::Alpha);
    tolua_function(tolua_S,"getSize",tolua_CEGUI_CEGUI_Texture_getSize00);
    tolua_function(tolua_S,"getOriginalDataSize",tolua_CEGUI_CEGUI_Texture_getOriginalDataSize00);
    tolua_function(tolua_S,"getTexelScaling",tolua_CEGUI_CEGUI_Texture_getTexelScaling00);
@@ -75,6 +75,7 @@ void register_Texture_class(){
             .value("PixelFormat::RgbaDxt1", CEGUI::Texture::PixelFormat::RgbaDxt1)
             .value("PixelFormat::RgbaDxt3", CEGUI::Texture::PixelFormat::RgbaDxt3)
             .value("PixelFormat::RgbaDxt5", CEGUI::Texture::PixelFormat::RgbaDxt5)
+            .value("PixelFormat::Alpha", CEGUI::Texture::PixelFormat::Alpha)
             .export_values()
             ;
         { //::CEGUI::Texture::blitFromMemory
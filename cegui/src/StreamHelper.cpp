@@ -38,6 +38,19 @@ MandatoryString::MandatoryString(char const* mandatoryString)
     : m_chars(mandatoryString)
 {}
 
+void prepareStream(std::stringstream& stream, const String& value)
+{
+    stream.imbue(std::locale::classic());
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    stream.str(String::convertUtf32ToUtf8(value.getString()));
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8
+    stream.str(value.getString());
+#else
+    stream.str(value);
+#endif
+    stream.clear();
+}
+
 std::istream& operator>> (std::istream& inputStream, const MandatoryString& mandatoryString) 
 {
     //  If the input stream already has a fail/bad bit, we avoid overwriting the error message by doing nothing
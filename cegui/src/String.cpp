@@ -31,6 +31,14 @@
 
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32)
 #include <istream>
+#include <cstdint>
+#include <cstring>
+
+// SSE2 is part of every x86-64 target, so no runtime dispatch is needed for it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CEGUI_STRING_USE_SSE2
+#endif
 #endif
 
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32)
@@ -38,6 +46,182 @@
 namespace CEGUI
 {
 
+namespace
+{
+const std::uint64_t HIGH_BITS = 0x8080808080808080ULL;
+
+//! Returns the number of ASCII code units at the start of the UTF-8 array.
+size_t getAsciiPrefixLength(const char* utf8String, const size_t stringLength)
+{
+    size_t index = 0;
+
+#ifdef CEGUI_STRING_USE_SSE2
+    for (; index + 16 <= stringLength; index += 16)
+    {
+        const __m128i codeUnits = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(utf8String + index));
+
+        if (_mm_movemask_epi8(codeUnits) != 0)
+            break;
+    }
+#endif
+
+    for (; index + 8 <= stringLength; index += 8)
+    {
+        std::uint64_t codeUnits;
+        std::memcpy(&codeUnits, utf8String + index, sizeof(codeUnits));
+
+        if ((codeUnits & HIGH_BITS) != 0)
+            break;
+    }
+
+    while (index < stringLength &&
+           (static_cast<unsigned char>(utf8String[index]) & 0x80) == 0)
+        ++index;
+
+    return index;
+}
+
+//! Copies ASCII code units to UTF-32 code points.
+void widenAscii(const char* asciiString, const size_t stringLength,
+                char32_t* utf32String)
+{
+    size_t index = 0;
+
+#ifdef CEGUI_STRING_USE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 16 <= stringLength; index += 16)
+    {
+        const __m128i codeUnits = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(asciiString + index));
+        const __m128i low = _mm_unpacklo_epi8(codeUnits, zero);
+        const __m128i high = _mm_unpackhi_epi8(codeUnits, zero);
+
+        __m128i* out = reinterpret_cast<__m128i*>(utf32String + index);
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+    }
+#endif
+
+    for (; index < stringLength; ++index)
+        utf32String[index] = static_cast<char32_t>(asciiString[index]);
+}
+
+/*
+    Returns the number of code units in the UTF-8 array that are not
+    continuation code units. Every decoded code point starts with one of these,
+    so this is the exact number of code points of valid UTF-8 and an upper
+    bound otherwise.
+*/
+size_t getUtf8LeadCodeUnitCount(const char* utf8String, const size_t stringLength)
+{
+    size_t continuationCount = 0;
+    size_t index = 0;
+
+    for (; index + 8 <= stringLength; index += 8)
+    {
+        std::uint64_t codeUnits;
+        std::memcpy(&codeUnits, utf8String + index, sizeof(codeUnits));
+
+        // continuation code units have the high bit set and the next one clear
+        const std::uint64_t continuations =
+            (codeUnits & ~(codeUnits << 1) & HIGH_BITS) >> 7;
+
+        // sum up the bytes, each of which is either 0 or 1
+        continuationCount += static_cast<size_t>(
+            (continuations * 0x0101010101010101ULL) >> 56);
+    }
+
+    for (; index < stringLength; ++index)
+        if ((static_cast<unsigned char>(utf8String[index]) & 0xC0) == 0x80)
+            ++continuationCount;
+
+    return stringLength - continuationCount;
+}
+
+//! Returns the number of UTF-8 code units needed to encode the UTF-32 array.
+size_t getUtf8EncodedLength(const char32_t* utf32String, const size_t stringLength)
+{
+    size_t length = stringLength;
+    for (size_t index = 0; index < stringLength; ++index)
+    {
+        const char32_t codePoint = utf32String[index];
+        length += (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000);
+    }
+
+    return length;
+}
+
+/*
+    Copies the UTF-32 code points at the start of the array to UTF-8 for as
+    long as they are ASCII, and returns the number of code points copied.
+*/
+size_t narrowAsciiPrefix(const char32_t* utf32String, const size_t stringLength,
+                         char* utf8String)
+{
+    size_t index = 0;
+
+#ifdef CEGUI_STRING_USE_SSE2
+    const __m128i nonAsciiBits = _mm_set1_epi32(~0x7F);
+    for (; index + 16 <= stringLength; index += 16)
+    {
+        const __m128i* in = reinterpret_cast<const __m128i*>(utf32String + index);
+        const __m128i first = _mm_loadu_si128(in);
+        const __m128i second = _mm_loadu_si128(in + 1);
+        const __m128i third = _mm_loadu_si128(in + 2);
+        const __m128i fourth = _mm_loadu_si128(in + 3);
+
+        const __m128i all = _mm_or_si128(_mm_or_si128(first, second),
+                                         _mm_or_si128(third, fourth));
+        const __m128i nonAscii = _mm_and_si128(all, nonAsciiBits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(nonAscii, _mm_setzero_si128())) != 0xFFFF)
+            break;
+
+        // all values are below 0x80, so the saturating packs are exact
+        const __m128i codeUnits = _mm_packus_epi16(_mm_packs_epi32(first, second),
+                                                   _mm_packs_epi32(third, fourth));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf8String + index), codeUnits);
+    }
+#endif
+
+    for (; index < stringLength && utf32String[index] < 0x80; ++index)
+        utf8String[index] = static_cast<char>(utf32String[index]);
+
+    return index;
+}
+
+//! Encodes a code point that is not ASCII and returns the end of the written code units.
+char* encodeNonAsciiCodePoint(const char32_t codePoint, char* utf8String)
+{
+    // Check if the UTF-32 code unit can be represented by two UTF-8 code-units
+    if (codePoint < 0x800)
+    {
+        *utf8String++ = static_cast<char>((codePoint >> 6)   | 0xC0);
+        *utf8String++ = static_cast<char>((codePoint & 0x3F) | 0x80);
+    }
+    // Check if the UTF-32 code unit can be represented by three UTF-8 code-units
+    else if (codePoint < 0x10000)
+    {
+        *utf8String++ = static_cast<char>((codePoint  >> 12)         | 0xE0);
+        *utf8String++ = static_cast<char>(((codePoint >> 6)  & 0x3F) | 0x80);
+        *utf8String++ = static_cast<char>((codePoint         & 0x3F) | 0x80);
+    }
+    // Otherwise the UTF-32 code unit can only be represented by four UTF-8 code-units
+    else
+    {
+        *utf8String++ = static_cast<char>((codePoint  >> 18)         | 0xF0);
+        *utf8String++ = static_cast<char>(((codePoint >> 12) & 0x3F) | 0x80);
+        *utf8String++ = static_cast<char>(((codePoint >> 6)  & 0x3F) | 0x80);
+        *utf8String++ = static_cast<char>((codePoint         & 0x3F) | 0x80);
+    }
+
+    return utf8String;
+}
+
+}
+
 std::u32string String::convertUtf8ToUtf32(const char* utf8String)
 {
     if(utf8String == nullptr)
@@ -70,22 +254,37 @@ std::u32string String::convertUtf8ToUtf32(const char* utf8String, const size_t s
     if (utf8String == nullptr)
         return std::u32string();
 
-    std::u32string utf32String;
+    std::u32string utf32String(getUtf8LeadCodeUnitCount(utf8String, stringLength),
+                               U'\0');
+    char32_t* const utf32Start = &utf32String[0];
+    char32_t* currentCodePoint = utf32Start;
 
-    // Go through every UTF-8 code unit
     size_t currentCharIndex = 0;
     while (currentCharIndex < stringLength)
     {
-        size_t remainingCodeUnits = stringLength - currentCharIndex;
-        size_t usedCodeUnits;
-        char32_t utf32CodePoint = getCodePointFromCodeUnits(utf8String + currentCharIndex,
+        // Copy runs of ASCII code units in bulk
+        const size_t asciiLength = getAsciiPrefixLength(
+            utf8String + currentCharIndex, stringLength - currentCharIndex);
+        widenAscii(utf8String + currentCharIndex, asciiLength, currentCodePoint);
+        currentCharIndex += asciiLength;
+        currentCodePoint += asciiLength;
+
+        // Decode the code points up until the next ASCII code unit
+        while (currentCharIndex < stringLength &&
+               (static_cast<unsigned char>(utf8String[currentCharIndex]) & 0x80) != 0)
+        {
+            size_t remainingCodeUnits = stringLength - currentCharIndex;
+            size_t usedCodeUnits;
+            *currentCodePoint++ = getCodePointFromCodeUnits(utf8String + currentCharIndex,
                                                             remainingCodeUnits,
                                                             usedCodeUnits);
-        currentCharIndex += usedCodeUnits;
-
-        utf32String.push_back(utf32CodePoint);
+            currentCharIndex += usedCodeUnits;
+        }
     }
 
+    // Invalid sequences may have consumed code units counted as code points
+    utf32String.resize(currentCodePoint - utf32Start);
+
     return utf32String;
 }
 
@@ -121,37 +320,23 @@ std::string String::convertUtf32ToUtf8(const char32_t* utf32String, const size_t
     if (utf32String == nullptr)
         return std::string();
 
-    std::string utf8EncodedString;
-    
-    // Go through every UTF-32 code unit
-    for (size_t currentCharIndex = 0; currentCharIndex < stringLength; ++currentCharIndex)
-    {
-        const char32_t& currentCodeUnit = utf32String[currentCharIndex];
+    std::string utf8EncodedString(getUtf8EncodedLength(utf32String, stringLength), '\0');
+    char* currentCodeUnit = &utf8EncodedString[0];
 
-        // Check if the UTF-32 code unit can be represented by a single UTF-8 code-unit
-        if (currentCodeUnit < 0x80) 
-            utf8EncodedString.push_back(static_cast<char>(currentCodeUnit));
-        // Check if the UTF-32 code unit can be represented by two UTF-8 code-units
-        else if (currentCodeUnit < 0x800)
-        {
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit >> 6)   | 0xC0));
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit & 0x3F) | 0x80));
-        }
-        // Check if the UTF-32 code unit can be represented by three UTF-8 code-units
-        else if (currentCodeUnit < 0x10000)
-        {
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit  >> 12)         | 0xE0));
-            utf8EncodedString.push_back(static_cast<char>(((currentCodeUnit >> 6)  & 0x3F) | 0x80));
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit         & 0x3F) | 0x80));
-        }
-        // Otherwise the UTF-32 code unit can only be represented by four UTF-8 code-units
-        else
-        {
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit  >> 18)         | 0xF0));
-            utf8EncodedString.push_back(static_cast<char>(((currentCodeUnit >> 12) & 0x3F) | 0x80));
-            utf8EncodedString.push_back(static_cast<char>(((currentCodeUnit >> 6)  & 0x3F) | 0x80));
-            utf8EncodedString.push_back(static_cast<char>((currentCodeUnit         & 0x3F) | 0x80));
-        }
+    size_t currentCharIndex = 0;
+    while (currentCharIndex < stringLength)
+    {
+        // Copy runs of ASCII code points in bulk
+        const size_t asciiLength = narrowAsciiPrefix(
+            utf32String + currentCharIndex, stringLength - currentCharIndex,
+            currentCodeUnit);
+        currentCharIndex += asciiLength;
+        currentCodeUnit += asciiLength;
+
+        // Encode the code points up until the next ASCII one
+        while (currentCharIndex < stringLength && utf32String[currentCharIndex] >= 0x80)
+            currentCodeUnit = encodeNonAsciiCodePoint(utf32String[currentCharIndex++],
+                                                      currentCodeUnit);
     }
 
     return utf8EncodedString;
@@ -49,11 +49,11 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/GUIContext.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/RenderStats.h"
 #include "CEGUI/DefaultResourceProvider.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/widgets/All.h"
 #include "CEGUI/RegexMatcher.h"
-#include "CEGUI/SharedStringStream.h"
 #include "CEGUI/svg/SVGDataManager.h"
 #if defined(CEGUI_HAS_PCRE_REGEX)
 #   include "CEGUI/PCRERegexMatcher.h"
@@ -126,6 +126,7 @@ System::System(Renderer& renderer,
   d_ourResourceProvider(false),
   d_clipboard(new Clipboard()),
   d_nativeClipboardProvider(nullptr),
+  d_renderStats(new RenderStats()),
   d_scriptModule(scriptModule),
   d_xmlParser(xmlParser),
   d_ourXmlParser(false),
@@ -220,7 +221,7 @@ System::System(Renderer& renderer,
     // add the window factories for the core window types
     addStandardWindowFactories();
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
     logger.logEvent("CEGUI::System Singleton created. (" + addressStr + ")");
     logger.logEvent("---- CEGUI System initialisation completed ----");
     logger.logEvent("");
@@ -302,7 +303,7 @@ System::~System(void)
     if (d_ourResourceProvider)
         delete d_resourceProvider;
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
     Logger::getSingleton().logEvent("CEGUI::System singleton destroyed. " + addressStr);
     Logger::getSingleton().logEvent("---- CEGUI System destruction completed ----");
 
@@ -313,6 +314,7 @@ System::~System(void)
 #endif
 
     delete d_clipboard;
+    delete d_renderStats;
 }
 
 //---------------------------------------------------------------------------//
@@ -413,6 +415,7 @@ const String& System::getVerboseVersion()
 //----------------------------------------------------------------------------//
 void System::renderAllGUIContexts()
 {
+    d_renderStats->beginFrame();
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -423,6 +426,7 @@ void System::renderAllGUIContexts()
     }
 
     d_renderer->endRendering();
+    d_renderStats->endFrame();
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
@@ -430,6 +434,7 @@ void System::renderAllGUIContexts()
 
 void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 {
+    d_renderStats->beginFrame();
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -442,6 +447,7 @@ void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
     }
 
     d_renderer->endRendering();
+    d_renderStats->endFrame();
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
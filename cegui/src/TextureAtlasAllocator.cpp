@@ -0,0 +1,183 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the texture atlas allocators
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureAtlasAllocator.h"
+#include <algorithm>
+#include <limits>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+TextureAtlasAllocator::TextureAtlasAllocator(int width, int height) :
+    d_width(width),
+    d_height(height),
+    d_allocatedArea(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+TextureAtlasAllocator::~TextureAtlasAllocator()
+{
+}
+
+//----------------------------------------------------------------------------//
+void TextureAtlasAllocator::reset()
+{
+    d_allocatedArea = 0;
+}
+
+//----------------------------------------------------------------------------//
+float TextureAtlasAllocator::getOccupancy() const
+{
+    const long long area = static_cast<long long>(d_width) * d_height;
+
+    return area > 0 ? static_cast<float>(d_allocatedArea) / area : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+SkylineTextureAtlasAllocator::SkylineTextureAtlasAllocator(int width, int height) :
+    TextureAtlasAllocator(width, height)
+{
+    SkylineTextureAtlasAllocator::reset();
+}
+
+//----------------------------------------------------------------------------//
+void SkylineTextureAtlasAllocator::reset()
+{
+    TextureAtlasAllocator::reset();
+
+    d_skyline.clear();
+    const SkylineNode ground = { 0, 0, d_width };
+    d_skyline.push_back(ground);
+}
+
+//----------------------------------------------------------------------------//
+bool SkylineTextureAtlasAllocator::allocate(int width, int height,
+                                            int& x, int& y)
+{
+    if (width <= 0 || height <= 0)
+        return false;
+
+    // bottom-left heuristic: lowest top edge first, then least wasted width
+    size_t best_index = d_skyline.size();
+    int best_bottom = std::numeric_limits<int>::max();
+    int best_width = std::numeric_limits<int>::max();
+    int best_y = 0;
+
+    for (size_t i = 0; i < d_skyline.size(); ++i)
+    {
+        const int fit_y = fitAt(i, width, height);
+        if (fit_y < 0)
+            continue;
+
+        const int bottom = fit_y + height;
+        if (bottom < best_bottom ||
+            (bottom == best_bottom && d_skyline[i].d_width < best_width))
+        {
+            best_index = i;
+            best_bottom = bottom;
+            best_width = d_skyline[i].d_width;
+            best_y = fit_y;
+        }
+    }
+
+    if (best_index == d_skyline.size())
+        return false;
+
+    x = d_skyline[best_index].d_x;
+    y = best_y;
+    addNode(best_index, x, y, width, height);
+    d_allocatedArea += static_cast<long long>(width) * height;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+int SkylineTextureAtlasAllocator::fitAt(size_t index, int width, int height) const
+{
+    const int x = d_skyline[index].d_x;
+    if (x + width > d_width)
+        return -1;
+
+    // the rectangle rests on the highest of the segments it spans
+    int y = 0;
+    int remaining_width = width;
+    for (size_t i = index; remaining_width > 0; ++i)
+    {
+        y = std::max(y, d_skyline[i].d_y);
+        if (y + height > d_height)
+            return -1;
+
+        remaining_width -= d_skyline[i].d_width;
+    }
+
+    return y;
+}
+
+//----------------------------------------------------------------------------//
+void SkylineTextureAtlasAllocator::addNode(size_t index, int x, int y,
+                                           int width, int height)
+{
+    const SkylineNode node = { x, y + height, width };
+    d_skyline.insert(d_skyline.begin() + index, node);
+
+    // cut the segments now covered by the new one
+    const int right = x + width;
+    size_t i = index + 1;
+    while (i < d_skyline.size() && d_skyline[i].d_x < right)
+    {
+        SkylineNode& next = d_skyline[i];
+        const int next_right = next.d_x + next.d_width;
+
+        if (next_right <= right)
+        {
+            d_skyline.erase(d_skyline.begin() + i);
+            continue;
+        }
+
+        next.d_width = next_right - right;
+        next.d_x = right;
+        break;
+    }
+
+    // merge neighbours at the same height
+    for (i = 0; i + 1 < d_skyline.size();)
+    {
+        if (d_skyline[i].d_y == d_skyline[i + 1].d_y)
+        {
+            d_skyline[i].d_width += d_skyline[i + 1].d_width;
+            d_skyline.erase(d_skyline.begin() + i + 1);
+        }
+        else
+            ++i;
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
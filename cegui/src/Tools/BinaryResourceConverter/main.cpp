@@ -0,0 +1,94 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Command line tool converting XML resources to binary ones
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/BinaryResource.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/RendererModules/Null/Renderer.h"
+
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+//----------------------------------------------------------------------------//
+bool convert(const CEGUI::String& input, const std::string& output)
+{
+    CEGUI::BinaryResourceWriter writer;
+
+    try
+    {
+        // the kind of resource, and so its schema, is unknown here
+        CEGUI::System::getSingleton().getXMLParser()->parseXMLFile(
+            writer, input, "", "", false);
+    }
+    catch (CEGUI::Exception& e)
+    {
+        std::cerr << "Failed to read '" << input << "': " << e.getMessage() << "\n";
+        return false;
+    }
+
+    const std::vector<std::uint8_t> data(writer.getData());
+
+    std::ofstream file(output.c_str(), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+    if (!file)
+    {
+        std::cerr << "Failed to write '" << output << "'.\n";
+        return false;
+    }
+
+    std::cout << input << " -> " << output << " (" << data.size() << " bytes)\n";
+    return true;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+int main(int argc, char* argv[])
+{
+    if (argc < 3 || argc % 2 == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input> <output> [<input> <output> ...]\n"
+                     "Converts XML resource files (schemes, imagesets, looknfeels, "
+                     "fonts, layouts...) to binary resources, which CEGUI loads in "
+                     "their place.\n";
+        return 1;
+    }
+
+    CEGUI::NullRenderer::bootstrapSystem();
+
+    bool success = true;
+    for (int i = 1; i + 1 < argc; i += 2)
+        success &= convert(argv[i], argv[i + 1]);
+
+    CEGUI::NullRenderer::destroySystem();
+
+    return success ? 0 : 1;
+}
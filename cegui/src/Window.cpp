@@ -45,8 +45,9 @@
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/RenderTarget.h"
+#include "CEGUI/RenderStats.h"
 #include "CEGUI/GlobalEventSet.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/StreamHelper.h"
 #if defined (CEGUI_USE_FRIBIDI)
 #include "CEGUI/FribidiVisualMapping.h"
 #elif defined (CEGUI_USE_MINIBIDI)
@@ -57,7 +58,9 @@
 #endif
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <limits>
 #include <stdio.h>
 #include <queue>
 
@@ -104,46 +107,46 @@ const String Window::AutoWindowPropertyName("AutoWindow");
 const String Window::DrawModeMaskPropertyName("DrawModeMask");
 //----------------------------------------------------------------------------//
 const String Window::EventNamespace("Window");
-const String Window::EventUpdated ("Updated");
-const String Window::EventTextChanged("TextChanged");
-const String Window::EventFontChanged("FontChanged");
-const String Window::EventAlphaChanged("AlphaChanged");
-const String Window::EventIDChanged("IDChanged");
-const String Window::EventActivated("Activated");
-const String Window::EventDeactivated("Deactivated");
-const String Window::EventShown("Shown");
-const String Window::EventHidden("Hidden");
-const String Window::EventEnabled("Enabled");
-const String Window::EventDisabled("Disabled");
-const String Window::EventClippedByParentChanged( "ClippedByParentChanged" );
-const String Window::EventDestroyedByParentChanged("DestroyedByParentChanged");
-const String Window::EventInheritsAlphaChanged( "InheritsAlphaChanged" );
-const String Window::EventAlwaysOnTopChanged("AlwaysOnTopChanged");
-const String Window::EventInputCaptureGained( "InputCaptureGained" );
-const String Window::EventInputCaptureLost( "InputCaptureLost" );
-const String Window::EventInvalidated( "Invalidated" );
-const String Window::EventRenderingStarted( "RenderingStarted" );
-const String Window::EventRenderingEnded( "RenderingEnded" );
-const String Window::EventDestructionStarted( "DestructionStarted" );
-const String Window::EventDragDropItemEnters("DragDropItemEnters");
-const String Window::EventDragDropItemLeaves("DragDropItemLeaves");
-const String Window::EventDragDropItemDropped("DragDropItemDropped");
-const String Window::EventWindowRendererAttached("WindowRendererAttached");
-const String Window::EventWindowRendererDetached("WindowRendererDetached");
-const String Window::EventTextParsingChanged("TextParsingChanged");
-const String Window::EventMarginChanged("MarginChanged");
-const String Window::EventCursorEntersArea("CursorEntersArea");
-const String Window::EventCursorLeavesArea("CursorLeavesArea");
-const String Window::EventCursorEntersSurface("CursorEntersSurface");
-const String Window::EventCursorLeavesSurface("CursorLeavesSurface");
-const String Window::EventCursorMove("CursorMove");
-const String Window::EventCursorPressHold("CursorPressHold");
-const String Window::EventSelectWord("SelectWord");
-const String Window::EventSelectAll("SelectAll");
-const String Window::EventCursorActivate("CursorActivate");
-const String Window::EventCharacterKey("CharacterKey");
-const String Window::EventScroll("Scroll");
-const String Window::EventSemanticEvent("SemanticEvent");
+const EventId Window::EventUpdated ("Updated");
+const EventId Window::EventTextChanged("TextChanged");
+const EventId Window::EventFontChanged("FontChanged");
+const EventId Window::EventAlphaChanged("AlphaChanged");
+const EventId Window::EventIDChanged("IDChanged");
+const EventId Window::EventActivated("Activated");
+const EventId Window::EventDeactivated("Deactivated");
+const EventId Window::EventShown("Shown");
+const EventId Window::EventHidden("Hidden");
+const EventId Window::EventEnabled("Enabled");
+const EventId Window::EventDisabled("Disabled");
+const EventId Window::EventClippedByParentChanged( "ClippedByParentChanged" );
+const EventId Window::EventDestroyedByParentChanged("DestroyedByParentChanged");
+const EventId Window::EventInheritsAlphaChanged( "InheritsAlphaChanged" );
+const EventId Window::EventAlwaysOnTopChanged("AlwaysOnTopChanged");
+const EventId Window::EventInputCaptureGained( "InputCaptureGained" );
+const EventId Window::EventInputCaptureLost( "InputCaptureLost" );
+const EventId Window::EventInvalidated( "Invalidated" );
+const EventId Window::EventRenderingStarted( "RenderingStarted" );
+const EventId Window::EventRenderingEnded( "RenderingEnded" );
+const EventId Window::EventDestructionStarted( "DestructionStarted" );
+const EventId Window::EventDragDropItemEnters("DragDropItemEnters");
+const EventId Window::EventDragDropItemLeaves("DragDropItemLeaves");
+const EventId Window::EventDragDropItemDropped("DragDropItemDropped");
+const EventId Window::EventWindowRendererAttached("WindowRendererAttached");
+const EventId Window::EventWindowRendererDetached("WindowRendererDetached");
+const EventId Window::EventTextParsingChanged("TextParsingChanged");
+const EventId Window::EventMarginChanged("MarginChanged");
+const EventId Window::EventCursorEntersArea("CursorEntersArea");
+const EventId Window::EventCursorLeavesArea("CursorLeavesArea");
+const EventId Window::EventCursorEntersSurface("CursorEntersSurface");
+const EventId Window::EventCursorLeavesSurface("CursorLeavesSurface");
+const EventId Window::EventCursorMove("CursorMove");
+const EventId Window::EventCursorPressHold("CursorPressHold");
+const EventId Window::EventSelectWord("SelectWord");
+const EventId Window::EventSelectAll("SelectAll");
+const EventId Window::EventCursorActivate("CursorActivate");
+const EventId Window::EventCharacterKey("CharacterKey");
+const EventId Window::EventScroll("Scroll");
+const EventId Window::EventSemanticEvent("SemanticEvent");
 
 //----------------------------------------------------------------------------//
 // XML element and attribute names that relate to Window.
@@ -231,6 +234,11 @@ Window::Window(const String& type, const String& name):
     d_windowRenderer(nullptr),
     d_surface(nullptr),
     d_needsRedraw(true),
+    d_hasUnclippedGeometry(false),
+    d_lookHasUnclippedImagery(false),
+    d_lookUnclippedImageryRevision(0),
+    d_geometryCulled(false),
+    d_geometryRenderSettingsPending(false),
     d_autoRenderingWindow(false),
     d_autoRenderingSurfaceStencilEnabled(false),
     d_cursor(nullptr),
@@ -270,6 +278,7 @@ Window::Window(const String& type, const String& name):
     // user specific data
     d_ID(0),
     d_userData(nullptr),
+    d_userSubscriptionSerial(0),
 
     // z-order related options
     d_alwaysOnTop(false),
@@ -299,11 +308,13 @@ Window::Window(const String& type, const String& name):
     d_outerRectClipper(0, 0, 0, 0),
     d_innerRectClipper(0, 0, 0, 0),
     d_hitTestRect(0, 0, 0, 0),
+    d_hitTestBounds(0, 0, 0, 0),
 
     // cached pixel rect validity flags
     d_outerRectClipperValid(false),
     d_innerRectClipperValid(false),
     d_hitTestRectValid(false),
+    d_hitTestBoundsValid(false),
 
     // Initial update mode
     d_updateMode(WindowUpdateMode::Visible),
@@ -416,8 +427,9 @@ Window* Window::getChild(unsigned int id) const
         if (getChildAtIndex(i)->getID() == id)
             return getChildAtIndex(i);
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-    sstream << std::hex << id << std::dec;
+    std::stringstream sstream;
+    prepareStream(sstream);
+    sstream << std::hex << id;
 
     throw UnknownObjectException("A Window with ID: '" +
         sstream.str() + "' is not attached to Window '" + d_name + "'.");
@@ -570,6 +582,59 @@ const Rectf& Window::getHitTestRect() const
     return d_hitTestRect;
 }
 
+//----------------------------------------------------------------------------//
+const Rectf& Window::getHitTestBounds() const
+{
+    if (d_hitTestBoundsValid)
+        return d_hitTestBounds;
+
+    if (d_surface && d_surface->isRenderingWindow())
+    {
+        const float limit = std::numeric_limits<float>::max();
+        d_hitTestBounds = Rectf(-limit, -limit, limit, limit);
+    }
+    else
+    {
+        d_hitTestBounds = getHitTestRect();
+
+        for (const Window* child : d_drawList)
+        {
+            if (!child->isVisible())
+                continue;
+
+            const Rectf& bounds = child->getHitTestBounds();
+            if (bounds.getWidth() <= 0.0f || bounds.getHeight() <= 0.0f)
+                continue;
+
+            if (d_hitTestBounds.getWidth() <= 0.0f ||
+                d_hitTestBounds.getHeight() <= 0.0f)
+            {
+                d_hitTestBounds = bounds;
+            }
+            else
+            {
+                d_hitTestBounds = Rectf(
+                    glm::min(d_hitTestBounds.d_min, bounds.d_min),
+                    glm::max(d_hitTestBounds.d_max, bounds.d_max));
+            }
+        }
+    }
+
+    d_hitTestBoundsValid = true;
+    return d_hitTestBounds;
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateHitTestBounds()
+{
+    // an invalid window always has invalid ancestors, so stop at the first one
+    for (Window* wnd = this; wnd && wnd->d_hitTestBoundsValid;
+         wnd = wnd->getParent())
+    {
+        wnd->d_hitTestBoundsValid = false;
+    }
+}
+
 //----------------------------------------------------------------------------//
 Window* Window::getCaptureWindow() const
 {
@@ -668,6 +733,10 @@ Window* Window::getChildAtPosition(const glm::vec2& position,
 
     for (child = d_drawList.rbegin(); child != end; ++child)
     {
+        // skip whole subtrees that can not contain a hit
+        if (!(*child)->getHitTestBounds().isPointInRectf(p))
+            continue;
+
         if ((*child)->isEffectiveVisible())
         {
             // recursively scan for hit on children of this child window...
@@ -733,6 +802,10 @@ void Window::setVisible(bool setting)
         return;
 
     d_visible = setting;
+
+    if (d_parent)
+        getParent()->invalidateHitTestBounds();
+
     WindowEventArgs args(this);
     d_visible ? onShown(args) : onHidden(args);
 
@@ -1248,6 +1321,19 @@ void Window::draw(std::uint32_t drawModeMask)
     if (!isEffectiveVisible())
         return;
 
+    // skip the whole subtree if the parent knows it is out of view
+    if (d_parent && getParent()->isChildCulled(*this) &&
+        isDrawingConfinedToParent())
+    {
+        d_geometryCulled = true;
+        return;
+    }
+
+    RenderStats& stats = System::getSingleton().getRenderStats();
+    RenderStats::ScopedTimer timer(stats, RenderStatsTimer::WindowDraw);
+    if (stats.isEnabled())
+        stats.addWindowDrawn();
+
     // get rendering context
     RenderingContext ctx;
     getRenderingContext(ctx);
@@ -1261,8 +1347,12 @@ void Window::draw(std::uint32_t drawModeMask)
     // redraw if no surface set, or if surface is invalidated
     if (!d_surface || d_surface->isInvalidated())
     {
-        if(allowDrawing)
+        d_geometryCulled = allowDrawing && isGeometryCulled();
+        if (allowDrawing && !d_geometryCulled)
         {
+            if (d_geometryRenderSettingsPending)
+                updateGeometryRenderSettings();
+
             // perform drawing for 'this' Window
             drawSelf(ctx, drawModeMask);
         }
@@ -1291,11 +1381,85 @@ void Window::drawSelf(const RenderingContext& ctx, std::uint32_t drawModeMask)
     queueGeometry(ctx);
 }
 
+//----------------------------------------------------------------------------//
+bool Window::isGeometryCulled() const
+{
+    if (d_hasUnclippedGeometry || lookHasUnclippedImagery())
+        return false;
+
+    const Rectf& clipper = getOuterRectClipper();
+    return clipper.getWidth() <= 0.0f || clipper.getHeight() <= 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::lookHasUnclippedImagery() const
+{
+    // the look may have been redefined since it was assigned
+    if (d_lookUnclippedImageryRevision !=
+        WidgetLookManager::getSingleton().getRevision())
+        updateLookHasUnclippedImagery();
+
+    return d_lookHasUnclippedImagery;
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateLookHasUnclippedImagery() const
+{
+    const WidgetLookManager& wlMgr = WidgetLookManager::getSingleton();
+    d_lookUnclippedImageryRevision = wlMgr.getRevision();
+
+    // imagery drawn outside of the window prevents culling it
+    d_lookHasUnclippedImagery = false;
+    if (d_lookName.empty() || !wlMgr.isWidgetLookAvailable(d_lookName))
+        return;
+
+    const WidgetLookFeel& wlf = wlMgr.getWidgetLook(d_lookName);
+    const WidgetLookFeel::StringSet states(wlf.getStateImageryNames());
+    for (WidgetLookFeel::StringSet::const_iterator state = states.begin();
+         state != states.end() && !d_lookHasUnclippedImagery; ++state)
+    {
+        d_lookHasUnclippedImagery = wlf.getStateImagery(*state).isClippedToDisplay();
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isChildCulled(const Window&) const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isDrawingConfinedToParent() const
+{
+    if (!d_clippedByParent || d_surface ||
+        d_hasUnclippedGeometry || lookHasUnclippedImagery())
+        return false;
+
+    const size_t child_count = getChildCount();
+    for (size_t i = 0; i < child_count; ++i)
+    {
+        if (!getChildAtIndex(i)->isDrawingConfinedToParent())
+            return false;
+    }
+
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void Window::bufferGeometry(const RenderingContext&, std::uint32_t drawModeMask)
 {
     if (d_needsRedraw)
     {
+        RenderStats& stats = System::getSingleton().getRenderStats();
+        RenderStats::ScopedTimer timer(stats, RenderStatsTimer::BufferGeometry);
+
+        // the clock is only read when the time of each window is recorded
+        const bool time_window =
+            stats.isEnabled() && stats.isWindowStatsEnabled();
+        std::chrono::steady_clock::time_point start_time;
+        if (time_window)
+            start_time = std::chrono::steady_clock::now();
+
         // dispose of already cached geometry.
         destroyGeometryBuffers();
 
@@ -1316,12 +1480,29 @@ void Window::bufferGeometry(const RenderingContext&, std::uint32_t drawModeMask)
 
         updateGeometryBuffersAlpha();
 
+        d_hasUnclippedGeometry = false;
+        for (const GeometryBuffer* buffer : d_geometryBuffers)
+            d_hasUnclippedGeometry |= !buffer->isClippingActive();
+
         // signal rendering ended
         args.handled = 0;
         onRenderingEnded(args);
 
         // mark ourselves as no longer needed a redraw.
         d_needsRedraw = false;
+
+        if (stats.isEnabled())
+        {
+            size_t vertex_count = 0;
+            for (size_t i = 0; i < d_geometryBuffers.size(); ++i)
+                vertex_count += d_geometryBuffers[i]->getVertexCount();
+
+            const std::chrono::duration<double> time = time_window ?
+                std::chrono::steady_clock::now() - start_time :
+                std::chrono::steady_clock::duration::zero();
+
+            stats.addWindowRebuffered(*this, time.count(), vertex_count);
+        }
     }
 }
 
@@ -1342,9 +1523,10 @@ void Window::setParent(Element* parent)
 //----------------------------------------------------------------------------//
 void Window::cleanupChildren(void)
 {
+    // take the children from the back, so each removal is O(1)
     while (getChildCount() != 0)
     {
-        Window* wnd = static_cast<Window*>(d_children[0]);
+        Window* wnd = static_cast<Window*>(d_children.back());
 
         // always remove child
         removeChild(wnd);
@@ -1371,7 +1553,20 @@ void Window::addChild_impl(Element* element)
 
     NamedElement::addChild_impl(wnd);
 
+    // a dimension may now find a child it could not resolve before
+    invalidateDimensionReferences();
+
     addWindowToDrawList(*wnd);
+    invalidateHitTestBounds();
+
+    // layout deferred while the window was elsewhere is now ours to flush
+    if (wnd->d_layoutPending || wnd->d_screenAreaPending ||
+        wnd->d_childLayoutPending)
+    {
+        markChildLayoutPending();
+        if (GUIContext* context = getGUIContextPtr())
+            context->markLayoutDirty();
+    }
 
     wnd->invalidate(true);
 
@@ -1389,9 +1584,13 @@ void Window::removeChild_impl(Element* element)
 
     // remove from draw list
     removeWindowFromDrawList(*wnd);
+    invalidateHitTestBounds();
 
     NamedElement::removeChild_impl(wnd);
 
+    // dimensions must not keep referencing the removed child
+    invalidateDimensionReferences();
+
     wnd->onZChange_impl();
 
     // Removed windows should not be active anymore (they are not attached
@@ -2071,6 +2270,15 @@ void Window::markCachedWindowRectsInvalid()
     d_outerRectClipperValid = false;
     d_innerRectClipperValid = false;
     d_hitTestRectValid = false;
+    invalidateHitTestBounds();
+
+    // the render queues lack culled geometry, so they must be rebuilt
+    if (d_geometryCulled)
+    {
+        d_geometryCulled = false;
+        if (GUIContext* context = getGUIContextPtr())
+            context->markAsDirty();
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -2099,13 +2307,15 @@ void Window::setLookNFeel(const String& look)
     }
 
     d_lookName = look;
-    Logger::getSingleton().logEvent("Assigning LookNFeel '" + look +
-        "' to window '" + d_name + "'.", LoggingLevel::Informative);
+    CEGUI_LOG(LoggingLevel::Informative, "Assigning LookNFeel '" + look +
+        "' to window '" + d_name + "'.");
 
     // Work to initialise the look and feel...
     const WidgetLookFeel& wlf = wlMgr.getWidgetLook(look);
     // Get look and feel to initialise the widget as it needs.
     wlf.initialiseWidget(*this);
+
+    updateLookHasUnclippedImagery();
     // do the necessary binding to the stuff added by the look and feel
     initialiseComponents();
     // let the window renderer know about this
@@ -2154,6 +2364,63 @@ void Window::performChildWindowLayout(const bool nonclient_sized_hint,
     notifyChildrenOfSizeChange(outer_changed, inner_changed);
 }
 
+//----------------------------------------------------------------------------//
+void Window::performPendingLayout(bool screen_area_updated)
+{
+    // one recursive update covers every descendant with a deferred one
+    if ((d_layoutPending || d_screenAreaPending) && !screen_area_updated)
+    {
+        notifyScreenAreaChanged(true);
+        screen_area_updated = true;
+    }
+
+    d_screenAreaPending = false;
+
+    if (d_layoutPending)
+    {
+        d_layoutPending = false;
+        performChildWindowLayout(true, true);
+    }
+
+    if (!d_childLayoutPending)
+        return;
+
+    d_childLayoutPending = false;
+
+    for (size_t i = 0; i < getChildCount(); ++i)
+        getChildAtIndex(i)->performPendingLayout(screen_area_updated);
+}
+
+//----------------------------------------------------------------------------//
+bool Window::deferLayout(bool sized)
+{
+    GUIContext* const context = getGUIContextPtr();
+
+    // while the context flushes, layout cascades as it always did
+    if (!context || !context->isDeferredLayoutEnabled() ||
+        context->isFlushingLayout())
+        return false;
+
+    if (sized)
+        d_layoutPending = true;
+    else
+        d_screenAreaPending = true;
+
+    if (d_parent)
+        getParent()->markChildLayoutPending();
+
+    context->markLayoutDirty();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void Window::markChildLayoutPending()
+{
+    for (Window* wnd = this; wnd && !wnd->d_childLayoutPending;
+         wnd = wnd->getParent())
+        wnd->d_childLayoutPending = true;
+}
+
 //----------------------------------------------------------------------------//
 void Window::layoutLookNFeelChildWidgets()
 {
@@ -2388,13 +2655,14 @@ void Window::removeWindowFromDrawList(const Window& wnd)
     // if draw list is not empty
     if (!d_drawList.empty())
     {
-        // attempt to find the window in the draw list
-        const ChildDrawList::iterator position =
-            std::find(d_drawList.begin(), d_drawList.end(), &wnd);
+        // attempt to find the window in the draw list, searching from the
+        // back as that is where windows being removed usually are.
+        const ChildDrawList::reverse_iterator position =
+            std::find(d_drawList.rbegin(), d_drawList.rend(), &wnd);
 
         // remove the window if it was found in the draw list
-        if (position != d_drawList.end())
-            d_drawList.erase(position);
+        if (position != d_drawList.rend())
+            d_drawList.erase(std::next(position).base());
     }
 }
 
@@ -2447,8 +2715,16 @@ void Window::onSized_impl(ElementEventArgs& e)
     // screen area changes when we're resized.
     // NB: Called non-recursive since the performChildWindowLayout call should
     // have dealt more selectively with child Window cases.
-    notifyScreenAreaChanged(true);
-    performChildWindowLayout(true, true);
+    // When the GUIContext defers layout, only our own rects are updated here
+    // and the children are laid out once by GUIContext::flushLayout.
+    if (deferLayout(true))
+        notifyScreenAreaChanged(false);
+    else
+    {
+        d_layoutPending = false;
+        notifyScreenAreaChanged(true);
+        performChildWindowLayout(true, true);
+    }
 
     invalidate();
 
@@ -2458,7 +2734,16 @@ void Window::onSized_impl(ElementEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onMoved(ElementEventArgs& e)
 {
-    Element::onMoved(e);
+    if (deferLayout(false))
+    {
+        notifyScreenAreaChanged(false);
+        fireEvent(EventMoved, e, Element::EventNamespace);
+    }
+    else
+    {
+        d_screenAreaPending = false;
+        Element::onMoved(e);
+    }
 
     // handle invalidation of surfaces and trigger needed redraws
     if (d_parent)
@@ -2747,6 +3032,33 @@ void Window::onChildRemoved(ElementEventArgs& e)
     Element::onChildRemoved(e);
 }
 
+//----------------------------------------------------------------------------//
+void Window::resetForReuse()
+{
+    for (size_t i = 0; i < getChildCount(); ++i)
+    {
+        Window* const child = getChildAtIndex(i);
+        if (child->isAutoWindow())
+            child->resetForReuse();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateDimensionReferences()
+{
+    for (Window* wnd = this; wnd; wnd = wnd->getParent())
+        wnd->d_dimensionReferenceCache.invalidate();
+}
+
+//----------------------------------------------------------------------------//
+void Window::onNameChanged(NamedElementEventArgs& e)
+{
+    // child name paths resolved by dimensions may refer to other windows now
+    invalidateDimensionReferences();
+
+    NamedElement::onNameChanged(e);
+}
+
 //----------------------------------------------------------------------------//
 void Window::onCursorEntersArea(CursorInputEventArgs& e)
 {
@@ -3008,12 +3320,15 @@ void Window::setWindowRenderer(const String& name)
         WindowEventArgs e(this);
         onWindowRendererDetached(e);
         wrm.destroyWindowRenderer(d_windowRenderer);
+
+        // the properties of the window renderer are gone
+        invalidateDimensionReferences();
     }
 
     if (!name.empty())
     {
-        Logger::getSingleton().logEvent("Assigning the window renderer '" +
-            name + "' to the window '" + d_name + "'", LoggingLevel::Informative);
+        CEGUI_LOG(LoggingLevel::Informative, "Assigning the window renderer '" +
+            name + "' to the window '" + d_name + "'");
         d_windowRenderer = wrm.createWindowRenderer(name);
         WindowEventArgs e(this);
         onWindowRendererAttached(e);
@@ -3228,15 +3543,23 @@ void Window::notifyClippingChanged(void)
 //----------------------------------------------------------------------------//
 void Window::notifyScreenAreaChanged(bool recursive /* = true */)
 {
+    const bool culled = d_geometryCulled || d_geometryRenderSettingsPending;
+
     markCachedWindowRectsInvalid();
     Element::notifyScreenAreaChanged(recursive);
 
-    updateGeometryRenderSettings();
+    // geometry that is not queued gets updated when it is drawn again
+    if (culled && !d_surface)
+        d_geometryRenderSettingsPending = true;
+    else
+        updateGeometryRenderSettings();
 }
 
 //----------------------------------------------------------------------------//
 void Window::updateGeometryRenderSettings()
 {
+    d_geometryRenderSettingsPending = false;
+
     RenderingContext ctx;
     getRenderingContext(ctx);
 
@@ -3424,6 +3747,7 @@ void Window::setRenderingSurface(RenderingSurface* surface)
         setUsingAutoRenderingSurface(false);
 
     d_surface = surface;
+    invalidateHitTestBounds();
 
     // transfer child surfaces to this new surface
     if (d_surface)
@@ -3540,6 +3864,7 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
     }
 
     d_surface = &rs->createRenderingWindow(*t);
+    invalidateHitTestBounds();
     transferChildSurfaces();
 
     // set size and position of RenderingWindow
@@ -3562,6 +3887,7 @@ void Window::releaseRenderingWindow()
         static_cast<RenderingWindow*>(d_surface);
     d_autoRenderingWindow = false;
     d_surface = nullptr;
+    invalidateHitTestBounds();
     // detach child surfaces prior to destroying the owning surface
     transferChildSurfaces();
     // destroy surface and texture target it used
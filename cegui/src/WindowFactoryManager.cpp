@@ -29,7 +29,6 @@
 #include "CEGUI/WindowFactoryManager.h"
 #include "CEGUI/WindowFactory.h"
 #include "CEGUI/Exceptions.h"
-#include "CEGUI/SharedStringStream.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
@@ -46,7 +45,7 @@ WindowFactoryManager::OwnedWindowFactoryList WindowFactoryManager::d_ownedFactor
 //----------------------------------------------------------------------------//
 WindowFactoryManager::WindowFactoryManager(void)
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::WindowFactoryManager Singleton created. (" + addressStr + ")");
@@ -88,7 +87,7 @@ void WindowFactoryManager::addFactory(WindowFactory* factory)
 	// add the factory to the registry
 	d_factoryRegistry[factory->getTypeName()] = factory;
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(factory);
+    String addressStr = Logger::addressToString(factory);
 	Logger::getSingleton().logEvent("[WindowFactoryManager] WindowFactory for '" +
        factory->getTypeName() +"' windows added. (" + addressStr + ")");
 }
@@ -110,7 +109,7 @@ void WindowFactoryManager::removeFactory(const String& name)
                                                    d_ownedFactories.end(),
                                                    (*i).second);
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString((*i).second);
+    String addressStr = Logger::addressToString((*i).second);
 
 	d_factoryRegistry.erase(name);
 
@@ -314,7 +313,7 @@ void WindowFactoryManager::addFalagardWindowMapping(const String& newType,
         Logger::getSingleton().logEvent("Falagard mapping for type '" + newType + "' already exists - current mapping will be replaced.");
     }
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&mapping);
+    String addressStr = Logger::addressToString(&mapping);
     Logger::getSingleton().logEvent("Creating falagard mapping for type '" +
         newType + "' using base type '" + targetType + "', window renderer '" +
         renderer + "' Look'N'Feel '" + lookName + "' and RenderEffect '" +
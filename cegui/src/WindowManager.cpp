@@ -35,7 +35,9 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/RenderEffectManager.h"
 #include "CEGUI/RenderingWindow.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/widgets/Tooltip.h"
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -69,7 +71,7 @@ WindowManager::WindowManager(void) :
     d_uid_counter(0),
     d_lockCount(0)
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::WindowManager Singleton created. (" + addressStr + ")");
@@ -84,7 +86,11 @@ WindowManager::~WindowManager(void)
 	destroyAllWindows();
     cleanDeadPool();
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    for (WindowPoolMap::iterator iter = d_windowPools.begin();
+         iter != d_windowPools.end(); ++iter)
+        releaseInitialState(iter->second);
+
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::WindowManager singleton destroyed (" + addressStr + ")");
@@ -103,30 +109,56 @@ Window* WindowManager::createWindow(const String& type, const String& name)
 
     String finalName(name.empty() ? generateUniqueWindowName() : name);
 
-    WindowFactoryManager& wfMgr = WindowFactoryManager::getSingleton();
-    WindowFactory* factory = wfMgr.getFactory(type);
+    Window* newWindow;
+
+    WindowPoolMap::iterator pool = d_windowPools.find(type);
+    if (pool != d_windowPools.end())
+        discardStalePool(pool->second);
 
-    Window* newWindow = factory->createWindow(finalName);
+    if (pool != d_windowPools.end() && !pool->second.d_windows.empty())
+    {
+        // reuse a pooled window, which is already fully initialised
+        newWindow = pool->second.d_windows.back();
+        pool->second.d_windows.pop_back();
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(newWindow);
-    Logger::getSingleton().logEvent("Window '" + finalName +"' of type '" +
-        type + "' has been created. " + addressStr, LoggingLevel::Informative);
+        newWindow->setName(finalName);
 
-    // see if we need to assign a look to this window
-    if (wfMgr.isFalagardMappedType(type))
+        CEGUI_LOG(LoggingLevel::Informative, "Window '" + finalName +
+            "' of type '" + type + "' has been reused from the pool. " +
+            Logger::addressToString(newWindow));
+    }
+    else
     {
-        const WindowFactoryManager::FalagardWindowMapping& fwm = wfMgr.getFalagardMappingForType(type);
-        // this was a mapped type, so assign a look to the window so it can finalise
-        // its initialisation
-        newWindow->d_falagardType = type;
-        newWindow->setWindowRenderer(fwm.d_rendererType);
-        newWindow->setLookNFeel(fwm.d_lookName);
-
-        initialiseRenderEffect(newWindow, fwm.d_effectName);
+        WindowFactoryManager& wfMgr = WindowFactoryManager::getSingleton();
+        newWindow = wfMgr.getFactory(type)->createWindow(finalName);
+
+        CEGUI_LOG(LoggingLevel::Informative, "Window '" + finalName + "' of type '" +
+            type + "' has been created. " +
+            Logger::addressToString(newWindow));
+
+        // see if we need to assign a look to this window
+        if (wfMgr.isFalagardMappedType(type))
+        {
+            const WindowFactoryManager::FalagardWindowMapping& fwm = wfMgr.getFalagardMappingForType(type);
+            // this was a mapped type, so assign a look to the window so it can finalise
+            // its initialisation
+            newWindow->d_falagardType = type;
+            newWindow->setWindowRenderer(fwm.d_rendererType);
+            newWindow->setLookNFeel(fwm.d_lookName);
+
+            initialiseRenderEffect(newWindow, fwm.d_effectName);
+        }
+
+        if (pool != d_windowPools.end() && !pool->second.d_hasInitialState)
+            recordInitialState(pool->second, *newWindow);
     }
 
+    d_registryIndex[newWindow] = d_windowRegistry.size();
 	d_windowRegistry.push_back(newWindow);
 
+    // subscriptions made from now on are not the window's own
+    newWindow->d_userSubscriptionSerial = Event::getNextSubscriptionSerial();
+
     // fire event to notify interested parites about the new window.
     WindowEventArgs args(newWindow);
     fireEvent(EventWindowCreated, args, EventNamespace);
@@ -188,32 +220,34 @@ void WindowManager::initialiseRenderEffect(
 *************************************************************************/
 void WindowManager::destroyWindow(Window* window)
 {
-	WindowVector::iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
-
-    String addressStr = SharedStringstream::GetPointerAddressAsString(&window);
-
-	if (iter == d_windowRegistry.end())
+	if (!unregisterWindow(window))
     {
         Logger::getSingleton().logEvent("[WindowManager] Attempt to delete "
-            "Window that does not exist!  Address was: " + addressStr +
+            "Window that does not exist!  Address was: " +
+            Logger::addressToString(&window) +
             ". WARNING: This could indicate a double-deletion issue!!",
             LoggingLevel::Error);
         return;
     }
 
-    d_windowRegistry.erase(iter);
-
-    Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
-        "' will be added to dead pool. " + addressStr, LoggingLevel::Informative);
+    if (recycleWindow(window))
+    {
+        CEGUI_LOG(LoggingLevel::Informative, "Window at '" +
+            window->getNamePath() + "' has been returned to the pool. " +
+            Logger::addressToString(&window));
+    }
+    else
+    {
+        CEGUI_LOG(LoggingLevel::Informative, "Window at '" +
+            window->getNamePath() + "' will be added to dead pool. " +
+            Logger::addressToString(&window));
 
-    // do 'safe' part of cleanup
-    window->destroy();
+        // do 'safe' part of cleanup
+        window->destroy();
 
-    // add window to dead pool
-    d_deathrow.push_back(window);
+        // add window to dead pool
+        d_deathrow.push_back(window);
+    }
 
     // fire event to notify interested parites about window destruction.
     // TODO: Perhaps this should fire first, so window is still usable?
@@ -227,19 +261,290 @@ void WindowManager::destroyWindow(Window* window)
 *************************************************************************/
 void WindowManager::destroyAllWindows(void)
 {
+    clearWindowPools();
+
 	while (!d_windowRegistry.empty())
-		destroyWindow(*d_windowRegistry.begin());
+		destroyWindow(d_windowRegistry.back());
 }
 
 //----------------------------------------------------------------------------//
 bool WindowManager::isAlive(const Window* window) const
 {
-	WindowVector::const_iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
+	return d_registryIndex.find(window) != d_registryIndex.end();
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::setWindowPoolCapacity(const String& type, size_t capacity)
+{
+    if (capacity == 0)
+    {
+        WindowPoolMap::iterator iter = d_windowPools.find(type);
+        if (iter != d_windowPools.end())
+        {
+            destroyPooledWindows(iter->second);
+            releaseInitialState(iter->second);
+            d_windowPools.erase(iter);
+        }
+
+        return;
+    }
+
+    WindowPool& pool = d_windowPools[type];
+    pool.d_capacity = capacity;
+
+    while (pool.d_windows.size() > capacity)
+    {
+        Window* const window = pool.d_windows.back();
+        d_deathrow.push_back(window);
+        pool.d_windows.pop_back();
+        window->destroy();
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getWindowPoolCapacity(const String& type) const
+{
+    WindowPoolMap::const_iterator iter = d_windowPools.find(type);
+    return iter != d_windowPools.end() ? iter->second.d_capacity : 0;
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getPooledWindowCount(const String& type) const
+{
+    WindowPoolMap::const_iterator iter = d_windowPools.find(type);
+    return iter != d_windowPools.end() ? iter->second.d_windows.size() : 0;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::clearWindowPools()
+{
+    for (WindowPoolMap::iterator iter = d_windowPools.begin();
+         iter != d_windowPools.end(); ++iter)
+        destroyPooledWindows(iter->second);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::destroyPooledWindows(WindowPool& pool)
+{
+    // pooled windows are no longer registered, so destroy() performs the
+    // cleanup straight away.
+    while (!pool.d_windows.empty())
+    {
+        Window* const window = pool.d_windows.back();
+        d_deathrow.push_back(window);
+        pool.d_windows.pop_back();
+        window->destroy();
+    }
+}
+
+//----------------------------------------------------------------------------//
+namespace
+{
+//! Count the event subscriptions made to a window and its auto-windows before a serial.
+size_t countConnections(const Window& window, std::uint64_t serial)
+{
+    size_t count = 0;
+
+    for (EventSet::EventIterator iter = window.getEventIterator();
+         !iter.isAtEnd(); ++iter)
+        count += iter.getCurrentValue()->getConnectionCountBefore(serial);
+
+    for (size_t i = 0; i < window.getChildCount(); ++i)
+    {
+        const Window* const child = window.getChildAtIndex(i);
+        if (child->isAutoWindow())
+            count += countConnections(*child, serial);
+    }
+
+    return count;
+}
+
+//! Disconnect the subscriptions made to a window and its auto-windows from a serial on.
+void disconnectSubscriptions(const Window& window, std::uint64_t serial)
+{
+    for (EventSet::EventIterator iter = window.getEventIterator();
+         !iter.isAtEnd(); ++iter)
+        iter.getCurrentValue()->disconnectSubscriptionsFrom(serial);
+
+    for (size_t i = 0; i < window.getChildCount(); ++i)
+    {
+        const Window* const child = window.getChildAtIndex(i);
+        if (child->isAutoWindow())
+            disconnectSubscriptions(*child, serial);
+    }
+}
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::recordInitialState(WindowPool& pool, const Window& window)
+{
+    pool.d_lookName = window.getLookNFeel();
+    pool.d_lookRevision = WidgetLookManager::getSingleton().getRevision();
+    pool.d_windowRendererName = window.getWindowRendererName();
+    pool.d_connectionCount =
+        countConnections(window, Event::getNextSubscriptionSerial());
+
+    pool.d_userStringNames.clear();
+    for (const std::pair<const String, String>& user_string : window.d_userStrings)
+        pool.d_userStringNames.push_back(user_string.first);
+
+    releaseInitialState(pool);
+    for (PropertySet::PropertyIterator iter = window.getPropertyIterator();
+         !iter.isAtEnd(); ++iter)
+    {
+        Property* const property = iter.getCurrentValue();
+
+        if (!property->isReadable() || !property->isWritable())
+            continue;
+
+        // identity and appearance are not reset through properties
+        const String& name = property->getName();
+        if (name == "Name" || name == "LookNFeel" || name == "WindowRenderer")
+            continue;
+
+        // typed values are compared without converting them to strings
+        pool.d_propertyValues.push_back(property->prepareCurrentValue(&window));
+    }
+
+    pool.d_hasInitialState = true;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::releaseInitialState(WindowPool& pool)
+{
+    for (PreparedPropertyValue* value : pool.d_propertyValues)
+        delete value;
+
+    pool.d_propertyValues.clear();
+    pool.d_hasInitialState = false;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::discardStalePool(WindowPool& pool)
+{
+    if (!pool.d_hasInitialState ||
+        pool.d_lookRevision == WidgetLookManager::getSingleton().getRevision())
+        return;
+
+    // the recorded values refer to property definitions of a replaced look
+    destroyPooledWindows(pool);
+    releaseInitialState(pool);
+}
+
+//----------------------------------------------------------------------------//
+bool WindowManager::recycleWindow(Window* window)
+{
+    WindowPoolMap::iterator iter = d_windowPools.find(window->getType());
+    if (iter == d_windowPools.end())
+        return false;
+
+    WindowPool& pool = iter->second;
+    discardStalePool(pool);
+    if (!pool.d_hasInitialState || pool.d_windows.size() >= pool.d_capacity)
+        return false;
+
+    // auto-windows belong to their parent and are destroyed along with it
+    if (window->isAutoWindow() ||
+        window->getLookNFeel() != pool.d_lookName ||
+        window->getWindowRendererName() != pool.d_windowRendererName)
+        return false;
+
+    // the window must not have subscribed to itself since it was handed out,
+    // as those subscriptions are dropped below with the user's ones
+    const std::uint64_t user_serial = window->d_userSubscriptionSerial;
+    if (countConnections(*window, user_serial) != pool.d_connectionCount)
+        return false;
+
+    // observers are told the window goes away, as when it is destroyed
+    WindowEventArgs args(window);
+    window->fireEvent(Window::EventDestructionStarted, args, Window::EventNamespace);
+
+    // nothing subscribed by its last user may see the window come back to life
+    disconnectSubscriptions(*window, user_serial);
+
+    if (Window* const parent = window->getParent())
+        parent->removeChild(window);
+
+    // content the widget owns which is not reset through its properties
+    window->resetForReuse();
+
+    // destroy the content added to the window or to its auto-windows
+    std::vector<Window*> windows(1, window);
+    while (!windows.empty())
+    {
+        Window* const current = windows.back();
+        windows.pop_back();
+
+        for (size_t i = current->getChildCount(); i-- > 0;)
+        {
+            Window* const child = current->getChildAtIndex(i);
+
+            if (child->isAutoWindow())
+                windows.push_back(child);
+            else
+            {
+                current->removeChild(child);
+                if (child->isDestroyedByParent())
+                    destroyWindow(child);
+            }
+        }
+    }
+
+    window->releaseInput();
+
+    // let go of the tooltip if we have it
+    Tooltip* const tip = window->getTooltip();
+    if (tip && tip->getTargetWindow() == window)
+        tip->setTargetWindow(nullptr);
+
+    window->setGUIContext(nullptr);
+    window->setTooltip(static_cast<Tooltip*>(nullptr));
+    window->d_userData = nullptr;
+
+    // Falagard property definitions keep their values in user strings, which
+    // the property values below reset; only drop those added since.
+    Window::UserStringMap::iterator user_string = window->d_userStrings.begin();
+    while (user_string != window->d_userStrings.end())
+    {
+        if (std::find(pool.d_userStringNames.begin(), pool.d_userStringNames.end(),
+                      user_string->first) == pool.d_userStringNames.end())
+            user_string = window->d_userStrings.erase(user_string);
+        else
+            ++user_string;
+    }
+
+    for (const PreparedPropertyValue* value : pool.d_propertyValues)
+    {
+        if (!value->isApplied(window))
+            value->apply(window);
+    }
+
+    pool.d_windows.push_back(window);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowManager::unregisterWindow(const Window* window)
+{
+    RegistryIndex::iterator iter = d_registryIndex.find(window);
+
+    if (iter == d_registryIndex.end())
+        return false;
+
+    const size_t index = iter->second;
+    d_registryIndex.erase(iter);
+
+    // fill the gap with the last window rather than shifting all following
+    // ones down.
+    Window* const last = d_windowRegistry.back();
+    d_windowRegistry.pop_back();
+    if (last != window)
+    {
+        d_windowRegistry[index] = last;
+        d_registryIndex[last] = index;
+    }
 
-	return iter != d_windowRegistry.end();
+    return true;
 }
 
 Window* WindowManager::loadLayoutFromContainer(const RawDataContainer& source, PropertyCallback* callback, void* userdata)
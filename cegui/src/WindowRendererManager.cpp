@@ -26,7 +26,6 @@
  ***************************************************************************/
 #include "CEGUI/WindowRendererManager.h"
 #include "CEGUI/Exceptions.h"
-#include "CEGUI/SharedStringStream.h"
 #include <algorithm>
 
 // Start CEGUI namespace
@@ -56,7 +55,7 @@ WindowRendererManager* WindowRendererManager::getSingletonPtr(void)
 *************************************************************************/
 WindowRendererManager::WindowRendererManager()
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::WindowRendererManager Singleton created. (" + addressStr + ")");
@@ -76,7 +75,7 @@ WindowRendererManager::WindowRendererManager()
 
 WindowRendererManager::~WindowRendererManager()
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "CEGUI::WindowRendererManager Singleton destroyed (" + addressStr + ")");
@@ -117,7 +116,7 @@ void WindowRendererManager::addFactory(WindowRendererFactory* wr)
         throw AlreadyExistsException("A WindowRendererFactory named '"+wr->getName()+"' already exist");
     }
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString(wr);
+    String addressStr = Logger::addressToString(wr);
     Logger::getSingleton().logEvent("WindowRendererFactory '"+wr->getName()+
         "' added. " + addressStr);
 }
@@ -141,7 +140,7 @@ void WindowRendererManager::removeFactory(const String& name)
                                              d_ownedFactories.end(),
                                              (*i).second);
 
-    String addressStr = SharedStringstream::GetPointerAddressAsString((*i).second);
+    String addressStr = Logger::addressToString((*i).second);
 
     d_wrReg.erase(name);
 
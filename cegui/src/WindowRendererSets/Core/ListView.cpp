@@ -71,11 +71,24 @@ void FalagardListView::createRenderGeometry(ListView* list_view)
     Rectf items_area(getViewRenderArea());
     glm::vec2 item_pos(getItemRenderStartPosition(list_view, items_area));
 
-    for (size_t i = 0; i < list_view->getItems().size(); ++i)
+    // start with the first visible item and stop after the last visible one;
+    // virtualized items out of view are not even formatted.
+    size_t i = list_view->getItemPositionAtOffset(
+        list_view->getVertScrollbar()->getScrollPosition());
+    item_pos.y += list_view->getItemOffset(i);
+
+    const std::vector<ListViewItemRenderingState*>& items = list_view->getItems();
+    for (; i < items.size() && item_pos.y < items_area.bottom(); ++i)
     {
-        ListViewItemRenderingState* item = list_view->getItems().at(i);
+        ListViewItemRenderingState* item = items[i];
         Sizef size(item->d_size);
 
+        if (item->d_formattedString == nullptr)
+        {
+            item_pos.y += size.d_height;
+            continue;
+        }
+
         size.d_width = std::max(items_area.getWidth(), size.d_width);
 
         Rectf item_rect;
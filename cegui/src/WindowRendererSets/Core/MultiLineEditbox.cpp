@@ -137,15 +137,15 @@ void FalagardMultiLineEditbox::cacheCaretImagery(const Rectf& textArea)
         // get line that caret is in
         size_t caretLine = w->getLineNumberFromIndex(w->getCaretIndex());
 
-        const MultiLineEditbox::LineList& d_lines = w->getFormattedLines();
-
         // if caret line is valid.
-        if (caretLine < d_lines.size())
+        if (caretLine < w->getFormattedLineCount())
         {
+            const size_t lineStart = w->getFormattedLine(caretLine).d_startIdx;
+
             // calculate pixel offsets to where caret should be drawn
-            size_t caretLineIdx = w->getCaretIndex() - d_lines[caretLine].d_startIdx;
+            size_t caretLineIdx = w->getCaretIndex() - lineStart;
             float ypos = caretLine * fnt->getLineSpacing();
-            float xpos = fnt->getTextAdvance(w->getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
+            float xpos = fnt->getTextAdvance(w->getText(), lineStart, caretLineIdx);
 
             // get WidgetLookFeel for the assigned look.
             const WidgetLookFeel& wlf = getLookNFeel();
@@ -208,8 +208,7 @@ void FalagardMultiLineEditbox::cacheTextLines(const Rectf& dest_area)
     w->hasInputFocus() ? setColourRectToActiveSelectionColour(selectBrushCol) :
         setColourRectToInactiveSelectionColour(selectBrushCol);
 
-    const MultiLineEditbox::LineList& d_lines = w->getFormattedLines();
-    const size_t numLines = d_lines.size();
+    const size_t numLines = w->getFormattedLineCount();
 
     DefaultParagraphDirection defaultParagraphDir = w->getDefaultParagraphDirection();
 
@@ -224,7 +223,7 @@ void FalagardMultiLineEditbox::cacheTextLines(const Rectf& dest_area)
     for (size_t i = sidx; i < eidx; ++i)
     {
         Rectf lineRect(drawArea);
-        const MultiLineEditbox::LineInfo& currLine = d_lines[i];
+        const MultiLineEditbox::LineInfo currLine = w->getFormattedLine(i);
         String lineText(w->getTextVisual().substr(currLine.d_startIdx, currLine.d_length));
 
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
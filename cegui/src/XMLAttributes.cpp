@@ -26,7 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/Exceptions.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/StreamHelper.h"
 #include <sstream>
 #include <iterator>
 
@@ -168,8 +168,8 @@ namespace CEGUI
         }
 
         float val;
-        std::stringstream& strm = SharedStringstream::GetPreparedStream();
-        strm << getValue(attrName);
+        std::stringstream strm;
+        prepareStream(strm, getValue(attrName));
 
         strm >> val;
 
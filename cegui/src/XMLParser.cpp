@@ -25,6 +25,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/XMLParser.h"
+#include "CEGUI/BinaryResource.h"
 #include "CEGUI/DataContainer.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
@@ -64,8 +65,12 @@ namespace CEGUI
 
         try
         {
-            // The actual parsing action (this is overridden and depends on the specific parser)
-            parseXML(handler, rawXMLData, schemaName, allowXmlValidation);
+            // binary resources are replayed to the handler, no XML is involved
+            if (BinaryResource::isBinaryResource(rawXMLData.getDataPtr(), rawXMLData.getSize()))
+                BinaryResource::parse(handler, rawXMLData.getDataPtr(), rawXMLData.getSize());
+            else
+                // The actual parsing action (this is overridden and depends on the specific parser)
+                parseXML(handler, rawXMLData, schemaName, allowXmlValidation);
         }
         catch (const Exception&)
         {
@@ -0,0 +1,112 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the per window dimension reference cache
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/falagard/DimensionReferenceCache.h"
+#include "CEGUI/TypedProperty.h"
+#include "CEGUI/UDim.h"
+#include "CEGUI/URect.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+unsigned int DimensionReferenceCache::s_lastId = 0;
+
+//----------------------------------------------------------------------------//
+DimensionReferenceCache::DimensionReferenceCache() :
+    d_generation(0),
+    d_referencesGeneration(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+const DimensionReferenceCache::Reference* DimensionReferenceCache::find(
+    unsigned int id)
+{
+    dropInvalidated();
+
+    const ReferenceMap::const_iterator it = d_references.find(id);
+    return it != d_references.end() ? &it->second : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+DimensionReferenceCache::Reference DimensionReferenceCache::store(
+    unsigned int id, const Window* window, const Property* property,
+    PropertyAccess access)
+{
+    const Reference reference = { window, property, access };
+
+    dropInvalidated();
+
+    d_references[id] = reference;
+    return reference;
+}
+
+//----------------------------------------------------------------------------//
+void DimensionReferenceCache::dropInvalidated()
+{
+    if (d_referencesGeneration != d_generation)
+    {
+        d_references.clear();
+        d_referencesGeneration = d_generation;
+    }
+}
+
+//----------------------------------------------------------------------------//
+unsigned int DimensionReferenceCache::allocateId()
+{
+    return ++s_lastId;
+}
+
+//----------------------------------------------------------------------------//
+DimensionReferenceCache::PropertyAccess DimensionReferenceCache::AccessCache::get(
+    const Property* property)
+{
+    if (property == d_property)
+        return d_access;
+
+    d_property = property;
+
+    if (dynamic_cast<const TypedProperty<float>*>(property))
+        d_access = PropertyAccess::Float;
+    else if (dynamic_cast<const TypedProperty<bool>*>(property))
+        d_access = PropertyAccess::Bool;
+    else if (dynamic_cast<const TypedProperty<UDim>*>(property))
+        d_access = PropertyAccess::UDim;
+    else if (dynamic_cast<const TypedProperty<URect>*>(property))
+        d_access = PropertyAccess::URect;
+    else if (dynamic_cast<const TypedProperty<Image*>*>(property))
+        d_access = PropertyAccess::Image;
+    else
+        d_access = PropertyAccess::String;
+
+    return d_access;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -37,11 +37,49 @@
 #include "CEGUI/Font.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/CoordConverter.h"
+#include "CEGUI/TypedProperty.h"
 #include <cassert>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+// Returns what the child and property names of a dimension resolve to for
+// the given window, looking them up only if the window has not cached them.
+static DimensionReferenceCache::Reference resolveReferences(
+    const Window& wnd, unsigned int id, const String& child_name,
+    const String* property_name,
+    DimensionReferenceCache::AccessCache* access_cache = nullptr)
+{
+    DimensionReferenceCache& cache = wnd.getDimensionReferenceCache();
+
+    if (const DimensionReferenceCache::Reference* reference = cache.find(id))
+        return *reference;
+
+    const Window* source = child_name.empty() ? &wnd : wnd.getChild(child_name);
+    const Property* property =
+        property_name ? source->getPropertyInstance(*property_name) : nullptr;
+
+    return cache.store(id, source, property, property ?
+        access_cache->get(property) : DimensionReferenceCache::PropertyAccess::String);
+}
+
+//----------------------------------------------------------------------------//
+// Reads the value of a resolved property natively when it is of the access
+// type of T, otherwise parses its string value.
+template<typename T>
+static typename PropertyHelper<T>::safe_method_return_type getReferencedValue(
+    const DimensionReferenceCache::Reference& reference,
+    DimensionReferenceCache::PropertyAccess access)
+{
+    if (reference.d_access == access)
+        return static_cast<const TypedProperty<T>*>(reference.d_property)->
+            getNative(reference.d_window);
+
+    return PropertyHelper<T>::fromString(
+        reference.d_property->get(reference.d_window));
+}
+
 //----------------------------------------------------------------------------//
 BaseDim::BaseDim()
 {
@@ -510,12 +548,21 @@ const String& ImagePropertyDim::getSourceProperty() const
 void ImagePropertyDim::setSourceProperty(const String& property_name)
 {
     d_propertyName = property_name;
+    d_referenceId = DimensionReferenceCache::allocateId();
 }
 
 //----------------------------------------------------------------------------//
 const Image* ImagePropertyDim::getSourceImage(const Window& wnd) const
 {
-    const String& image_name(wnd.getProperty(d_propertyName));
+    const DimensionReferenceCache::Reference reference =
+        resolveReferences(wnd, d_referenceId, String(), &d_propertyName,
+                          &d_propertyAccess);
+
+    if (reference.d_access == DimensionReferenceCache::PropertyAccess::Image)
+        return getReferencedValue<Image*>(
+            reference, DimensionReferenceCache::PropertyAccess::Image);
+
+    const String image_name(reference.d_property->get(&wnd));
     return image_name.empty() ? 0 : &ImageManager::getSingleton().get(image_name);
 }
 
@@ -556,6 +603,7 @@ const String& WidgetDim::getWidgetName() const
 void WidgetDim::setWidgetName(const String& name)
 {
     d_widgetName = name;
+    d_referenceId = DimensionReferenceCache::allocateId();
 }
 
 //----------------------------------------------------------------------------//
@@ -583,8 +631,12 @@ float WidgetDim::getValue(const Window& wnd) const
     // name not empty, so find window with required name
     else
     {
-        if (wnd.isChild(d_widgetName))
-            widget = wnd.getChild(d_widgetName);
+        if (const DimensionReferenceCache::Reference* reference =
+                wnd.getDimensionReferenceCache().find(d_referenceId))
+            widget = reference->d_window;
+        else if (wnd.isChild(d_widgetName))
+            widget = wnd.getDimensionReferenceCache().store(
+                d_referenceId, wnd.getChild(d_widgetName)).d_window;
         else
             throw InvalidRequestException(
                 "A WidgetDim in window \"" + wnd.getName() + "\" requested window \"" + d_widgetName + "\" as WidgetDim-source, but this is not a child of the window");
@@ -689,6 +741,7 @@ const String& FontDim::getName() const
 void FontDim::setName(const String& name)
 {
     d_childName = name;
+    d_referenceId = DimensionReferenceCache::allocateId();
 }
 
 //----------------------------------------------------------------------------//
@@ -743,7 +796,8 @@ void FontDim::setPadding(float padding)
 float FontDim::getValue(const Window& wnd) const
 {
     // get window to use.
-    const Window& sourceWindow = d_childName.empty() ? wnd : *wnd.getChild(d_childName);
+    const Window& sourceWindow = d_childName.empty() ? wnd :
+        *resolveReferences(wnd, d_referenceId, d_childName, nullptr).d_window;
     // get font to use
     const Font* fontObj = getFontObject(sourceWindow);
 
@@ -844,6 +898,7 @@ const String& PropertyDim::getWidgetName() const
 void PropertyDim::setWidgetName(const String& name)
 {
     d_childName = name;
+    d_referenceId = DimensionReferenceCache::allocateId();
 }
 
 //----------------------------------------------------------------------------//
@@ -856,6 +911,7 @@ const String& PropertyDim::getPropertyName() const
 void PropertyDim::setPropertyName(const String& property)
 {
     d_property = property;
+    d_referenceId = DimensionReferenceCache::allocateId();
 }
 
 //----------------------------------------------------------------------------//
@@ -873,22 +929,27 @@ void PropertyDim::setSourceDimension(DimensionType dim)
 //----------------------------------------------------------------------------//
 float PropertyDim::getValue(const Window& wnd) const
 {
-    // get window to use.
-    const Window& sourceWindow = d_childName.empty() ? wnd : *wnd.getChild(d_childName);
+    // get window and property to use.
+    const DimensionReferenceCache::Reference reference =
+        resolveReferences(wnd, d_referenceId, d_childName, &d_property,
+                          &d_propertyAccess);
 
     if (d_type == DimensionType::Invalid)
     {
         // check property data type and convert to float if necessary
-        Property* pi = sourceWindow.getPropertyInstance(d_property);
-        if (pi->getDataType() == PropertyHelper<bool>::getDataTypeName())
-            return sourceWindow.getProperty<bool>(d_property) ? 1.0f : 0.0f;
+        if (reference.d_access == DimensionReferenceCache::PropertyAccess::Bool ||
+            reference.d_property->getDataType() == PropertyHelper<bool>::getDataTypeName())
+            return getReferencedValue<bool>(reference,
+                DimensionReferenceCache::PropertyAccess::Bool) ? 1.0f : 0.0f;
 
         // return float property value.
-        return sourceWindow.getProperty<float>(d_property);
+        return getReferencedValue<float>(reference,
+            DimensionReferenceCache::PropertyAccess::Float);
     }
 
-    const UDim d = sourceWindow.getProperty<UDim>(d_property);
-    const Sizef s = sourceWindow.getPixelSize();
+    const UDim d = getReferencedValue<UDim>(reference,
+        DimensionReferenceCache::PropertyAccess::UDim);
+    const Sizef s = reference.d_window->getPixelSize();
 
     switch (d_type)
     {
@@ -1199,8 +1260,8 @@ Rectf ComponentArea::getPixelRect(const Window& wnd) const
     // use a property?
     if (isAreaFetchedFromProperty())
     {
-        pixelRect = CoordConverter::asAbsolute(
-            wnd.getProperty<URect>(d_namedSource), wnd.getPixelSize());
+        pixelRect = CoordConverter::asAbsolute(getPropertySourceArea(wnd),
+                                               wnd.getPixelSize());
     }
     else if (isAreaFetchedFromNamedArea())
     {
@@ -1244,8 +1305,8 @@ Rectf ComponentArea::getPixelRect(const Window& wnd, const Rectf& container) con
     // use a property?
     if (isAreaFetchedFromProperty())
     {
-        pixelRect = CoordConverter::asAbsolute(
-            wnd.getProperty<URect>(d_namedSource), wnd.getPixelSize());
+        pixelRect = CoordConverter::asAbsolute(getPropertySourceArea(wnd),
+                                               wnd.getPixelSize());
     }
     else if (isAreaFetchedFromNamedArea())
     {
@@ -1328,6 +1389,7 @@ void ComponentArea::setAreaPropertySource(const String& property)
 {
     d_namedSource = property;
     d_namedAreaSourceLook.clear();
+    d_referenceId = DimensionReferenceCache::allocateId();
 }
 
 //----------------------------------------------------------------------------//
@@ -1342,6 +1404,7 @@ void ComponentArea::setNamedAreaSource(const String& widget_look,
 {
     d_namedSource = area_name;
     d_namedAreaSourceLook = widget_look;
+    d_referenceId = DimensionReferenceCache::allocateId();
 }
 
 //----------------------------------------------------------------------------//
@@ -1388,6 +1451,15 @@ UDim ComponentArea::getWidthLowerBoundAsFuncOfWindowWidth(const Window& wnd) con
     }
 }
 
+//----------------------------------------------------------------------------//
+URect ComponentArea::getPropertySourceArea(const Window& wnd) const
+{
+    return getReferencedValue<URect>(
+        resolveReferences(wnd, d_referenceId, String(), &d_namedSource,
+                          &d_propertyAccess),
+        DimensionReferenceCache::PropertyAccess::URect);
+}
+
 //----------------------------------------------------------------------------//
 UDim ComponentArea::getHeightLowerBoundAsFuncOfWindowHeight(const Window& wnd) const
 {
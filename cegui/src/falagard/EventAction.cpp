@@ -29,7 +29,6 @@
 #include "CEGUI/falagard/XMLHandler.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/Logger.h"
-#include "CEGUI/SharedStringStream.h"
 
 namespace CEGUI
 {
@@ -143,7 +142,7 @@ void EventAction::writeXMLToStream(XMLSerializer& xml_stream) const
 //----------------------------------------------------------------------------//
 String EventAction::makeConnectionKeyName(const Window& /*widget*/) const
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     return addressStr + d_eventName + FalagardXMLHelper<ChildEventAction>::toString(d_action);
 }
@@ -446,6 +446,9 @@ void WidgetLookFeel::cleanUpWidget(Window& widget) const
         AnimationManager::getSingleton().destroyAnimationInstance(anim->second);
         d_animationInstances.erase(anim);
     }
+
+    // dimensions must not keep referencing the removed properties
+    widget.invalidateDimensionReferences();
 }
 
 //---------------------------------------------------------------------------//
@@ -30,7 +30,6 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
-#include "CEGUI/SharedStringStream.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -42,9 +41,10 @@ namespace CEGUI
     String WidgetLookManager::d_defaultResourceGroup;
     ////////////////////////////////////////////////////////////////////////////////
 
-    WidgetLookManager::WidgetLookManager()
+    WidgetLookManager::WidgetLookManager() :
+        d_revision(0)
     {
-        String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+        String addressStr = Logger::addressToString(this);
 
         Logger::getSingleton().logEvent("CEGUI::WidgetLookManager Singleton "
             "created. (" + addressStr + ")");
@@ -52,7 +52,7 @@ namespace CEGUI
 
     WidgetLookManager::~ WidgetLookManager()
     {
-        String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+        String addressStr = Logger::addressToString(this);
 
         Logger::getSingleton().logEvent("CEGUI::WidgetLookManager Singleton "
             "destroyed. (" + addressStr + ")");
@@ -160,6 +160,7 @@ namespace CEGUI
         if (wlf != d_widgetLooks.end())
         {
             d_widgetLooks.erase(wlf);
+            ++d_revision;
         }
         else
         {
@@ -172,6 +173,7 @@ namespace CEGUI
     void WidgetLookManager::eraseAllWidgetLooks()
     {
         d_widgetLooks.clear();
+        ++d_revision;
     }
 
     void WidgetLookManager::addWidgetLook(const WidgetLookFeel& look)
@@ -180,6 +182,7 @@ namespace CEGUI
         {
             Logger::getSingleton().logEvent(
                 "WidgetLookManager::addWidgetLook - Widget look and feel '" + look.getName() + "' already exists.  Replacing previous definition.");
+            ++d_revision;
         }
 
         d_widgetLooks[look.getName()] = look;
@@ -40,7 +40,7 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/Animation_xmlHandler.h"
 #include "CEGUI/AnimationManager.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/StreamHelper.h"
 
 #include "CEGUI/widgets/Thumb.h"
 #include "CEGUI/widgets/TabControl.h"
@@ -353,9 +353,9 @@ namespace CEGUI
     argb_t Falagard_xmlHandler::hexStringToARGB(const String& str)
     {
         argb_t val;
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(str);
+        std::stringstream sstream;
+        prepareStream(sstream, str);
         sstream >> std::hex >> val;
-        sstream << std::dec;
 
         return val;
     }
@@ -464,7 +464,7 @@ namespace CEGUI
         d_widgetlook = new WidgetLookFeel(attributes.getValueAsString(NameAttribute),
                                                    attributes.getValueAsString(InheritsAttribute));
 
-        Logger::getSingleton().logEvent("---> Start of definition for widget look '" + d_widgetlook->getName() + "'.", LoggingLevel::Informative);
+        CEGUI_LOG(LoggingLevel::Informative, "---> Start of definition for widget look '" + d_widgetlook->getName() + "'.");
     }
 
     /*************************************************************************
@@ -1451,7 +1451,7 @@ namespace CEGUI
     {
         assert(d_widgetlook != nullptr);
 
-        Logger::getSingleton().logEvent("---< End of definition for widget look '" + d_widgetlook->getName() + "'.", LoggingLevel::Informative);
+        CEGUI_LOG(LoggingLevel::Informative, "---< End of definition for widget look '" + d_widgetlook->getName() + "'.");
         d_manager->addWidgetLook(*d_widgetlook);
         delete d_widgetlook;
         d_widgetlook = nullptr;
@@ -30,7 +30,7 @@
 #include "CEGUI/System.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/StreamHelper.h"
 // for the XML parsing part.
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/XMLAttributes.h"
@@ -388,7 +388,8 @@ SVGData::SVGLength SVGData::parseLengthDataType(const String& length_string)
     SVGLength length;
     String unitString;
 
-    std::stringstream& strStream = SharedStringstream::GetPreparedStream(length_string);
+    std::stringstream strStream;
+    prepareStream(strStream, length_string);
 
     strStream >> length.d_value;
     if(strStream.fail())
@@ -507,7 +508,8 @@ glm::vec3 SVGData::parseColour(const CEGUI::String& colour_string)
     else if(colour_string.compare("rgb(") > 0)
     {
         CEGUI::String rgbColours = colour_string.substr(4, colour_string.length() - 5);
-        std::stringstream& strStream = SharedStringstream::GetPreparedStream(rgbColours);
+        std::stringstream strStream;
+        prepareStream(strStream, rgbColours);
 
         int r, g, b;
         strStream >> r >> mandatoryChar<','>  >> g >> mandatoryChar<','>  >> b;
@@ -562,7 +564,8 @@ glm::vec3 SVGData::parseRgbHexColour(const CEGUI::String& colourString,
     glm::vec3 colour;
     int value;
 
-    std::stringstream& strStream = SharedStringstream::GetPreparedStream();
+    std::stringstream strStream;
+    prepareStream(strStream);
     strStream << std::hex;
 
 #if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII)
@@ -616,8 +619,6 @@ glm::vec3 SVGData::parseRgbHexColour(const CEGUI::String& colourString,
 
     colour.z = value / 255.0f;
 
-    strStream << std::dec;
-
     return colour;
 }
 
@@ -625,7 +626,8 @@ glm::vec3 SVGData::parseRgbHexColour(const CEGUI::String& colourString,
 std::vector<float> SVGData::parseListOfLengths(const String& list_of_lengths_string)
 {
     std::vector<float> list_of_lengths;
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(list_of_lengths_string);
+    std::stringstream sstream;
+    prepareStream(sstream, list_of_lengths_string);
 
     float currentValue;
     sstream >> currentValue;
@@ -677,7 +679,8 @@ void SVGData::parsePaintStyleFillOpacity(const String& fillOpacityString, SVGPai
         paint_style.d_fillOpacity = 1.0f;
     else
     {
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(fillOpacityString);
+        std::stringstream sstream;
+        prepareStream(sstream, fillOpacityString);
         sstream >> paint_style.d_fillOpacity;
         if(sstream.fail())
             throw SVGParsingException("SVG file parsing was aborted because of an invalid "
@@ -703,7 +706,8 @@ void SVGData::parsePaintStyleStroke(const String& strokeString, SVGPaintStyle& p
 //----------------------------------------------------------------------------//
 void SVGData::parsePaintStyleStrokeWidth(const String& strokeWidthString, SVGPaintStyle& paint_style)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(strokeWidthString);
+    std::stringstream sstream;
+    prepareStream(sstream, strokeWidthString);
     sstream >> paint_style.d_strokeWidth;
     if(sstream.fail())
         throw SVGParsingException(
@@ -751,7 +755,8 @@ void SVGData::parsePaintStyleStrokeLinejoin(const String& strokeLinejoinString,
 //----------------------------------------------------------------------------//
 void SVGData::parsePaintStyleMiterlimitString(const String& strokeMiterLimitString, SVGPaintStyle& paint_style)
 {
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(strokeMiterLimitString);
+    std::stringstream sstream;
+    prepareStream(sstream, strokeMiterLimitString);
     sstream >> paint_style.d_strokeMiterlimit;
     if (sstream.fail())
         throw SVGParsingException(
@@ -795,7 +800,8 @@ void SVGData::parsePaintStyleStrokeOpacity(const String& strokeOpacityString, SV
         paint_style.d_strokeOpacity = 1.0f;
     else
     {
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(strokeOpacityString);
+        std::stringstream sstream;
+        prepareStream(sstream, strokeOpacityString);
         sstream >> paint_style.d_strokeOpacity;
         if (sstream.fail())
             throw SVGParsingException(
@@ -814,7 +820,8 @@ void SVGData::parsePaintStyleStrokeDashOffset(const String& strokeDashOffsetStri
         paint_style.d_strokeDashOffset = 0.0f;
     else
     {
-        std::stringstream& sstream = SharedStringstream::GetPreparedStream(strokeDashOffsetString);
+        std::stringstream sstream;
+        prepareStream(sstream, strokeDashOffsetString);
         sstream >> paint_style.d_strokeDashOffset;
         if (sstream.fail())
             throw SVGParsingException(
@@ -828,7 +835,8 @@ glm::mat3x3 SVGData::parseTransform(const XMLAttributes& attributes)
 {
     const String transformString(attributes.getValueAsString(SVGTransformAttribute));
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(transformString);
+    std::stringstream sstream;
+    prepareStream(sstream, transformString);
     // Unity matrix is our default/basis
     glm::mat3x3 currentMatrix(1.0f);
 
@@ -869,7 +877,8 @@ glm::mat3x3 SVGData::parseTransform(const XMLAttributes& attributes)
 void SVGData::parsePointsString(const String& pointsString, std::vector<glm::vec2>& points)
 {
 
-    std::stringstream& sstream = SharedStringstream::GetPreparedStream(pointsString);
+    std::stringstream sstream;
+    prepareStream(sstream, pointsString);
 
     while(true)
     {
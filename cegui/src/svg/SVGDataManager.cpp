@@ -29,7 +29,6 @@
 #include "CEGUI/svg/SVGData.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
-#include "CEGUI/SharedStringStream.h"
 
 namespace CEGUI
 {
@@ -116,7 +115,7 @@ bool SVGDataManager::isSVGDataDefined(const String& name) const
 //----------------------------------------------------------------------------//
 void SVGDataManager::logSVGDataCreation(SVGData* svgData)
 {
-    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+    String addressStr = Logger::addressToString(this);
 
     Logger::getSingleton().logEvent(
         "[SVGDataManager] Created SVGData object: '" + svgData->getName() + "' (" + addressStr + 
@@ -1608,29 +1608,9 @@ void SVGTesselator::createRectangleFill(const SVGPaintStyle& paint_style, std::v
     rectFillVertex.d_position.z = 0.0f;
 
     //Add the rectangle fill vertices
-    rectFillVertex.d_position.x = rectangle_points[0].x;
-    rectFillVertex.d_position.y = rectangle_points[0].y;
-    geometry_buffer.appendVertex(rectFillVertex);
-
-    rectFillVertex.d_position.x = rectangle_points[1].x;
-    rectFillVertex.d_position.y = rectangle_points[1].y;
-    geometry_buffer.appendVertex(rectFillVertex);
-
-    rectFillVertex.d_position.x = rectangle_points[2].x;
-    rectFillVertex.d_position.y = rectangle_points[2].y;
-    geometry_buffer.appendVertex(rectFillVertex);
-
-    rectFillVertex.d_position.x = rectangle_points[2].x;
-    rectFillVertex.d_position.y = rectangle_points[2].y;
-    geometry_buffer.appendVertex(rectFillVertex);
-
-    rectFillVertex.d_position.x = rectangle_points[0].x;
-    rectFillVertex.d_position.y = rectangle_points[0].y;
-    geometry_buffer.appendVertex(rectFillVertex);
-
-    rectFillVertex.d_position.x = rectangle_points[3].x;
-    rectFillVertex.d_position.y = rectangle_points[3].y;
-    geometry_buffer.appendVertex(rectFillVertex);
+    const glm::vec2* const fill_points[] = { &rectangle_points[0], &rectangle_points[1], &rectangle_points[2],
+                                             &rectangle_points[2], &rectangle_points[0], &rectangle_points[3] };
+    appendVertices(geometry_buffer, rectFillVertex, fill_points, 6);
 }
 
 //----------------------------------------------------------------------------//
@@ -1787,17 +1767,8 @@ void SVGTesselator::addTriangleGeometry(const glm::vec2& point1,
                                         GeometryBuffer &geometry_buffer,
                                         ColouredVertex &vertex)
 {
-    vertex.d_position.x = point1.x;
-    vertex.d_position.y = point1.y;
-    geometry_buffer.appendVertex(vertex);
-
-    vertex.d_position.x = point2.x;
-    vertex.d_position.y = point2.y;
-    geometry_buffer.appendVertex(vertex);
-
-    vertex.d_position.x = point3.x;
-    vertex.d_position.y = point3.y;
-    geometry_buffer.appendVertex(vertex);
+    const glm::vec2* const triangle_points[] = { &point1, &point2, &point3 };
+    appendVertices(geometry_buffer, vertex, triangle_points, 3);
 }
 
 //----------------------------------------------------------------------------//
@@ -1880,6 +1851,24 @@ void SVGTesselator::createFillGeometryAAFadeOnly(const std::vector<glm::vec2>& p
 }
 
 
+//----------------------------------------------------------------------------//
+void SVGTesselator::appendVertices(GeometryBuffer& geometry_buffer,
+                                   const ColouredVertex& vertex,
+                                   const glm::vec2* const* points,
+                                   std::size_t point_count)
+{
+    ColouredVertex* vertices = geometry_buffer.beginAppendColouredGeometry(point_count);
+
+    for (std::size_t i = 0; i < point_count; ++i)
+    {
+        vertices[i] = vertex;
+        vertices[i].d_position.x = points[i]->x;
+        vertices[i].d_position.y = points[i]->y;
+    }
+
+    geometry_buffer.endAppendGeometry();
+}
+
 //----------------------------------------------------------------------------//
 void SVGTesselator::addFillQuad(const glm::vec2& point1,
                                 const glm::vec2& point2,
@@ -1888,29 +1877,8 @@ void SVGTesselator::addFillQuad(const glm::vec2& point1,
                                 GeometryBuffer& geometry_buffer,
                                 ColouredVertex& fill_vertex)
 {
-    fill_vertex.d_position.x = point1.x;
-    fill_vertex.d_position.y = point1.y;
-    geometry_buffer.appendVertex(fill_vertex);
-
-    fill_vertex.d_position.x = point2.x;
-    fill_vertex.d_position.y = point2.y;
-    geometry_buffer.appendVertex(fill_vertex);
-
-    fill_vertex.d_position.x = point3.x;
-    fill_vertex.d_position.y = point3.y;
-    geometry_buffer.appendVertex(fill_vertex);
-
-    fill_vertex.d_position.x = point3.x;
-    fill_vertex.d_position.y = point3.y;
-    geometry_buffer.appendVertex(fill_vertex);
-
-    fill_vertex.d_position.x = point2.x;
-    fill_vertex.d_position.y = point2.y;
-    geometry_buffer.appendVertex(fill_vertex);
-
-    fill_vertex.d_position.x = point4.x;
-    fill_vertex.d_position.y = point4.y;
-    geometry_buffer.appendVertex(fill_vertex);
+    const glm::vec2* const quad_points[] = { &point1, &point2, &point3, &point3, &point2, &point4 };
+    appendVertices(geometry_buffer, fill_vertex, quad_points, 6);
 }
 
 //----------------------------------------------------------------------------//
@@ -1921,29 +1889,8 @@ void SVGTesselator::addStrokeQuad(const glm::vec2& point1,
                                   GeometryBuffer& geometry_buffer,
                                   ColouredVertex& stroke_vertex)
 {
-    stroke_vertex.d_position.x = point1.x;
-    stroke_vertex.d_position.y = point1.y;
-    geometry_buffer.appendVertex(stroke_vertex);
-
-    stroke_vertex.d_position.x = point2.x;
-    stroke_vertex.d_position.y = point2.y;
-    geometry_buffer.appendVertex(stroke_vertex);
-
-    stroke_vertex.d_position.x = point3.x;
-    stroke_vertex.d_position.y = point3.y;
-    geometry_buffer.appendVertex(stroke_vertex);
-
-    stroke_vertex.d_position.x = point3.x;
-    stroke_vertex.d_position.y = point3.y;
-    geometry_buffer.appendVertex(stroke_vertex);
-
-    stroke_vertex.d_position.x = point2.x;
-    stroke_vertex.d_position.y = point2.y;
-    geometry_buffer.appendVertex(stroke_vertex);
-
-    stroke_vertex.d_position.x = point4.x;
-    stroke_vertex.d_position.y = point4.y;
-    geometry_buffer.appendVertex(stroke_vertex);
+    const glm::vec2* const quad_points[] = { &point1, &point2, &point3, &point3, &point2, &point4 };
+    appendVertices(geometry_buffer, stroke_vertex, quad_points, 6);
 }
 
 
@@ -0,0 +1,151 @@
+/***********************************************************************
+    created:    Sun Oct 18 2026
+
+    purpose:    Implementation of the prefix-sum index over item heights.
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/views/ItemHeightIndex.h"
+
+#include <algorithm>
+
+namespace CEGUI
+{
+
+//----------------------------------------------------------------------------//
+// Returns the lowest set bit of \a i, which is the length of the range
+// covered by the Fenwick tree node i.
+static inline size_t lowestBit(size_t i)
+{
+    return i & (~i + 1);
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::clear()
+{
+    d_heights.clear();
+    d_tree.clear();
+    d_validNodes = 0;
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::append(float height)
+{
+    d_heights.push_back(height);
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::insert(size_t position, const float* heights, size_t count)
+{
+    d_heights.insert(d_heights.begin() + position, heights, heights + count);
+
+    // nodes only ever cover the items before them, so those up to the
+    // insertion point are left intact.
+    d_validNodes = std::min(d_validNodes, position);
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::erase(size_t position, size_t count)
+{
+    d_heights.erase(d_heights.begin() + position,
+        d_heights.begin() + position + count);
+
+    d_validNodes = std::min(d_validNodes, position);
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::setHeight(size_t position, float height)
+{
+    const float delta = height - d_heights[position];
+    d_heights[position] = height;
+
+    // stale nodes are recomputed from d_heights by the next query
+    for (size_t i = position + 1; i <= d_validNodes; i += lowestBit(i))
+        d_tree[i] += delta;
+}
+
+//----------------------------------------------------------------------------//
+float ItemHeightIndex::getOffset(size_t position) const
+{
+    update();
+
+    float offset = 0.0f;
+
+    for (size_t i = position; i > 0; i -= lowestBit(i))
+        offset += d_tree[i];
+
+    return offset;
+}
+
+//----------------------------------------------------------------------------//
+size_t ItemHeightIndex::getPositionAtOffset(float offset) const
+{
+    const size_t count = d_heights.size();
+    if (count == 0 || offset < 0.0f)
+        return count;
+
+    update();
+
+    size_t step = 1;
+    while (step <= count / 2)
+        step *= 2;
+
+    // find the number of leading items which end at or before the offset
+    size_t position = 0;
+    for (; step > 0; step /= 2)
+    {
+        if (position + step <= count && d_tree[position + step] <= offset)
+        {
+            position += step;
+            offset -= d_tree[position];
+        }
+    }
+
+    return position;
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::update() const
+{
+    const size_t count = d_heights.size();
+    if (d_validNodes == count)
+        return;
+
+    d_tree.resize(count + 1);
+
+    // node k covers the items (k - lowestBit(k), k], which is item k - 1 plus
+    // the ranges of the nodes found by walking down from k - 1. Refreshing
+    // the nodes in order is therefore linear in the number of stale nodes.
+    for (size_t k = d_validNodes + 1; k <= count; ++k)
+    {
+        float node = d_heights[k - 1];
+        for (size_t i = k - 1; i > k - lowestBit(k); i -= lowestBit(i))
+            node += d_tree[i];
+
+        d_tree[k] = node;
+    }
+
+    d_validNodes = count;
+}
+
+}
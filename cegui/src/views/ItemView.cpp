@@ -236,6 +236,15 @@ void ItemView::initialiseComponents(void)
     performChildWindowLayout();
 }
 
+//----------------------------------------------------------------------------//
+void ItemView::resetForReuse()
+{
+    Window::resetForReuse();
+
+    // a new view has no model, the one set belongs to whoever set it
+    setModel(nullptr);
+}
+
 //----------------------------------------------------------------------------//
 void ItemView::setModel(ItemModel* item_model)
 {
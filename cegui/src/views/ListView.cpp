@@ -28,6 +28,7 @@
 ***************************************************************************/
 #include "CEGUI/views/ListView.h"
 #include "CEGUI/CoordConverter.h"
+#include "CEGUI/Font.h"
 #include <algorithm>
 
 #include "CEGUI/falagard/WidgetLookManager.h"
@@ -39,7 +40,7 @@
 
 namespace CEGUI
 {
-typedef std::vector<ListViewItemRenderingState> ViewItemsVector;
+typedef std::vector<ListViewItemRenderingState*> ViewItemsVector;
 
 //----------------------------------------------------------------------------//
 static bool listViewItemPointerLess(
@@ -57,6 +58,14 @@ static bool listViewItemPointerGreater(
     return *item1 > *item2;
 }
 
+//----------------------------------------------------------------------------//
+static bool listViewItemPointerLessRecentlyVisible(
+    const ListViewItemRenderingState* item1,
+    const ListViewItemRenderingState* item2)
+{
+    return item1->d_lastVisiblePass < item2->d_lastVisiblePass;
+}
+
 //----------------------------------------------------------------------------//
 const String ListView::EventNamespace("ListView");
 const String ListView::WidgetTypeName("CEGUI/ListView");
@@ -66,7 +75,8 @@ ListViewItemRenderingState::ListViewItemRenderingState(ListView* list_view) :
     d_string(nullptr),
     d_formattedString(nullptr),
     d_isSelected(false),
-    d_attachedListView(list_view)
+    d_attachedListView(list_view),
+    d_lastVisiblePass(0)
 {
 }
 
@@ -86,7 +96,8 @@ ListViewItemRenderingState::ListViewItemRenderingState(ListViewItemRenderingStat
     d_isSelected       (src.d_isSelected),
     d_index            (std::move(src.d_index)),
     d_text             (std::move(src.d_text)),
-    d_attachedListView (src.d_attachedListView)
+    d_attachedListView (src.d_attachedListView),
+    d_lastVisiblePass  (src.d_lastVisiblePass)
 {
     src.d_string          = nullptr; // don't allow delete d_string by src
     src.d_formattedString = nullptr; // don't allow delete d_formattedString by src
@@ -102,6 +113,7 @@ ListViewItemRenderingState& ListViewItemRenderingState::operator=(ListViewItemRe
     d_index            = std::move(src.d_index);
     d_text             = std::move(src.d_text);
     d_attachedListView = src.d_attachedListView;
+    d_lastVisiblePass  = src.d_lastVisiblePass;
 
     src.d_string          = nullptr; // don't allow delete d_string by src
     src.d_formattedString = nullptr; // don't allow delete d_formattedString by src
@@ -161,6 +173,16 @@ void ListViewItemRenderingState::setStringAndFormatting(const RenderedString& st
     }
 }
 
+//----------------------------------------------------------------------------//
+void ListViewItemRenderingState::clearStringAndFormatting()
+{
+    delete d_formattedString;
+    delete d_string;
+
+    d_formattedString = nullptr;
+    d_string = nullptr;
+}
+
 //----------------------------------------------------------------------------//
 bool ListViewItemRenderingState::operator<(ListViewItemRenderingState const& other) const
 {
@@ -176,7 +198,12 @@ bool ListViewItemRenderingState::operator>(const ListViewItemRenderingState& oth
 //----------------------------------------------------------------------------//
 ListView::ListView(const String& type, const String& name) :
     ItemView(type, name),
-    d_horzFormatting(HorizontalTextFormatting::LeftAligned)
+    d_horzFormatting(HorizontalTextFormatting::LeftAligned),
+    d_isVirtualizationEnabled(false),
+    d_estimatedItemHeight(0.0f),
+    d_formattedItemCacheSize(256),
+    d_formattedItemCount(0),
+    d_visiblePass(0)
 {
     const String& propertyOrigin = "ListView";
 
@@ -185,11 +212,33 @@ ListView::ListView(const String& type, const String& name) :
         "  Value is one of the HorzFormatting strings.",
         &ListView::setHorizontalFormatting, &ListView::getHorizontalFormatting,
         HorizontalTextFormatting::LeftAligned);
+
+    CEGUI_DEFINE_PROPERTY(ListView, bool,
+        "VirtualizationEnabled", "Property to get/set whether the items are "
+        "only formatted once they are scrolled into view. "
+        "Value is either \"True\" or \"False\".",
+        &ListView::setVirtualizationEnabled, &ListView::isVirtualizationEnabled,
+        false);
+
+    CEGUI_DEFINE_PROPERTY(ListView, float,
+        "EstimatedItemHeight", "Property to get/set the height assumed for "
+        "virtualized items that were not measured yet. A value of 0 means the "
+        "line spacing of the font is used. Value is a float.",
+        &ListView::setEstimatedItemHeight, &ListView::getEstimatedItemHeight,
+        0.0f);
+
+    CEGUI_DEFINE_PROPERTY(ListView, size_t,
+        "FormattedItemCacheSize", "Property to get/set the maximum number of "
+        "virtualized items that keep their formatted text. "
+        "Value is an unsigned integer.",
+        &ListView::setFormattedItemCacheSize,
+        &ListView::getFormattedItemCacheSize, 256);
 }
 
 //----------------------------------------------------------------------------//
 ListView::~ListView()
 {
+    clearItems();
 }
 
 //----------------------------------------------------------------------------//
@@ -201,6 +250,56 @@ void ListView::setHorizontalFormatting(HorizontalTextFormatting h_fmt)
     d_needsFullRender = true;
 }
 
+//----------------------------------------------------------------------------//
+void ListView::setVirtualizationEnabled(bool enabled)
+{
+    if (enabled == d_isVirtualizationEnabled)
+        return;
+
+    d_isVirtualizationEnabled = enabled;
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+bool ListView::isVirtualizationEnabled() const
+{
+    return d_isVirtualizationEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::setEstimatedItemHeight(float height)
+{
+    if (height == d_estimatedItemHeight)
+        return;
+
+    d_estimatedItemHeight = height;
+
+    if (d_isVirtualizationEnabled)
+    {
+        d_needsFullRender = true;
+        invalidateView(false);
+    }
+}
+
+//----------------------------------------------------------------------------//
+float ListView::getEstimatedItemHeight() const
+{
+    return d_estimatedItemHeight;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::setFormattedItemCacheSize(size_t size)
+{
+    d_formattedItemCacheSize = size;
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getFormattedItemCacheSize() const
+{
+    return d_formattedItemCacheSize;
+}
+
 //----------------------------------------------------------------------------//
 void ListView::prepareForRender()
 {
@@ -211,7 +310,8 @@ void ListView::prepareForRender()
     if (d_needsFullRender)
     {
         d_renderedMaxWidth = d_renderedTotalHeight = 0;
-        d_items.clear();
+        clearItems();
+        d_formattedItemCount = 0;
     }
 
     ModelIndex root_index = d_itemModel->getRootIndex();
@@ -223,22 +323,50 @@ void ListView::prepareForRender()
 
         if (d_needsFullRender)
         {
-            ListViewItemRenderingState state = ListViewItemRenderingState(this);
-            updateItem(state, index, d_renderedMaxWidth, d_renderedTotalHeight);
-            d_items.push_back(std::move(state));
+            ListViewItemRenderingState* item = new ListViewItemRenderingState(this);
+            updateItem(*item, index, d_renderedMaxWidth, d_renderedTotalHeight);
+            d_items.push_back(item);
+        }
+        else if (d_isVirtualizationEnabled)
+        {
+            // formatting is refreshed by onChildrenDataChanged and
+            // formatVisibleItems, only the index and selection need updating.
+            ListViewItemRenderingState* item = d_items.at(child);
+            item->d_index = index;
+            item->d_isSelected = isIndexSelected(index);
         }
         else
         {
-            ListViewItemRenderingState& item = d_items.at(child);
-            d_renderedTotalHeight -= item.d_size.d_height;
+            ListViewItemRenderingState* item = d_items.at(child);
+            d_renderedTotalHeight -= item->d_size.d_height;
 
-            updateItem(item, index, d_renderedMaxWidth, d_renderedTotalHeight);
+            updateItem(*item, index, d_renderedMaxWidth, d_renderedTotalHeight);
         }
     }
 
+    // the order is kept up to date by the model notifications, so only a full
+    // render needs to sort; a partial one may only have changed the heights.
+    if (d_needsFullRender)
+        resortListView();
+    else if (!d_isVirtualizationEnabled)
+        rebuildItemHeights();
+
     updateScrollbars();
+
+    if (d_isVirtualizationEnabled)
+    {
+        // measuring the visible items may shrink the document and so clamp
+        // the scroll position, which in turn exposes other items.
+        float scroll_position;
+        do
+        {
+            scroll_position = getVertScrollbar()->getScrollPosition();
+            formatVisibleItems();
+            updateScrollbars();
+        } while (scroll_position != getVertScrollbar()->getScrollPosition());
+    }
+
     setIsDirty(false);
-    resortListView();
     d_needsFullRender = false;
 }
 
@@ -257,24 +385,25 @@ ModelIndex ListView::indexAt(const glm::vec2& position)
     if (!render_area.isPointInRectf(window_position))
         return ModelIndex();
 
-    float cur_height = render_area.d_min.y - getVertScrollbar()->getScrollPosition();
-    //TODO: start only on the visible area
-    for (size_t index = 0; index < d_sortedItems.size(); ++index)
-    {
-        ListViewItemRenderingState* item = d_sortedItems.at(index);
-        Sizef size = item->d_size;
-        float next_height = cur_height + size.d_height;
+    const size_t item_position = getItemPositionAtOffset(window_position.y -
+        render_area.d_min.y + getVertScrollbar()->getScrollPosition());
 
-        if (window_position.y >= cur_height &&
-            window_position.y <= next_height)
-        {
-            return item->d_index;
-        }
+    if (item_position >= d_sortedItems.size())
+        return ModelIndex();
 
-        cur_height = next_height;
-    }
+    return d_sortedItems[item_position]->d_index;
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getItemPositionAtOffset(float offset) const
+{
+    return d_itemHeights.getPositionAtOffset(offset);
+}
 
-    return ModelIndex();
+//----------------------------------------------------------------------------//
+float ListView::getItemOffset(size_t position) const
+{
+    return d_itemHeights.getOffset(position);
 }
 
 //----------------------------------------------------------------------------//
@@ -286,19 +415,221 @@ const std::vector<ListViewItemRenderingState*>& ListView::getItems() const
 //----------------------------------------------------------------------------//
 void ListView::resortListView()
 {
-    d_sortedItems.clear();
+    d_sortedItems = d_items;
 
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        std::stable_sort(d_sortedItems.begin(), d_sortedItems.end(),
+            d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    }
+
+    rebuildItemHeights();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::clearItems()
+{
     for (ViewItemsVector::iterator itor = d_items.begin();
         itor != d_items.end(); ++itor)
     {
-        d_sortedItems.push_back(&(*itor));
+        delete *itor;
     }
 
+    d_items.clear();
+    d_sortedItems.clear();
+    d_itemHeights.clear();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::insertSortedItems(std::vector<ListViewItemRenderingState*>& items,
+    size_t position)
+{
+    if (items.empty())
+        return;
+
     if (d_sortMode == ViewSortMode::NoSorting)
+    {
+        d_sortedItems.insert(d_sortedItems.begin() + position,
+            items.begin(), items.end());
+
+        std::vector<float> heights;
+        heights.reserve(items.size());
+        for (size_t i = 0; i < items.size(); ++i)
+            heights.push_back(items[i]->d_size.d_height);
+
+        d_itemHeights.insert(position, &heights[0], heights.size());
+        return;
+    }
+
+    bool (*compare)(const ListViewItemRenderingState*,
+        const ListViewItemRenderingState*) =
+        d_sortMode == ViewSortMode::Ascending ?
+            &listViewItemPointerLess : &listViewItemPointerGreater;
+
+    // sort the batch, then find where each of its items goes by searching
+    // only the part of the list past the previous one.
+    std::stable_sort(items.begin(), items.end(), compare);
+
+    std::vector<size_t> positions(items.size());
+    ViewItemsVector::iterator search_begin = d_sortedItems.begin();
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        search_begin = std::upper_bound(search_begin, d_sortedItems.end(),
+            items[i], compare);
+        positions[i] = search_begin - d_sortedItems.begin();
+    }
+
+    const size_t old_count = d_sortedItems.size();
+
+    // the common case of items streamed at the end of the list
+    if (positions[0] == old_count)
+    {
+        d_sortedItems.insert(d_sortedItems.end(), items.begin(), items.end());
+
+        for (size_t i = 0; i < items.size(); ++i)
+            d_itemHeights.append(items[i]->d_size.d_height);
+
+        return;
+    }
+
+    // merge the batch in, moving each of the existing items only once
+    d_sortedItems.resize(old_count + items.size());
+    size_t source = old_count;
+    size_t target = d_sortedItems.size();
+    for (size_t i = items.size(); i > 0; --i)
+    {
+        while (source > positions[i - 1])
+            d_sortedItems[--target] = d_sortedItems[--source];
+
+        d_sortedItems[--target] = items[i - 1];
+    }
+
+    // a few items are inserted into the height index one by one, larger
+    // batches rather refill it once from the first of them.
+    if (items.size() <= 8)
+    {
+        for (size_t i = 0; i < items.size(); ++i)
+            d_itemHeights.insert(positions[i] + i, &items[i]->d_size.d_height, 1);
+    }
+    else
+        rebuildItemHeights(positions[0]);
+}
+
+//----------------------------------------------------------------------------//
+void ListView::removeSortedItems(
+    const std::vector<ListViewItemRenderingState*>& items, size_t first_child)
+{
+    std::vector<size_t> positions;
+    positions.swap(d_pendingSortedPositions);
+
+    if (items.empty())
+        return;
+
+    // unsorted items are displayed in model order
+    if (d_sortMode == ViewSortMode::NoSorting)
+    {
+        d_sortedItems.erase(d_sortedItems.begin() + first_child,
+            d_sortedItems.begin() + first_child + items.size());
+        d_itemHeights.erase(first_child, items.size());
+        return;
+    }
+
+    // the data of the items may already be gone, so they can only be searched
+    // for when the model did not announce the change beforehand.
+    bool positions_valid = positions.size() == items.size();
+    for (size_t i = 0; positions_valid && i < items.size(); ++i)
+    {
+        positions_valid = positions[i] < d_sortedItems.size() &&
+            d_sortedItems[positions[i]] == items[i];
+    }
+
+    if (!positions_valid)
+    {
+        positions.resize(items.size());
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            positions[i] = std::find(d_sortedItems.begin(), d_sortedItems.end(),
+                items[i]) - d_sortedItems.begin();
+        }
+    }
+
+    std::sort(positions.begin(), positions.end());
+
+    const size_t first_position = positions.front();
+    if (positions.back() - first_position + 1 == positions.size())
+    {
+        d_sortedItems.erase(d_sortedItems.begin() + first_position,
+            d_sortedItems.begin() + first_position + positions.size());
+        d_itemHeights.erase(first_position, positions.size());
+        return;
+    }
+
+    // scattered items: close the gaps with a single pass from the first one
+    size_t target = first_position;
+    size_t next_removed = 0;
+    for (size_t i = first_position; i < d_sortedItems.size(); ++i)
+    {
+        if (next_removed < positions.size() && positions[next_removed] == i)
+            ++next_removed;
+        else
+            d_sortedItems[target++] = d_sortedItems[i];
+    }
+
+    d_sortedItems.resize(target);
+
+    if (positions.size() <= 8)
+    {
+        for (size_t i = positions.size(); i > 0; --i)
+            d_itemHeights.erase(positions[i - 1], 1);
+    }
+    else
+        rebuildItemHeights(first_position);
+}
+
+//----------------------------------------------------------------------------//
+void ListView::findPendingSortedPositions(const ModelEventArgs& args)
+{
+    d_pendingSortedPositions.clear();
+
+    if (d_needsFullRender || d_sortMode == ViewSortMode::NoSorting ||
+        !d_itemModel->areIndicesEqual(args.d_parentIndex, d_itemModel->getRootIndex()))
         return;
 
-    sort(d_sortedItems.begin(), d_sortedItems.end(),
-        d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    const size_t end = std::min(d_items.size(), args.d_startId + args.d_count);
+    for (size_t i = args.d_startId; i < end; ++i)
+        d_pendingSortedPositions.push_back(getSortedPosition(d_items[i]));
+}
+
+//----------------------------------------------------------------------------//
+void ListView::rebuildItemHeights(size_t first_position)
+{
+    d_itemHeights.erase(first_position,
+        d_itemHeights.size() - first_position);
+
+    for (size_t i = first_position; i < d_sortedItems.size(); ++i)
+        d_itemHeights.append(d_sortedItems[i]->d_size.d_height);
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getSortedPosition(const ListViewItemRenderingState* item) const
+{
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        const std::pair<ViewItemsVector::const_iterator,
+            ViewItemsVector::const_iterator> range = std::equal_range(
+                d_sortedItems.begin(), d_sortedItems.end(), item,
+                d_sortMode == ViewSortMode::Ascending ?
+                    &listViewItemPointerLess : &listViewItemPointerGreater);
+
+        ViewItemsVector::const_iterator itor =
+            std::find(range.first, range.second, item);
+
+        if (itor != range.second)
+            return itor - d_sortedItems.begin();
+    }
+
+    return std::find(d_sortedItems.begin(), d_sortedItems.end(), item) -
+        d_sortedItems.begin();
 }
 
 //----------------------------------------------------------------------------//
@@ -312,7 +643,37 @@ void ListView::resortView()
 void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index,
     float& max_width, float& total_height)
 {
-    String text = d_itemModel->getData(index);
+    item.d_index = index;
+    item.d_isSelected = isIndexSelected(index);
+
+    if (d_isVirtualizationEnabled)
+    {
+        // the item is formatted and measured once it becomes visible.
+        item.clearStringAndFormatting();
+        item.d_size = Sizef(0.0f, getItemHeightEstimate());
+    }
+    else
+    {
+        formatItem(item);
+        max_width = std::max(item.d_size.d_width, max_width);
+    }
+
+    total_height += item.d_size.d_height;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateItemIndices(size_t first_child)
+{
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+
+    for (size_t i = first_child; i < d_items.size(); ++i)
+        d_items[i]->d_index = d_itemModel->makeIndex(i, root_index);
+}
+
+//----------------------------------------------------------------------------//
+void ListView::formatItem(ListViewItemRenderingState& item)
+{
+    String text = d_itemModel->getData(item.d_index);
 
     item.setStringAndFormatting(
         getRenderedStringParser().parse(text, getFont(), &d_textColourRect),
@@ -326,19 +687,87 @@ void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index,
     itemsAreaSize.d_width -= 2;
     item.d_formattedString->format(this, itemsAreaSize);
 
-    item.d_index = index;
     item.d_text = text;
-    item.d_icon = d_itemModel->getData(index, ItemDataRole::Icon);
+    item.d_icon = d_itemModel->getData(item.d_index, ItemDataRole::Icon);
 
     item.d_size = Sizef(
         item.d_formattedString->getHorizontalExtent(this),
         item.d_formattedString->getVerticalExtent(this));
+}
 
-    max_width = std::max(item.d_size.d_width, max_width);
+//----------------------------------------------------------------------------//
+void ListView::formatVisibleItems()
+{
+    const float view_top = getVertScrollbar()->getScrollPosition();
+    const float view_bottom =
+        view_top + getViewRenderer()->getViewRenderArea().getHeight();
 
-    total_height += item.d_size.d_height;
+    ++d_visiblePass;
 
-    item.d_isSelected = isIndexSelected(index);
+    size_t i = getItemPositionAtOffset(view_top);
+    float item_top = getItemOffset(i);
+    for (; i < d_sortedItems.size() && item_top < view_bottom; ++i)
+    {
+        ListViewItemRenderingState& item = *d_sortedItems[i];
+
+        if (item.d_formattedString == nullptr)
+        {
+            d_renderedTotalHeight -= item.d_size.d_height;
+            formatItem(item);
+            d_renderedTotalHeight += item.d_size.d_height;
+            d_renderedMaxWidth =
+                std::max(item.d_size.d_width, d_renderedMaxWidth);
+            d_itemHeights.setHeight(i, item.d_size.d_height);
+
+            ++d_formattedItemCount;
+        }
+
+        item.d_lastVisiblePass = d_visiblePass;
+        item_top += item.d_size.d_height;
+    }
+
+    trimFormattedItems();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::trimFormattedItems()
+{
+    if (d_formattedItemCount <= d_formattedItemCacheSize)
+        return;
+
+    std::vector<ListViewItemRenderingState*> candidates;
+    for (ViewItemsVector::iterator itor = d_items.begin();
+        itor != d_items.end(); ++itor)
+    {
+        if ((*itor)->d_formattedString != nullptr &&
+            (*itor)->d_lastVisiblePass != d_visiblePass)
+            candidates.push_back(*itor);
+    }
+
+    // trim down to three quarters of the cache size so that the scan above
+    // is not repeated for every newly formatted item.
+    const size_t target_count =
+        d_formattedItemCacheSize - d_formattedItemCacheSize / 4;
+    const size_t evict_count =
+        std::min(candidates.size(), d_formattedItemCount - target_count);
+
+    std::nth_element(candidates.begin(), candidates.begin() + evict_count,
+        candidates.end(), &listViewItemPointerLessRecentlyVisible);
+
+    for (size_t i = 0; i < evict_count; ++i)
+        candidates[i]->clearStringAndFormatting();
+
+    d_formattedItemCount -= evict_count;
+}
+
+//----------------------------------------------------------------------------//
+float ListView::getItemHeightEstimate() const
+{
+    if (d_estimatedItemHeight > 0.0f)
+        return d_estimatedItemHeight;
+
+    const Font* font = getFont();
+    return font != nullptr ? font->getLineSpacing() : 1.0f;
 }
 
 //----------------------------------------------------------------------------//
@@ -347,69 +776,137 @@ bool ListView::onChildrenAdded(const EventArgs& args)
     ItemView::onChildrenAdded(args);
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
-    if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+    // a pending full render rebuilds all the items anyway
+    if (d_needsFullRender ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
     ViewItemsVector items;
     for (size_t i = 0; i < margs.d_count; ++i)
     {
-        ListViewItemRenderingState item(this);
+        ListViewItemRenderingState* item = new ListViewItemRenderingState(this);
 
-        updateItem(item,
+        updateItem(*item,
             d_itemModel->makeIndex(margs.d_startId + i, margs.d_parentIndex),
             d_renderedMaxWidth, d_renderedTotalHeight);
 
-        items.push_back(std::move(item));
+        items.push_back(item);
     }
 
-    d_items.insert(d_items.begin() + margs.d_startId, std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    d_items.insert(d_items.begin() + margs.d_startId, items.begin(), items.end());
+    // the sorting below compares the existing items too, of which only
+    // those after the new ones have moved.
+    updateItemIndices(margs.d_startId + margs.d_count);
+    insertSortedItems(items, margs.d_startId);
 
-    //TODO: insert in the right place directly!
-    resortListView();
     invalidateView(false);
     return true;
 }
 
+//----------------------------------------------------------------------------//
+bool ListView::onChildrenWillBeRemoved(const EventArgs& args)
+{
+    ItemView::onChildrenWillBeRemoved(args);
+    findPendingSortedPositions(static_cast<const ModelEventArgs&>(args));
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 bool ListView::onChildrenRemoved(const EventArgs& args)
 {
     ItemView::onChildrenRemoved(args);
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
-    if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+    if (d_needsFullRender ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
     ViewItemsVector::iterator begin = d_items.begin() + margs.d_startId;
     ViewItemsVector::iterator end = begin + margs.d_count;
 
+    ViewItemsVector items(begin, end);
+    removeSortedItems(items, margs.d_startId);
+
     for (ViewItemsVector::iterator itor = begin; itor < end; ++itor)
     {
-        d_renderedTotalHeight -= (*itor).d_size.d_height;
+        d_renderedTotalHeight -= (*itor)->d_size.d_height;
+
+        if (d_isVirtualizationEnabled && (*itor)->d_formattedString != nullptr)
+            --d_formattedItemCount;
+
+        delete *itor;
     }
 
     d_items.erase(begin, end);
+    updateItemIndices(margs.d_startId);
 
-    resortListView();
     invalidateView(false);
     return true;
 }
 
 //----------------------------------------------------------------------------//
-Rectf ListView::getIndexRect(const ModelIndex& index)
+bool ListView::onChildrenDataWillChange(const EventArgs& args)
 {
-    int child_id = d_itemModel->getChildId(index);
-    if (child_id == -1)
+    ItemView::onChildrenDataWillChange(args);
+    findPendingSortedPositions(static_cast<const ModelEventArgs&>(args));
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ListView::onChildrenDataChanged(const EventArgs& args)
+{
+    ItemView::onChildrenDataChanged(args);
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (d_needsFullRender ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        return true;
+
+    const size_t end = std::min(d_items.size(), margs.d_startId + margs.d_count);
+    if (margs.d_startId >= end)
+        return true;
+
+    ViewItemsVector items(d_items.begin() + margs.d_startId, d_items.begin() + end);
+
+    // move the changed items to their new sorted positions
+    if (d_sortMode != ViewSortMode::NoSorting)
     {
-        return Rectf(0, 0, 0, 0);
+        removeSortedItems(items, margs.d_startId);
+        insertSortedItems(items, 0);
     }
 
-    glm::vec2 pos(0, 0);
+    if (!d_isVirtualizationEnabled)
+        return true;
 
-    for (size_t i = 0; i < static_cast<size_t>(child_id); ++i)
+    // drop the stale formatting, visible items get formatted again when the
+    // view is prepared for rendering.
+    for (ViewItemsVector::iterator itor = items.begin(); itor != items.end(); ++itor)
     {
-        pos.y += d_items.at(i).d_size.d_height;
+        if ((*itor)->d_formattedString == nullptr)
+            continue;
+
+        (*itor)->clearStringAndFormatting();
+        --d_formattedItemCount;
     }
 
-    return Rectf(pos, d_items.at(static_cast<size_t>(child_id)).d_size);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+Rectf ListView::getIndexRect(const ModelIndex& index)
+{
+    int child_id = d_itemModel->getChildId(index);
+    if (child_id == -1 || static_cast<size_t>(child_id) >= d_items.size())
+    {
+        return Rectf(0, 0, 0, 0);
+    }
+
+    const size_t position =
+        getSortedPosition(d_items[static_cast<size_t>(child_id)]);
+    if (position >= d_sortedItems.size())
+        return Rectf(0, 0, 0, 0);
+
+    return Rectf(glm::vec2(0, getItemOffset(position)),
+        d_sortedItems[position]->d_size);
 }
 }
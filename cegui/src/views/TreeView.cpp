@@ -27,9 +27,10 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
 ***************************************************************************/
 #include "CEGUI/CoordConverter.h"
-#include "CEGUI/Exceptions.h"
 #include "CEGUI/views/TreeView.h"
 
+#include <algorithm>
+
 #if defined (_MSC_VER)
 #   pragma warning(push)
 #   pragma warning(disable : 4355)
@@ -77,6 +78,8 @@ TreeViewItemRenderingState::TreeViewItemRenderingState(TreeView* attached_tree_v
     d_childId(0),
     d_subtreeIsExpanded(false),
     d_nestedLevel(0),
+    d_subtreeHeight(0),
+    d_subtreeHeightIsValid(false),
     d_attachedTreeView(attached_tree_view)
 {
 }
@@ -85,6 +88,7 @@ TreeViewItemRenderingState::TreeViewItemRenderingState(TreeView* attached_tree_v
 void TreeViewItemRenderingState::sortChildren()
 {
     d_renderedChildren.clear();
+    d_subtreeHeightIsValid = false;
 
     for (ViewItemsVector::iterator itor = d_children.begin();
         itor != d_children.end(); ++itor)
@@ -262,6 +266,7 @@ void TreeView::updateRenderingStateForItem(TreeViewItemRenderingState& item,
 {
     // subtract the previous height
     rendered_total_height -= item.d_size.d_height;
+    item.d_subtreeHeightIsValid = false;
 
     fillRenderingState(item,
         d_itemModel->makeIndex(item.d_childId, item.d_parentIndex),
@@ -319,49 +324,88 @@ ModelIndex TreeView::indexAtWithAction(const glm::vec2& position,
     if (!render_area.isPointInRectf(window_position))
         return ModelIndex();
 
-    float cur_height = render_area.d_min.y - getVertScrollbar()->getScrollPosition();
-    bool handled = false;
-    return indexAtRecursive(d_rootItemState, cur_height, window_position,
-        handled, action);
-}
+    updateSubtreeHeights(d_rootItemState);
 
-//----------------------------------------------------------------------------//
-ModelIndex TreeView::indexAtRecursive(TreeViewItemRenderingState& item,
-    float& cur_height, const glm::vec2& window_position, bool& handled,
-    TreeViewItemAction action)
-{
-    float next_height = cur_height + item.d_size.d_height;
+    // descend towards the item under the position, skipping whole subtrees
+    // by using the offsets of the rendered children.
+    float offset = window_position.y - render_area.d_min.y +
+        getVertScrollbar()->getScrollPosition();
+    TreeViewItemRenderingState* item = &d_rootItemState;
 
-    if (window_position.y >= cur_height &&
-        window_position.y <= next_height)
+    while (offset >= item->d_size.d_height)
     {
-        handled = true;
-
-        float expander_width = getViewRenderer()->getSubtreeExpanderSize().d_width;
-        float base_x = getViewRenderer()->getSubtreeExpanderXIndent(item.d_nestedLevel);
-        base_x -= getHorzScrollbar()->getScrollPosition();
-        if (window_position.x >= base_x &&
-            window_position.x <= base_x + expander_width)
-        {
-            (this->*action)(item, true);
+        offset -= item->d_size.d_height;
+
+        const std::vector<float>& offsets = item->d_renderedChildrenOffsets;
+        const size_t child = std::upper_bound(offsets.begin(), offsets.end(),
+            offset) - offsets.begin();
+
+        if (child == 0)
+            return ModelIndex();
+
+        offset -= offsets[child - 1];
+        item = item->d_renderedChildren[child - 1];
+
+        if (offset >= item->d_subtreeHeight)
             return ModelIndex();
-        }
+    }
 
-        (this->*action)(item, false);
-        return ModelIndex(d_itemModel->makeIndex(item.d_childId, item.d_parentIndex));
+    float expander_width = getViewRenderer()->getSubtreeExpanderSize().d_width;
+    float base_x = getViewRenderer()->getSubtreeExpanderXIndent(item->d_nestedLevel);
+    base_x -= getHorzScrollbar()->getScrollPosition();
+    if (window_position.x >= base_x &&
+        window_position.x <= base_x + expander_width)
+    {
+        (this->*action)(*item, true);
+        return ModelIndex();
     }
 
-    cur_height = next_height;
+    (this->*action)(*item, false);
+    return ModelIndex(d_itemModel->makeIndex(item->d_childId, item->d_parentIndex));
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::updateSubtreeHeights(TreeViewItemRenderingState& item)
+{
+    if (item.d_subtreeHeightIsValid)
+        return;
+
+    float offset = 0;
+    item.d_renderedChildrenOffsets.resize(item.d_renderedChildren.size());
 
     for (size_t i = 0; i < item.d_renderedChildren.size(); ++i)
     {
-        ModelIndex index = indexAtRecursive(*item.d_renderedChildren.at(i),
-            cur_height, window_position, handled, action);
-        if (handled)
-            return index;
+        TreeViewItemRenderingState& child = *item.d_renderedChildren[i];
+        updateSubtreeHeights(child);
+
+        item.d_renderedChildrenOffsets[i] = offset;
+        offset += child.d_subtreeHeight;
     }
 
-    return ModelIndex();
+    item.d_subtreeHeight = item.d_size.d_height + offset;
+    item.d_subtreeHeightIsValid = true;
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::invalidateSubtreeHeights(const ModelIndex& index)
+{
+    std::vector<int> ids_path;
+    getChildIdsPath(index, ids_path);
+
+    TreeViewItemRenderingState* item = &d_rootItemState;
+    item->d_subtreeHeightIsValid = false;
+
+    while (!ids_path.empty())
+    {
+        size_t child_id = static_cast<size_t>(ids_path.back());
+        ids_path.pop_back();
+
+        if (child_id >= item->d_children.size())
+            return;
+
+        item = &item->d_children[child_id];
+        item->d_subtreeHeightIsValid = false;
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -380,6 +424,7 @@ void TreeView::toggleSubtree(TreeViewItemRenderingState& item)
 
     ItemViewEventArgs args(this,
         d_itemModel->makeIndex(item.d_childId, item.d_parentIndex));
+    invalidateSubtreeHeights(args.d_index);
 
     if (item.d_subtreeIsExpanded)
     {
@@ -459,6 +504,7 @@ bool TreeView::onChildrenRemoved(const EventArgs& args)
     item->d_children.erase(begin, end);
 
     item->sortChildren();
+    invalidateSubtreeHeights(margs.d_parentIndex);
     invalidateView(false);
     return true;
 }
@@ -499,6 +545,7 @@ bool TreeView::onChildrenAdded(const EventArgs& args)
         states.begin(), states.end());
 
     item->sortChildren();
+    invalidateSubtreeHeights(margs.d_parentIndex);
     invalidateView(false);
     return true;
 }
@@ -519,21 +566,7 @@ void TreeView::onSubtreeCollapsed(ItemViewEventArgs& args)
 TreeViewItemRenderingState* TreeView::getTreeViewItemForIndex(const ModelIndex& index)
 {
     std::vector<int> ids_stack;
-    ModelIndex root_index = d_itemModel->getRootIndex();
-    ModelIndex temp_index = index;
-
-    // we create a stack of child ids which will allow us to drill back
-    // in the right hierarchy.
-    do
-    {
-        int id = d_itemModel->getChildId(temp_index);
-        if (id == -1)
-            break;
-
-        ids_stack.push_back(id);
-        temp_index = d_itemModel->getParentIndex(temp_index);
-    } while (d_itemModel->isValidIndex(temp_index) &&
-        !d_itemModel->areIndicesEqual(temp_index, root_index));
+    getChildIdsPath(index, ids_stack);
 
     TreeViewItemRenderingState* item = &d_rootItemState;
     while(!ids_stack.empty())
@@ -550,6 +583,27 @@ TreeViewItemRenderingState* TreeView::getTreeViewItemForIndex(const ModelIndex&
     return item;
 }
 
+//----------------------------------------------------------------------------//
+void TreeView::getChildIdsPath(const ModelIndex& index,
+    std::vector<int>& ids_path) const
+{
+    ModelIndex root_index = d_itemModel->getRootIndex();
+    ModelIndex temp_index = index;
+
+    // we create a stack of child ids which will allow us to drill back
+    // in the right hierarchy.
+    do
+    {
+        int id = d_itemModel->getChildId(temp_index);
+        if (id == -1)
+            break;
+
+        ids_path.push_back(id);
+        temp_index = d_itemModel->getParentIndex(temp_index);
+    } while (d_itemModel->isValidIndex(temp_index) &&
+        !d_itemModel->areIndicesEqual(temp_index, root_index));
+}
+
 //----------------------------------------------------------------------------//
 void TreeView::resortView()
 {
@@ -581,10 +635,42 @@ void TreeView::expandSubtreeRecursive(TreeViewItemRenderingState& item)
 }
 
 //----------------------------------------------------------------------------//
-Rectf TreeView::getIndexRect(const ModelIndex&)
+Rectf TreeView::getIndexRect(const ModelIndex& index)
 {
-    //TODO: implement for tree view. What do we do for indices in closed subtrees?
-    throw InvalidRequestException("Not implemented for tree view yet.");
+    if (d_itemModel == nullptr)
+        return Rectf(0, 0, 0, 0);
+
+    updateSubtreeHeights(d_rootItemState);
+
+    std::vector<int> ids_path;
+    getChildIdsPath(index, ids_path);
+
+    // indices inside collapsed subtrees have no rect of their own.
+    TreeViewItemRenderingState* item = &d_rootItemState;
+    float offset = 0;
+    while (!ids_path.empty())
+    {
+        size_t child_id = static_cast<size_t>(ids_path.back());
+        ids_path.pop_back();
+
+        if (child_id >= item->d_children.size())
+            return Rectf(0, 0, 0, 0);
+
+        TreeViewItemRenderingState* child = &item->d_children[child_id];
+        std::vector<TreeViewItemRenderingState*>::const_iterator itor =
+            std::find(item->d_renderedChildren.begin(),
+                item->d_renderedChildren.end(), child);
+
+        offset += item->d_size.d_height +
+            item->d_renderedChildrenOffsets[itor - item->d_renderedChildren.begin()];
+        item = child;
+    }
+
+    const float indent =
+        getViewRenderer()->getSubtreeExpanderXIndent(item->d_nestedLevel) +
+        getViewRenderer()->getSubtreeExpanderSize().d_width;
+
+    return Rectf(glm::vec2(indent, offset), item->d_size);
 }
 
 #if defined(_MSC_VER)
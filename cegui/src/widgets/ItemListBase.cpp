@@ -118,6 +118,15 @@ void ItemListBase::initialiseComponents(void)
         Event::Subscriber(&ItemListBase::handle_PaneChildRemoved, this));
 }
 
+/*************************************************************************
+	Release the items before the list is pooled for reuse
+*************************************************************************/
+void ItemListBase::resetForReuse()
+{
+    resetList();
+    Window::resetForReuse();
+}
+
 
 /*************************************************************************
 	Return the item at index position 'index'.
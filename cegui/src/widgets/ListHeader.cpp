@@ -29,7 +29,7 @@
 #include "CEGUI/widgets/ListHeader.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/CoordConverter.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/PropertyHelper.h"
 #include <sstream>
 
 
@@ -729,11 +729,11 @@ void ListHeader::setColumnWidth(unsigned int column, const UDim& width)
 ListHeaderSegment* ListHeader::createInitialisedSegment(const String& text, unsigned int id, const UDim& width)
 {
 	// Build unique name
-	std::stringstream& name = SharedStringstream::GetPreparedStream();
-	name << SegmentNameSuffix << d_uniqueIDNumber;
+	const String name = SegmentNameSuffix +
+		PropertyHelper<std::uint32_t>::toString(d_uniqueIDNumber);
 
 	// create segment.
-	ListHeaderSegment* newseg = createNewSegment(name.str());
+	ListHeaderSegment* newseg = createNewSegment(name);
 	d_uniqueIDNumber++;
 
 	// setup segment;
@@ -50,6 +50,16 @@ void ListWidget::initialiseComponents()
     setModel(&d_itemModel);
 }
 
+//----------------------------------------------------------------------------//
+void ListWidget::resetForReuse()
+{
+    ListView::resetForReuse();
+
+    // the items were added to our own model, which a new list starts with empty
+    d_itemModel.clear(true);
+    setModel(&d_itemModel);
+}
+
 //----------------------------------------------------------------------------//
 void ListWidget::setIndexSelectionState(size_t item_index, bool state)
 {
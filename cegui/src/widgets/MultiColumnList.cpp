@@ -650,6 +650,19 @@ void MultiColumnList::initialiseComponents(void)
 	performChildWindowLayout();
 }
 
+/*************************************************************************
+	Release rows and columns before the list is pooled for reuse
+*************************************************************************/
+void MultiColumnList::resetForReuse()
+{
+    // rows and columns are not reset through properties
+    resetList();
+    while (getColumnCount() != 0)
+        removeColumn(getColumnCount() - 1);
+
+    Window::resetForReuse();
+}
+
 
 /*************************************************************************
 	Remove all items from the list.
@@ -36,6 +36,8 @@
 #include "CEGUI/Clipboard.h"
 #include "CEGUI/UndoHandler.h"
 
+#include <algorithm>
+
 
 namespace CEGUI
 {
@@ -84,6 +86,14 @@ MultiLineEditbox::MultiLineEditbox(const String& type, const String& name) :
 	d_wordWrap(true),
 	d_lastRenderWidth(0.0),
 	d_widestExtent(0.0f),
+	d_formattedFont(nullptr),
+	d_formattedLength(0),
+	d_shiftedLine(0),
+	d_lineShift(0),
+	d_hasTextEdit(false),
+	d_editStart(0),
+	d_editEnd(0),
+	d_editLengthChange(0),
 	d_forceVertScroll(false),
 	d_forceHorzScroll(false),
 	d_selectionBrush(nullptr)
@@ -154,16 +164,16 @@ void MultiLineEditbox::ensureCaretIsVisible(void)
 	{
 		Rectf textArea(getTextRenderArea());
 
-		size_t caretLineIdx = d_caretPos - d_lines[caretLine].d_startIdx;
+		size_t caretLineIdx = d_caretPos - getLineStartIndex(caretLine);
 
 		float ypos = caretLine * fnt->getLineSpacing();
 
 
         float xpos = 0;
-        String caretLineSubstr = getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx);
 #if (CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UTF_8)
-        xpos = fnt->getTextAdvance(caretLineSubstr);
+        xpos = fnt->getTextAdvance(getText(), getLineStartIndex(caretLine), caretLineIdx);
 #else
+        String caretLineSubstr = getText().substr(getLineStartIndex(caretLine), caretLineIdx);
         if(caretLineSubstr.isUtf8StringValid())
         {
             xpos = fnt->getTextAdvance(caretLineSubstr);
@@ -278,111 +288,27 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 {
 	d_widestExtent = 0.0f;
 
-	String paraText;
-
 	const Font* fnt = getFont();
 
 	if (fnt)
 	{
 		float areaWidth = getTextRenderArea().getWidth();
-        String::size_type   currPos = 0;
-        String::size_type   paraLen;
-        LineInfo line{};
 
         d_lines.clear();
-
-        while (currPos < getText().length())
-		{
-           if ((paraLen = getText().find_first_of(d_lineBreakChars, currPos)) == String::npos)
-			{
-               paraLen = getText().length() - currPos;
-			}
-			else
-			{
-				++paraLen -= currPos;
-			}
-
-            paraText = getText().substr(currPos, paraLen);
-
-			if (!d_wordWrap || (areaWidth <= 0.0f))
-			{
-				// no word wrapping, so we are just one long line.
-				line.d_startIdx = currPos;
-				line.d_length	= paraLen;
-				line.d_extent	= fnt->getTextExtent(paraText);
-				d_lines.push_back(line);
-
-				// update widest, if needed.
-				if (line.d_extent > d_widestExtent)
-				{
-					d_widestExtent = line.d_extent;
-				}
-
-			}
-			// must word-wrap the paragraph text
-			else
-			{
-				String::size_type lineIndex = 0;
-
-				// while there is text in the string
-				while (lineIndex < paraLen)
-				{
-					String::size_type  lineLen = 0;
-					float lineExtent = 0.0f;
-
-					// loop while we have not reached the end of the paragraph string
-					while (lineLen < (paraLen - lineIndex))
-					{
-						// get cp / char count of next token
-						size_t nextTokenSize = getNextTokenLength(paraText, lineIndex + lineLen);
-
-						// get pixel width of the token
-						float tokenExtent  = fnt->getTextExtent(paraText.substr(lineIndex + lineLen, nextTokenSize));
-
-						// would adding this token would overflow the available width
-						if ((lineExtent + tokenExtent) > areaWidth)
-						{
-							// Was this the first token?
-							if (lineLen == 0)
-							{
-								// get point at which to break the token
-								lineLen = fnt->getCharAtPixel(paraText.substr(lineIndex, nextTokenSize), areaWidth);
-							}
-
-							// text wraps, exit loop early with line info up until wrap point
-							break;
-						}
-
-						// add this token to current line
-						lineLen    += nextTokenSize;
-						lineExtent += tokenExtent;
-					}
-
-					// set up line info and add to collection
-					line.d_startIdx = currPos + lineIndex;
-					line.d_length	= lineLen;
-					line.d_extent	= lineExtent;
-					d_lines.push_back(line);
-
-					// update widest, if needed.
-					if (lineExtent > d_widestExtent)
-					{
-						d_widestExtent = lineExtent;
-					}
-
-					// update position in string
-					lineIndex += lineLen;
-				}
-
-			}
-
-			// skip to next 'paragraph' in text
-			currPos += paraLen;
-		}
+        formatParagraphs(*fnt, 0, getText().length(),
+                         d_wordWrap ? areaWidth : 0.0f, d_lines);
+        updateWidestExtent();
 
 		d_lastRenderWidth = areaWidth;
+        d_formattedLength = getText().length();
+        d_shiftedLine = 0;
+        d_lineShift = 0;
 	}
 
+    d_hasTextEdit = false;
+
+    d_formattedFont = fnt;
+
     if (update_scrollbars)
         configureScrollbars();
 
@@ -390,6 +316,289 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 }
 
 
+void MultiLineEditbox::formatChangedText(const bool update_scrollbars)
+{
+    const Font* fnt = getFont();
+    const String& text = getText();
+
+    const bool hasTextEdit = d_hasTextEdit;
+    d_hasTextEdit = false;
+
+    if (!hasTextEdit || !fnt || fnt != d_formattedFont ||
+        getTextRenderArea().getWidth() != d_lastRenderWidth ||
+        text.length() != d_formattedLength + d_editLengthChange)
+    {
+        formatText(update_scrollbars);
+        return;
+    }
+
+    // widen the edited range to whole paragraphs; the text before d_editStart
+    // and after d_editEnd is the formatted one, so the paragraph boundaries
+    // found there are the same in the old text.
+    size_t startIdx = 0;
+    if (d_editStart > 0)
+    {
+        const size_t pos = text.find_last_of(d_lineBreakChars, d_editStart - 1);
+        startIdx = (pos == String::npos) ? 0 : pos + 1;
+    }
+
+    size_t endIdx = text.find_first_of(d_lineBreakChars, d_editEnd);
+    endIdx = (endIdx == String::npos) ? text.length() : endIdx + 1;
+    const size_t oldEndIdx = endIdx - d_editLengthChange;
+
+    const size_t firstLine = getLineCountBefore(startIdx);
+    const size_t lastLine = getLineCountBefore(oldEndIdx);
+
+    LineList newLines;
+    formatParagraphs(*fnt, startIdx, endIdx,
+                     d_wordWrap ? d_lastRenderWidth : 0.0f, newLines);
+
+    // the lines before the edit must hold their final start index and those
+    // after it share the pending shift, which only the lines between this
+    // edit and the previous one may need to be brought in line with.
+    if (d_lineShift != 0)
+    {
+        for (size_t i = d_shiftedLine; i < firstLine; ++i)
+            d_lines[i].d_startIdx += d_lineShift;
+        for (size_t i = lastLine; i < d_shiftedLine; ++i)
+            d_lines[i].d_startIdx -= d_lineShift;
+    }
+
+    // the widest extent only needs a full scan if a widest line went away
+    bool widestReplaced = false;
+    for (size_t i = firstLine; i < lastLine; ++i)
+        widestReplaced |= d_lines[i].d_extent >= d_widestExtent;
+
+    float newWidestExtent = 0.0f;
+    for (const LineInfo& line : newLines)
+        newWidestExtent = std::max(newWidestExtent, line.d_extent);
+
+    if (newLines.size() == lastLine - firstLine)
+        std::copy(newLines.begin(), newLines.end(), d_lines.begin() + firstLine);
+    else
+        d_lines.insert(d_lines.erase(d_lines.begin() + firstLine,
+                                     d_lines.begin() + lastLine),
+                       newLines.begin(), newLines.end());
+
+    d_shiftedLine = firstLine + newLines.size();
+    d_lineShift += d_editLengthChange;
+    d_formattedLength = text.length();
+
+    if (newWidestExtent >= d_widestExtent)
+        d_widestExtent = newWidestExtent;
+    else if (widestReplaced)
+    {
+        d_widestExtent = 0.0f;
+        updateWidestExtent();
+    }
+
+    if (update_scrollbars)
+        configureScrollbars();
+
+    invalidate();
+}
+
+
+void MultiLineEditbox::setEditedText(const String& text, size_t start_idx,
+                                     size_t erased_length, size_t inserted_length)
+{
+    noteTextEdit(start_idx, erased_length, inserted_length);
+    setText(text);
+
+    // normally consumed when the change is formatted
+    d_hasTextEdit = false;
+}
+
+
+void MultiLineEditbox::noteTextEdit(size_t start_idx, size_t erased_length,
+                                    size_t inserted_length)
+{
+    if (!d_hasTextEdit)
+    {
+        d_editStart = start_idx;
+        d_editEnd = start_idx + inserted_length;
+        d_editLengthChange = inserted_length - erased_length;
+        d_hasTextEdit = true;
+        return;
+    }
+
+    // merge with the edit not formatted yet, in the indices of the new text
+    const size_t insertedEnd = start_idx + inserted_length;
+    d_editEnd = (d_editEnd >= start_idx + erased_length) ?
+        std::max(d_editEnd - erased_length + inserted_length, insertedEnd) :
+        insertedEnd;
+    d_editStart = std::min(d_editStart, start_idx);
+    d_editLengthChange += inserted_length - erased_length;
+}
+
+
+void MultiLineEditbox::formatParagraphs(const Font& font, size_t start_idx,
+                                        size_t end_idx, float area_width,
+                                        LineList& lines) const
+{
+    const String& text = getText();
+    String::size_type currPos = start_idx;
+    String::size_type paraLen;
+    LineInfo line{};
+
+    while (currPos < end_idx)
+    {
+        if ((paraLen = text.find_first_of(d_lineBreakChars, currPos)) == String::npos ||
+            paraLen >= end_idx)
+        {
+            paraLen = end_idx - currPos;
+        }
+        else
+        {
+            ++paraLen -= currPos;
+        }
+
+        if (area_width <= 0.0f)
+        {
+            // no word wrapping, so we are just one long line.
+            line.d_startIdx = currPos;
+            line.d_length   = paraLen;
+            line.d_extent   = font.getTextExtent(text, currPos, paraLen);
+            lines.push_back(line);
+        }
+        // must word-wrap the paragraph text
+        else
+        {
+            const String::size_type paraEnd = currPos + paraLen;
+            String::size_type lineStart = currPos;
+
+            // while there is text in the paragraph
+            while (lineStart < paraEnd)
+            {
+                String::size_type lineLen = 0;
+                float lineExtent = 0.0f;
+
+                // loop while we have not reached the end of the paragraph
+                while (lineLen < (paraEnd - lineStart))
+                {
+                    // get cp / char count of next token
+                    const size_t tokenStart = lineStart + lineLen;
+                    const size_t nextTokenSize = std::min(
+                        getNextTokenLength(text, tokenStart), paraEnd - tokenStart);
+
+                    // get pixel width of the token
+                    const float tokenExtent =
+                        font.getTextExtent(text, tokenStart, nextTokenSize);
+
+                    // would adding this token would overflow the available width
+                    if ((lineExtent + tokenExtent) > area_width)
+                    {
+                        // Was this the first token?
+                        if (lineLen == 0)
+                        {
+                            // get point at which to break the token
+                            lineLen = std::min(
+                                font.getCharAtPixel(text, lineStart, area_width),
+                                lineStart + nextTokenSize) - lineStart;
+                        }
+
+                        // text wraps, exit loop early with line info up until wrap point
+                        break;
+                    }
+
+                    // add this token to current line
+                    lineLen    += nextTokenSize;
+                    lineExtent += tokenExtent;
+                }
+
+                // set up line info and add to collection
+                line.d_startIdx = lineStart;
+                line.d_length   = lineLen;
+                line.d_extent   = lineExtent;
+                lines.push_back(line);
+
+                // update position in string
+                lineStart += lineLen;
+            }
+        }
+
+        // skip to next 'paragraph' in text
+        currPos += paraLen;
+    }
+}
+
+
+size_t MultiLineEditbox::getCharAtPixelInLine(size_t line_number, float pixel) const
+{
+    const size_t lineStart = getLineStartIndex(line_number);
+    const size_t lineEnd = lineStart + d_lines[line_number].d_length;
+
+    return std::min(getFont()->getCharAtPixel(getText(), lineStart, pixel),
+                    lineEnd) - lineStart;
+}
+
+
+size_t MultiLineEditbox::getLineStartIndex(size_t line_number) const
+{
+    return d_lines[line_number].d_startIdx +
+        (line_number >= d_shiftedLine ? d_lineShift : 0);
+}
+
+
+size_t MultiLineEditbox::getLineCountBefore(size_t index) const
+{
+    // lines are sorted by their start, so binary search for the first line
+    // starting at or after the index
+    size_t first = 0;
+    size_t count = d_lines.size();
+    while (count > 0)
+    {
+        const size_t half = count / 2;
+        if (getLineStartIndex(first + half) < index)
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+            count = half;
+    }
+
+    return first;
+}
+
+
+void MultiLineEditbox::applyLineShift() const
+{
+    if (d_lineShift == 0)
+        return;
+
+    for (size_t i = d_shiftedLine; i < d_lines.size(); ++i)
+        d_lines[i].d_startIdx += d_lineShift;
+
+    d_lineShift = 0;
+}
+
+
+const MultiLineEditbox::LineList& MultiLineEditbox::getFormattedLines() const
+{
+    applyLineShift();
+    return d_lines;
+}
+
+
+MultiLineEditbox::LineInfo MultiLineEditbox::getFormattedLine(size_t line_number) const
+{
+    LineInfo line = d_lines[line_number];
+    line.d_startIdx = getLineStartIndex(line_number);
+    return line;
+}
+
+
+void MultiLineEditbox::updateWidestExtent()
+{
+    for (const LineInfo& line : d_lines)
+    {
+        if (line.d_extent > d_widestExtent)
+            d_widestExtent = line.d_extent;
+    }
+}
+
+
 size_t MultiLineEditbox::getNextTokenLength(const String& text, size_t start_idx) const
 {
 	String::size_type pos = text.find_first_of(TextUtils::DefaultWrapDelimiters, start_idx);
@@ -438,16 +647,14 @@ size_t MultiLineEditbox::getTextIndexFromPosition(const glm::vec2& pt) const
 		lineNumber = d_lines.size() - 1;
 	}
 
-    const String lineText(getText().substr(d_lines[lineNumber].d_startIdx, d_lines[lineNumber].d_length));
+    size_t lineIdx = getCharAtPixelInLine(lineNumber, wndPt.x);
 
-    size_t lineIdx = getFont()->getCharAtPixel(lineText, wndPt.x);
-
-	if (lineIdx >= lineText.length() - 1)
+	if (lineIdx >= d_lines[lineNumber].d_length - 1)
 	{
-		lineIdx = lineText.length() - 1;
+		lineIdx = d_lines[lineNumber].d_length - 1;
 	}
 
-	return d_lines[lineNumber].d_startIdx + lineIdx;
+	return getLineStartIndex(lineNumber) + lineIdx;
 }
 
 
@@ -463,26 +670,14 @@ size_t MultiLineEditbox::getLineNumberFromIndex(size_t index) const
 	{
 		return lineCount - 1;
 	}
-	else
-	{
-		size_t indexCount = 0;
-		size_t caretLine = 0;
-
-		for (; caretLine < lineCount; ++caretLine)
-		{
-			indexCount += d_lines[caretLine].d_length;
-
-			if (index < indexCount)
-			{
-				return caretLine;
-			}
-
-		}
 
-	}
+    // the line is the last one starting at or before the index
+    const size_t line = getLineCountBefore(index + 1);
+    if (line == 0)
+        throw InvalidRequestException(
+            "Unable to identify a line from the given, invalid, index.");
 
-	throw InvalidRequestException(
-        "Unable to identify a line from the given, invalid, index.");
+    return line - 1;
 }
 
 
@@ -542,7 +737,7 @@ bool MultiLineEditbox::performPaste(Clipboard& clipboard)
         undo.d_text = clipboardText;
         d_undoHandler->addUndoHistory(undo);
         newText.insert(getCaretIndex(), clipboardText);
-        setText(newText);
+        setEditedText(newText, getCaretIndex(), 0, clipboardText.length());
 
         d_caretPos += clipboardText.length();
 
@@ -567,11 +762,13 @@ void MultiLineEditbox::handleBackspace()
 
         if (getSelectionLength() != 0)
         {
-            newText.erase(getSelectionStart(), getSelectionLength());
+            const size_t eraseStart = getSelectionStart();
+            const size_t eraseLength = getSelectionLength();
+            newText.erase(eraseStart, eraseLength);
             // erase selection using mode that does not modify getText()
             // (we just want to update state)
             eraseSelectedText(false);
-            setText(newText);
+            setEditedText(newText, eraseStart, eraseLength, 0);
         }
         else if (d_caretPos > 0)
         {
@@ -595,7 +792,7 @@ void MultiLineEditbox::handleBackspace()
             d_undoHandler->addUndoHistory(undo);
             newText.erase(deleteStartPos, deleteLength);
             setCaretIndex(deleteStartPos);
-            setText(newText);
+            setEditedText(newText, deleteStartPos, deleteLength, 0);
         }
     }
 }
@@ -609,11 +806,13 @@ void MultiLineEditbox::handleDelete()
 
         if (getSelectionLength() != 0)
         {
-            newText.erase(getSelectionStart(), getSelectionLength());
+            const size_t eraseStart = getSelectionStart();
+            const size_t eraseLength = getSelectionLength();
+            newText.erase(eraseStart, eraseLength);
             // erase selection using mode that does not modify getText()
             // (we just want to update state)
             eraseSelectedText(false);
-            setText(newText);
+            setEditedText(newText, eraseStart, eraseLength, 0);
         }
         else if (getCaretIndex() < getText().length() - 1)
         {
@@ -630,7 +829,7 @@ void MultiLineEditbox::handleDelete()
             undo.d_text = newText.substr(d_caretPos, eraseLength);
             d_undoHandler->addUndoHistory(undo);
             newText.erase(d_caretPos, eraseLength);
-            setText(newText);
+            setEditedText(newText, d_caretPos, eraseLength, 0);
 
             ensureCaretIsVisible();
         }
@@ -644,7 +843,7 @@ void MultiLineEditbox::handleLineHome(bool select)
 
 	if (line < d_lines.size())
 	{
-		size_t lineStartIdx = d_lines[line].d_startIdx;
+		size_t lineStartIdx = getLineStartIndex(line);
 
 		if (d_caretPos > lineStartIdx)
 		{
@@ -669,7 +868,7 @@ void MultiLineEditbox::handleLineEnd(bool select)
 
 	if (line < d_lines.size())
 	{
-		size_t lineEndIdx = d_lines[line].d_startIdx + d_lines[line].d_length - 1;
+		size_t lineEndIdx = getLineStartIndex(line) + d_lines[line].d_length - 1;
 
 		if (d_caretPos < lineEndIdx)
 		{
@@ -694,13 +893,13 @@ void MultiLineEditbox::handleLineUp(bool select)
 
 	if (caretLine > 0)
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText(), getLineStartIndex(caretLine), d_caretPos - getLineStartIndex(caretLine));
 
 		--caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = getCharAtPixelInLine(caretLine, caretPixelOffset);
 
-		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
+		setCaretIndex(getLineStartIndex(caretLine) + newLineIndex);
 	}
 
     if (select)
@@ -720,13 +919,13 @@ void MultiLineEditbox::handleLineDown(bool select)
 
 	if ((d_lines.size() > 1) && (caretLine < (d_lines.size() - 1)))
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText(), getLineStartIndex(caretLine), d_caretPos - getLineStartIndex(caretLine));
 
 		++caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = getCharAtPixelInLine(caretLine, caretPixelOffset);
 
-		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
+		setCaretIndex(getLineStartIndex(caretLine) + newLineIndex);
 	}
 
     if (select)
@@ -746,9 +945,13 @@ void MultiLineEditbox::handleNewLine()
     {
         // erase selected text
         String newText(getText());
-        newText.erase(getSelectionStart(), getSelectionLength());
+        const size_t eraseLength = getSelectionLength();
+        newText.erase(getSelectionStart(), eraseLength);
         eraseSelectedText(false);
 
+        const size_t editStart = getCaretIndex();
+        size_t insertLength = 0;
+
         // if there is room
         if (newText.length() - 1 < d_maxTextLen)
         {
@@ -759,9 +962,10 @@ void MultiLineEditbox::handleNewLine()
             d_undoHandler->addUndoHistory(undo);
             newText.insert(getCaretIndex(), 1, static_cast<String::value_type>(0x0a));
             d_caretPos++;
+            insertLength = 1;
         }
 
-        setText(newText);
+        setEditedText(newText, editStart, eraseLength, insertLength);
     }
 }
 
@@ -776,7 +980,7 @@ void MultiLineEditbox::handlePageUp(bool select)
         newline = caretLine - nbLine;
     }
 
-    setCaretIndex(d_lines[newline].d_startIdx);
+    setCaretIndex(getLineStartIndex(newline));
 
     if (select)
     {
@@ -800,7 +1004,7 @@ void MultiLineEditbox::handlePageDown(bool select)
     {
         newline = std::min(newline,d_lines.size() - 1);
     }
-    setCaretIndex(d_lines[newline].d_startIdx + d_lines[newline].d_length - 1);
+    setCaretIndex(getLineStartIndex(newline) + d_lines[newline].d_length - 1);
     if (select)
     {
         setSelection(d_selectionStart, d_caretPos);
@@ -829,9 +1033,12 @@ void MultiLineEditbox::onCharacter(TextEventArgs& e)
     {
         // erase selected text
         String newText(getText());
-        newText.erase(getSelectionStart(), getSelectionLength());
+        const size_t eraseLength = getSelectionLength();
+        newText.erase(getSelectionStart(), eraseLength);
         eraseSelectedText(false);
 
+        const size_t editStart = getCaretIndex();
+
         // if there is room
         if (newText.length() - 1 < d_maxTextLen)
         {
@@ -849,12 +1056,12 @@ void MultiLineEditbox::onCharacter(TextEventArgs& e)
 #else
             d_caretPos++;
 #endif
-            setText(newText);
+            setEditedText(newText, editStart, eraseLength, d_caretPos - editStart);
             ++e.handled;
         }
         else
         {
-            setText(newText);
+            setEditedText(newText, editStart, eraseLength, 0);
         }
     }
     else
@@ -868,11 +1075,18 @@ void MultiLineEditbox::onCharacter(TextEventArgs& e)
 
 void MultiLineEditbox::onTextChanged(WindowEventArgs& e)
 {
-    // ensure last character is a new line
-    if ((getText().length() == 0) || (getText()[getText().length() - 1] != '\n'))
+    // ensure last character is a new line; the text is then formatted when
+    // handling the change made here.
+    const bool newlineAppended = (getText().length() == 0) ||
+        (getText()[getText().length() - 1] != '\n');
+    if (newlineAppended)
     {
         String newText = getText();
         newText.append(1, '\n');
+
+        if (d_hasTextEdit)
+            noteTextEdit(newText.length() - 1, 0, 1);
+
         setText(newText);
     }
 
@@ -882,8 +1096,9 @@ void MultiLineEditbox::onTextChanged(WindowEventArgs& e)
 
     // clear selection
     clearSelection();
-    // layout new text
-    formatText(true);
+    // layout new text, re-wrapping only the paragraphs that changed
+    if (!newlineAppended)
+        formatChangedText(true);
     // layout child windows (scrollbars) since text layout may have changed
     performChildWindowLayout();
     // ensure caret is still within the text
@@ -1184,7 +1399,7 @@ void MultiLineEditbox::handleSelectAllText(SemanticEventArgs& e)
     if (d_lines.size() <= caretLine)
         return;
 
-    size_t lineStart = d_lines[caretLine].d_startIdx;
+    size_t lineStart = getLineStartIndex(caretLine);
 
     // find end of last paragraph
     String::size_type paraStart = getText().find_last_of(d_lineBreakChars, lineStart);
@@ -104,6 +104,13 @@ void Scrollbar::initialiseComponents(void)
     performChildWindowLayout();
 }
 
+//----------------------------------------------------------------------------//
+void Scrollbar::resetForReuse()
+{
+    Window::resetForReuse();
+    setScrollPosition(0.0f);
+}
+
 //----------------------------------------------------------------------------//
 void Scrollbar::setDocumentSize(float document_size)
 {
@@ -27,6 +27,8 @@
 #include "CEGUI/widgets/ScrolledContainer.h"
 #include "CEGUI/CoordConverter.h"
 
+#include <algorithm>
+
 #if defined(_MSC_VER)
 #   pragma warning(push)
 #   pragma warning(disable : 4355)
@@ -42,7 +44,9 @@ const String ScrolledContainer::EventNamespace("ScrolledContainer");
 //----------------------------------------------------------------------------//
 ScrolledContainer::ScrolledContainer(const String& type, const String& name) :
     Window(type, name),
-    d_clientChildContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getClientChildContentArea_impl))
+    d_clientChildContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getClientChildContentArea_impl)),
+    d_childExtents(0.f, 0.f, 0.f, 0.f),
+    d_childExtentsValid(false)
 {
     setCursorInputPropagationEnabled(true);
     setRiseOnClickEnabled(false);
@@ -101,51 +105,143 @@ const Element::CachedRectf& ScrolledContainer::getNonClientChildContentArea() co
 //----------------------------------------------------------------------------//
 Rectf ScrolledContainer::getChildExtentsArea(void) const
 {
-    Rectf extents(0.f, 0.f, 0.f, 0.f);
+    const Sizef baseSize(getChildExtentsBaseSize());
+    if (baseSize != d_childExtentsBaseSize)
+    {
+        // positions relative to the base size may have changed
+        for (auto& childAreas : d_childAreas)
+            childAreas.second.d_extentsAreaValid = false;
+
+        d_childExtentsBaseSize = baseSize;
+        d_childExtentsValid = false;
+    }
+
+    if (d_childExtentsValid)
+        return d_childExtents;
+
+    d_childExtents = Rectf(0.f, 0.f, 0.f, 0.f);
 
     const size_t childCount = getChildCount();
-    if (childCount == 0)
-        return extents;
+    for (size_t i = 0; i < childCount; ++i)
+    {
+        const Window* const child = getChildAtIndex(i);
+        ChildAreas& areas = getChildAreas(*child);
+        if (!areas.d_extentsAreaValid)
+        {
+            areas.d_extentsArea = calculateChildExtentsArea(*child, baseSize);
+            areas.d_extentsAreaValid = true;
+        }
+
+        const Rectf& area = areas.d_extentsArea;
+
+        if (area.d_min.x < d_childExtents.d_min.x)
+            d_childExtents.d_min.x = area.d_min.x;
+
+        if (area.d_min.y < d_childExtents.d_min.y)
+            d_childExtents.d_min.y = area.d_min.y;
+
+        if (area.d_max.x > d_childExtents.d_max.x)
+            d_childExtents.d_max.x = area.d_max.x;
+
+        if (area.d_max.y > d_childExtents.d_max.y)
+            d_childExtents.d_max.y = area.d_max.y;
+    }
+
+    d_childExtentsValid = true;
+    return d_childExtents;
+}
 
+//----------------------------------------------------------------------------//
+Sizef ScrolledContainer::getChildExtentsBaseSize() const
+{
     Sizef baseSize = d_pixelSize;
 
+    if (!d_parent)
+        return baseSize;
+
     const auto& parentRect = d_parent->getClientChildContentArea().get();
     if (isWidthAdjustedToContent())
         baseSize.d_width = parentRect.getWidth();
     if (isHeightAdjustedToContent())
         baseSize.d_height = parentRect.getHeight();
 
-    for (size_t i = 0; i < childCount; ++i)
-    {
-        const Window* const child = getChildAtIndex(i);
-        Rectf area(
-            CoordConverter::asAbsolute(child->getPosition(), baseSize),
-            child->getPixelSize());
+    return baseSize;
+}
+
+//----------------------------------------------------------------------------//
+Rectf ScrolledContainer::calculateChildExtentsArea(const Window& child,
+                                                   const Sizef& baseSize)
+{
+    Rectf area(
+        CoordConverter::asAbsolute(child.getPosition(), baseSize),
+        child.getPixelSize());
 
-        if (child->getHorizontalAlignment() == HorizontalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - baseSize.d_width * 0.5f, 0.0f));
-        if (child->getVerticalAlignment() == VerticalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - baseSize.d_height * 0.5f));
+    if (child.getHorizontalAlignment() == HorizontalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - baseSize.d_width * 0.5f, 0.0f));
+    if (child.getVerticalAlignment() == VerticalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - baseSize.d_height * 0.5f));
+
+    return area;
+}
 
-        if (area.d_min.x < extents.d_min.x)
-            extents.d_min.x = area.d_min.x;
+//----------------------------------------------------------------------------//
+ScrolledContainer::ChildAreas& ScrolledContainer::getChildAreas(
+    const Window& child) const
+{
+    ChildAreasMap::iterator it = d_childAreas.find(&child);
+    if (it == d_childAreas.end())
+    {
+        const ChildAreas areas = { Rectf(), Rectf(), false, false };
+        it = d_childAreas.emplace(&child, areas).first;
+    }
 
-        if (area.d_min.y < extents.d_min.y)
-            extents.d_min.y = area.d_min.y;
+    return it->second;
+}
 
-        if (area.d_max.x > extents.d_max.x)
-            extents.d_max.x = area.d_max.x;
+//----------------------------------------------------------------------------//
+void ScrolledContainer::updateChildExtents(const Rectf& oldArea,
+                                           const Rectf& newArea) const
+{
+    if (!d_childExtentsValid)
+        return;
 
-        if (area.d_max.y > extents.d_max.y)
-            extents.d_max.y = area.d_max.y;
+    // if the old area was on an edge that now moves inwards, other children
+    // decide where the edge ends up. The extents always contain the origin.
+    if ((d_childExtents.d_min.x < 0.f && oldArea.d_min.x <= d_childExtents.d_min.x &&
+         newArea.d_min.x > oldArea.d_min.x) ||
+        (d_childExtents.d_min.y < 0.f && oldArea.d_min.y <= d_childExtents.d_min.y &&
+         newArea.d_min.y > oldArea.d_min.y) ||
+        (d_childExtents.d_max.x > 0.f && oldArea.d_max.x >= d_childExtents.d_max.x &&
+         newArea.d_max.x < oldArea.d_max.x) ||
+        (d_childExtents.d_max.y > 0.f && oldArea.d_max.y >= d_childExtents.d_max.y &&
+         newArea.d_max.y < oldArea.d_max.y))
+    {
+        d_childExtentsValid = false;
+        return;
     }
 
-    return extents;
+    d_childExtents.d_min.x = std::min(d_childExtents.d_min.x, newArea.d_min.x);
+    d_childExtents.d_min.y = std::min(d_childExtents.d_min.y, newArea.d_min.y);
+    d_childExtents.d_max.x = std::max(d_childExtents.d_max.x, newArea.d_max.x);
+    d_childExtents.d_max.y = std::max(d_childExtents.d_max.y, newArea.d_max.y);
 }
 
 //----------------------------------------------------------------------------//
 bool ScrolledContainer::handleChildAreaChanged(const EventArgs& e)
 {
+    const Window* const child = static_cast<const Window*>(
+        static_cast<const ElementEventArgs&>(e).element);
+
+    ChildAreas& areas = getChildAreas(*child);
+    areas.d_drawAreaValid = false;
+
+    if (areas.d_extentsAreaValid)
+    {
+        const Rectf oldArea(areas.d_extentsArea);
+        areas.d_extentsArea = calculateChildExtentsArea(*child, d_childExtentsBaseSize);
+        updateChildExtents(oldArea, areas.d_extentsArea);
+    }
+
     adjustSizeToContent();
     return true;
 }
@@ -159,26 +255,47 @@ void ScrolledContainer::subscribeOnChildAreaEvents(Window* child)
     d_childAreaChangeConnections.emplace(child,
         child->subscribeEvent(Window::EventMoved,
             Event::Subscriber(&ScrolledContainer::handleChildAreaChanged, this)));
+    d_childAreaChangeConnections.emplace(child,
+        child->subscribeEvent(Window::EventHorizontalAlignmentChanged,
+            Event::Subscriber(&ScrolledContainer::handleChildAreaChanged, this)));
+    d_childAreaChangeConnections.emplace(child,
+        child->subscribeEvent(Window::EventVerticalAlignmentChanged,
+            Event::Subscriber(&ScrolledContainer::handleChildAreaChanged, this)));
 }
 
 //----------------------------------------------------------------------------//
-void ScrolledContainer::onIsSizeAdjustedToContentChanged(ElementEventArgs& e)
+bool ScrolledContainer::isChildCulled(const Window& child) const
 {
-    // Listen to child area changes only when auto-sizing is required
-    const bool autoSize = isSizeAdjustedToContent();
-    if (autoSize && d_childAreaChangeConnections.empty())
+    const Rectf& contentArea = getClientChildContentArea().get();
+
+    if (contentArea.getSize() != d_childDrawAreasBaseSize)
     {
-        for (auto* child : d_children)
-            subscribeOnChildAreaEvents(static_cast<Window*>(child));
+        // children sized or positioned relative to the content area changed
+        for (auto& childAreas : d_childAreas)
+            childAreas.second.d_drawAreaValid = false;
+
+        d_childDrawAreasBaseSize = contentArea.getSize();
     }
-    else if (!autoSize && !d_childAreaChangeConnections.empty())
+
+    // the area is kept relative to the content area, so that scrolling, which
+    // only moves the container, leaves it valid without recalculating it
+    ChildAreas& areas = getChildAreas(child);
+    if (!areas.d_drawAreaValid || child.getUnclippedOuterRect().isCacheValid())
     {
-        for (auto& windowToConnection : d_childAreaChangeConnections)
-            windowToConnection.second->disconnect();
-        d_childAreaChangeConnections.clear();
+        areas.d_drawArea = child.getUnclippedOuterRect().get();
+        areas.d_drawArea.offset(-contentArea.getPosition());
+        areas.d_drawAreaValid = true;
     }
 
-    Window::onIsSizeAdjustedToContentChanged(e);
+    Rectf area(areas.d_drawArea);
+    area.offset(contentArea.getPosition());
+
+    // allow for the pixel alignment of the container position
+    const Rectf& clipper = getInnerRectClipper();
+    return area.d_max.x + 1.0f <= clipper.d_min.x ||
+           area.d_min.x - 1.0f >= clipper.d_max.x ||
+           area.d_max.y + 1.0f <= clipper.d_min.y ||
+           area.d_min.y - 1.0f >= clipper.d_max.y;
 }
 
 //----------------------------------------------------------------------------//
@@ -253,11 +370,18 @@ void ScrolledContainer::onChildAdded(ElementEventArgs& e)
 {
     Window::onChildAdded(e);
 
-    if (isSizeAdjustedToContent())
+    Window* const child = static_cast<Window*>(e.element);
+    subscribeOnChildAreaEvents(child);
+
+    if (d_childExtentsValid)
     {
-        subscribeOnChildAreaEvents(static_cast<Window*>(e.element));
-        adjustSizeToContent();
+        ChildAreas& areas = getChildAreas(*child);
+        areas.d_extentsArea = calculateChildExtentsArea(*child, d_childExtentsBaseSize);
+        areas.d_extentsAreaValid = true;
+        updateChildExtents(areas.d_extentsArea, areas.d_extentsArea);
     }
+
+    adjustSizeToContent();
 }
 
 //----------------------------------------------------------------------------//
@@ -274,6 +398,19 @@ void ScrolledContainer::onChildRemoved(ElementEventArgs& e)
             it->second->disconnect();
         d_childAreaChangeConnections.erase(range.first, range.second);
 
+        // a removed child is as good as one collapsed to the origin, which
+        // the extents always contain
+        ChildAreasMap::iterator areas = d_childAreas.find(static_cast<Window*>(e.element));
+        if (areas != d_childAreas.end())
+        {
+            if (areas->second.d_extentsAreaValid)
+                updateChildExtents(areas->second.d_extentsArea, Rectf(0.f, 0.f, 0.f, 0.f));
+            else
+                d_childExtentsValid = false;
+
+            d_childAreas.erase(areas);
+        }
+
         // recalculate pane size if auto-sized
         adjustSizeToContent();
     }
@@ -285,6 +422,8 @@ void ScrolledContainer::cleanupChildren(void)
     for (auto& windowToConnection : d_childAreaChangeConnections)
         windowToConnection.second->disconnect();
     d_childAreaChangeConnections.clear();
+    d_childAreas.clear();
+    d_childExtentsValid = false;
 
     Window::cleanupChildren();
 }
@@ -29,7 +29,7 @@
 #include "CEGUI/widgets/Editbox.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/WindowManager.h"
-#include "CEGUI/SharedStringStream.h"
+#include "CEGUI/StreamHelper.h"
 
 #include <stdio.h>
 #include <sstream>
@@ -265,10 +265,9 @@ namespace CEGUI
         case TextInputMode::Hexadecimal:
         {
             unsigned int tempUint;
-            std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-            sstream << std::hex << text;
-            sstream >> tempUint;
-            sstream << std::dec;
+            std::stringstream sstream;
+            prepareStream(sstream, text);
+            sstream >> std::hex >> tempUint;
             if (sstream.fail())
             {
                 throw InvalidRequestException("The string '" + getEditbox()->getText() +
@@ -280,10 +279,9 @@ namespace CEGUI
         case TextInputMode::Octal:
         {
             unsigned int tempUint;
-            std::stringstream& sstream = SharedStringstream::GetPreparedStream();
-            sstream << std::oct << text;
-            sstream >> tempUint;
-            sstream << std::dec;
+            std::stringstream sstream;
+            prepareStream(sstream, text);
+            sstream >> std::oct >> tempUint;
             if (sstream.fail())
             {
                 throw InvalidRequestException("The string '" + getEditbox()->getText() +
@@ -300,7 +298,8 @@ namespace CEGUI
 
     String Spinner::getTextFromValue(void) const
     {
-        std::stringstream& tmp = SharedStringstream::GetPreparedStream();
+        std::stringstream tmp;
+        prepareStream(tmp);
 
         switch (d_inputMode)
         {
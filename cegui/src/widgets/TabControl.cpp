@@ -124,6 +124,25 @@ void TabControl::initialiseComponents(void)
             PushButton::EventClicked, Event::Subscriber(
                 &CEGUI::TabControl::handleScrollPane, this));
 }
+
+/*************************************************************************
+Release the tabs before the control is pooled for reuse
+*************************************************************************/
+void TabControl::resetForReuse()
+{
+    // tab contents are destroyed like any other content added to the window
+    while (getTabCount() != 0)
+    {
+        Window* const contents = getTabContentsAtIndex(0);
+        removeTab_impl(contents);
+
+        if (contents->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(contents);
+    }
+
+    Window::resetForReuse();
+}
+
 /*************************************************************************
 Get the number of tabs
 *************************************************************************/
@@ -51,6 +51,16 @@ void TreeWidget::initialiseComponents()
     setModel(&d_itemModel);
 }
 
+//----------------------------------------------------------------------------//
+void TreeWidget::resetForReuse()
+{
+    TreeView::resetForReuse();
+
+    // the items were added to our own model, which a new tree starts with empty
+    d_itemModel.clear(true);
+    setModel(&d_itemModel);
+}
+
 //----------------------------------------------------------------------------//
 StandardItemModel* TreeWidget::getModel()
 {
@@ -26,7 +26,6 @@
  ***************************************************************************/
 #include "Sample.h"
 #include "CEGUI/CEGUI.h"
-#include "CEGUI/SharedStringStream.h"
 
 #include "TabControl.h"
 
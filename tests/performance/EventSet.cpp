@@ -33,6 +33,7 @@
 #include <sstream>
 
 static const CEGUI::String EVENT_NAME("ExplicitlyAddedTestEvent");
+static const CEGUI::EventId EVENT_ID(EVENT_NAME);
 
 class EventSetPerformanceTest : public PerformanceTest
 {
@@ -54,6 +55,26 @@ public:
     CEGUI::EventSet& d_eventSet;
 };
 
+class EventIdSetPerformanceTest : public PerformanceTest
+{
+public:
+    EventIdSetPerformanceTest(CEGUI::String test_name, CEGUI::EventSet& set)
+        : PerformanceTest(test_name), d_eventSet(set)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::EventArgs args;
+        for (unsigned int i = 0; i < 1000000; ++i)
+        {
+            d_eventSet.fireEvent(EVENT_ID, args);
+        }
+    }
+
+    CEGUI::EventSet& d_eventSet;
+};
+
 BOOST_AUTO_TEST_SUITE(EventSetPerformance)
 
 BOOST_AUTO_TEST_CASE(OneEventTest)
@@ -81,6 +102,21 @@ BOOST_AUTO_TEST_CASE(OneHundredEventsTest)
     test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(OneHundredEventsEventIdTest)
+{
+    CEGUI::EventSet set;
+    set.addEvent(EVENT_NAME);
+    for (unsigned int i = 0; i < 99; ++i)
+    {
+        std::stringstream s;
+        s << "Event" << i;
+        set.addEvent(s.str());
+    }
+
+    EventIdSetPerformanceTest test("1000000x event lookup by EventId (100 events)", set);
+    test.execute();
+}
+
 BOOST_AUTO_TEST_CASE(TenThousandEventsTest)
 {
     CEGUI::EventSet set;
@@ -45,6 +45,11 @@ public:
         d_window->setModel(&d_model);
     }
 
+    ~ListViewPerformanceTest()
+    {
+        d_window->setModel(nullptr);
+    }
+
     void addItems(size_t count)
     {
         for (size_t i = 0; i < count; ++i)
@@ -89,7 +94,7 @@ public:
 
     virtual void sortItems()
     {
-        d_window->setSortMode(VSM_Ascending);
+        d_window->setSortMode(ViewSortMode::Ascending);
     }
 
     StandardItemModel d_model;
@@ -103,4 +108,13 @@ BOOST_AUTO_TEST_CASE(Test)
     listview_test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(Virtualized)
+{
+    ListViewPerformanceTest listview_test("TaharezLook/ListView", "Core/ListView");
+    listview_test.d_testName += " (virtualized)";
+    listview_test.d_window->setSize(USize(cegui_absdim(300), cegui_absdim(400)));
+    listview_test.d_window->setVirtualizationEnabled(true);
+    listview_test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -27,11 +27,15 @@
 #ifndef _CEGUITestsPerformanceTest_h_
 #define _CEGUITestsPerformanceTest_h_
 
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 
 #include <boost/timer/timer.hpp>
 
 #include <iostream>
+#include <fstream>
 
 /*!
 \brief
@@ -95,12 +99,22 @@ class WindowPerformanceTest : public PerformanceTest
 public:
     WindowPerformanceTest(CEGUI::String window_type, CEGUI::String renderer) :
         PerformanceTest(window_type),
+        d_context(&CEGUI::System::getSingleton().createGUIContext(
+            CEGUI::System::getSingleton().getRenderer()->getDefaultRenderTarget())),
         d_window(0)
     {
         d_window = static_cast<TWindow*>(
             CEGUI::WindowManager::getSingleton().createWindow(
                 window_type, window_type + "-perf-test"));
         d_window->setWindowRenderer(renderer);
+        d_context->setRootWindow(d_window);
+    }
+
+    ~WindowPerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_window);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
     }
 
     virtual void render()
@@ -108,6 +122,7 @@ public:
         d_window->draw();
     }
 
+    CEGUI::GUIContext* d_context;
     TWindow* d_window;
 };
 
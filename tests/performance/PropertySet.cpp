@@ -28,6 +28,7 @@
 
 #include "PerformanceTest.h"
 #include "CEGUI/PropertySet.h"
+#include "CEGUI/PropertyHelper.h"
 #include <sstream>
 
 static const CEGUI::String PROPERTY_NAME("ExplicitlyAddedTestProperty");
@@ -70,6 +71,38 @@ public:
     CEGUI::PropertySet& d_propertySet;
 };
 
+template<typename T>
+class PropertyHelperPerformanceTest : public PerformanceTest
+{
+public:
+    PropertyHelperPerformanceTest(const CEGUI::String& test_name, const T& value):
+        PerformanceTest(test_name),
+        d_value(value)
+    {}
+
+    virtual void doTest()
+    {
+        bool roundTripped = true;
+        for (unsigned int i = 0; i < 200000; ++i)
+        {
+            const CEGUI::String str = CEGUI::PropertyHelper<T>::toString(d_value);
+            roundTripped &= CEGUI::PropertyHelper<T>::fromString(str) == d_value;
+        }
+
+        BOOST_CHECK(roundTripped);
+    }
+
+    T d_value;
+};
+
+template<typename T>
+void testPropertyHelper(const CEGUI::String& type_name, const T& value)
+{
+    PropertyHelperPerformanceTest<T> test(
+        "200000x PropertyHelper<" + type_name + "> round trip", value);
+    test.execute();
+}
+
 class TestingPropertySet : public CEGUI::PropertySet
 {
     public:
@@ -117,4 +150,42 @@ BOOST_AUTO_TEST_CASE(TypedSetTest)
     test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(NumberConversion)
+{
+    testPropertyHelper<float>("float", -1234.5678f);
+    testPropertyHelper<double>("double", 0.1);
+    testPropertyHelper<std::int32_t>("int32", -1234567);
+}
+
+BOOST_AUTO_TEST_CASE(UnifiedConversion)
+{
+    testPropertyHelper<CEGUI::UDim>("UDim", CEGUI::UDim(0.3333f, 12));
+    testPropertyHelper<CEGUI::UVector2>("UVector2",
+        CEGUI::UVector2(CEGUI::UDim(0.5f, -8), CEGUI::UDim(1, 0)));
+    testPropertyHelper<CEGUI::USize>("USize",
+        CEGUI::USize(CEGUI::UDim(0.25f, 16), CEGUI::UDim(0, 24.5f)));
+    testPropertyHelper<CEGUI::URect>("URect",
+        CEGUI::URect(CEGUI::UDim(0, 5), CEGUI::UDim(0.1f, 0),
+                     CEGUI::UDim(1, -5), CEGUI::UDim(0.9f, 0)));
+    testPropertyHelper<CEGUI::UBox>("UBox",
+        CEGUI::UBox(CEGUI::UDim(0, 1), CEGUI::UDim(0, 2),
+                    CEGUI::UDim(0.5f, 3), CEGUI::UDim(0, 4)));
+}
+
+BOOST_AUTO_TEST_CASE(ColourConversion)
+{
+    testPropertyHelper<CEGUI::Colour>("Colour", CEGUI::Colour(0xFF80C0E0));
+    testPropertyHelper<CEGUI::ColourRect>("ColourRect",
+        CEGUI::ColourRect(CEGUI::Colour(0xFF000000), CEGUI::Colour(0xFFFFFFFF),
+                          CEGUI::Colour(0x80FF0000), CEGUI::Colour(0x8000FF00)));
+}
+
+BOOST_AUTO_TEST_CASE(VectorConversion)
+{
+    testPropertyHelper<CEGUI::Sizef>("Sizef", CEGUI::Sizef(640, 480.5f));
+    testPropertyHelper<CEGUI::Rectf>("Rectf", CEGUI::Rectf(-1.5f, 2, 300, 400.25f));
+    testPropertyHelper<glm::vec3>("vec3", glm::vec3(0.1f, -2, 30));
+    testPropertyHelper<glm::quat>("quat", glm::quat(0.5f, -0.5f, 0.5f, 0.5f));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/widgets/ScrollablePane.h"
+#include "CEGUI/widgets/Scrollbar.h"
+
+class ScrollablePanePerformanceTest : public PerformanceTest
+{
+public:
+    ScrollablePanePerformanceTest(unsigned int item_count, CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_itemCount(item_count)
+    {
+        CEGUI::System& system = CEGUI::System::getSingleton();
+
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(1000, 1000));
+        d_context = &system.createGUIContext(
+            system.getRenderer()->getDefaultRenderTarget());
+
+        d_pane = static_cast<CEGUI::ScrollablePane*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/ScrollablePane"));
+        d_pane->setSize(CEGUI::USize(cegui_absdim(300), cegui_absdim(400)));
+        d_context->setRootWindow(d_pane);
+    }
+
+    ~ScrollablePanePerformanceTest()
+    {
+        d_context->setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_pane);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    void addItems()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        for (unsigned int i = 0; i < d_itemCount; ++i)
+        {
+            CEGUI::Window* item = wmgr.createWindow("TaharezLook/Button");
+            item->setText("Item");
+            item->setArea(CEGUI::URect(
+                cegui_absdim(0), cegui_absdim(static_cast<float>(i) * 30.0f),
+                cegui_absdim(250), cegui_absdim(static_cast<float>(i) * 30.0f + 25.0f)));
+            d_pane->addChild(item);
+        }
+    }
+
+    unsigned int d_itemCount;
+    CEGUI::GUIContext* d_context;
+    CEGUI::ScrollablePane* d_pane;
+};
+
+class ScrollablePaneFillPerformanceTest : public ScrollablePanePerformanceTest
+{
+public:
+    ScrollablePaneFillPerformanceTest(unsigned int item_count, CEGUI::String test_name) :
+        ScrollablePanePerformanceTest(item_count, test_name)
+    {
+    }
+
+    virtual void doTest()
+    {
+        addItems();
+    }
+};
+
+class ScrollablePaneSwipePerformanceTest : public ScrollablePanePerformanceTest
+{
+public:
+    ScrollablePaneSwipePerformanceTest(unsigned int item_count, CEGUI::String test_name) :
+        ScrollablePanePerformanceTest(item_count, test_name)
+    {
+        addItems();
+        d_context->draw();
+    }
+
+    virtual void doTest()
+    {
+        // scroll a few pixels per frame, as kinetic scrolling does
+        CEGUI::Scrollbar* scrollbar = d_pane->getVertScrollbar();
+        for (unsigned int i = 0; i < 5000; ++i)
+        {
+            scrollbar->setScrollPosition(static_cast<float>((i * 3) % 12000));
+            d_context->draw();
+        }
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(ScrollablePanePerformance)
+
+BOOST_AUTO_TEST_CASE(AddItems)
+{
+    ScrollablePaneFillPerformanceTest test(2000,
+        "2000 buttons added to a ScrollablePane");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(SwipeScroll)
+{
+    ScrollablePaneSwipePerformanceTest test(500,
+        "5000x scroll and redraw of a ScrollablePane with 500 buttons");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/String.h"
+
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+
+class StringTranscodingPerformanceTest : public PerformanceTest
+{
+public:
+    StringTranscodingPerformanceTest(CEGUI::String test_name,
+                                     const std::u32string& text)
+        : PerformanceTest(test_name),
+        d_utf32Text(text),
+        d_utf8Text(CEGUI::String::convertUtf32ToUtf8(text))
+    {
+    }
+
+    virtual void doTest()
+    {
+        size_t length = 0;
+        for (unsigned int i = 0; i < 200000; ++i)
+        {
+            length += CEGUI::String::convertUtf8ToUtf32(d_utf8Text).length();
+            length += CEGUI::String::convertUtf32ToUtf8(d_utf32Text).length();
+        }
+
+        BOOST_CHECK_EQUAL(length,
+            200000 * (d_utf32Text.length() + d_utf8Text.length()));
+    }
+
+    std::u32string d_utf32Text;
+    std::string d_utf8Text;
+};
+
+BOOST_AUTO_TEST_SUITE(StringPerformance)
+
+BOOST_AUTO_TEST_CASE(AsciiTranscoding)
+{
+    std::u32string text;
+    while (text.length() < 100)
+        text += U"The quick brown fox jumps over the lazy dog. ";
+
+    StringTranscodingPerformanceTest test(
+        "200000x UTF-8/UTF-32 round trip (ASCII text)", text);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(MixedTranscoding)
+{
+    std::u32string text;
+    while (text.length() < 100)
+        text += U"Grüße aus Köln, 日本語 \U0001F600. ";
+
+    StringTranscodingPerformanceTest test(
+        "200000x UTF-8/UTF-32 round trip (mixed text)", text);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
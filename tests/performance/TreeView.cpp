@@ -46,6 +46,11 @@ public:
         d_window->setModel(&d_model);
     }
 
+    ~TreePerformanceTest()
+    {
+        d_window->setModel(nullptr);
+    }
+
     virtual void doTest()
     {
         size_t id = 0;
@@ -77,7 +82,7 @@ public:
         }
         d_window->draw();
 
-        d_window->setSortMode(VSM_Ascending);
+        d_window->setSortMode(ViewSortMode::Ascending);
     }
 
     StandardItemModel d_model;
@@ -64,6 +64,191 @@ public:
     void (CEGUI::Window::* d_function)();
 };
 
+class WindowHierarchyPerformanceTest : public PerformanceTest
+{
+public:
+    WindowHierarchyPerformanceTest(unsigned int child_count,
+                                   unsigned int grandchild_count,
+                                   CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_childCount(child_count),
+        d_grandchildCount(grandchild_count)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+        for (unsigned int i = 0; i < d_childCount; ++i)
+        {
+            CEGUI::Window* child = root->createChild("DefaultWindow");
+            for (unsigned int j = 0; j < d_grandchildCount; ++j)
+                child->createChild("DefaultWindow");
+        }
+
+        wmgr.destroyWindow(root);
+        wmgr.cleanDeadPool();
+    }
+
+    unsigned int d_childCount;
+    unsigned int d_grandchildCount;
+};
+
+class WindowRecyclingPerformanceTest : public PerformanceTest
+{
+public:
+    WindowRecyclingPerformanceTest(size_t pool_capacity, CEGUI::String test_name) :
+        PerformanceTest(test_name)
+    {
+        CEGUI::WindowManager::getSingleton().setWindowPoolCapacity(
+            "TaharezLook/Button", pool_capacity);
+    }
+
+    ~WindowRecyclingPerformanceTest()
+    {
+        CEGUI::WindowManager::getSingleton().setWindowPoolCapacity(
+            "TaharezLook/Button", 0);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            CEGUI::Window* buttons[10];
+            for (CEGUI::Window*& button : buttons)
+            {
+                button = wmgr.createWindow("TaharezLook/Button");
+                button->setText("Button");
+            }
+
+            for (CEGUI::Window* button : buttons)
+                wmgr.destroyWindow(button);
+
+            wmgr.cleanDeadPool();
+        }
+    }
+};
+
+class WindowHitTestPerformanceTest : public PerformanceTest
+{
+public:
+    WindowHitTestPerformanceTest(unsigned int panel_count,
+                                 unsigned int item_count,
+                                 CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_panelCount(panel_count),
+        d_itemCount(item_count)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(1000, 1000));
+        CEGUI::GUIContext& context = system.createGUIContext(
+            system.getRenderer()->getDefaultRenderTarget());
+
+        // panels in a grid over the root, each with a grid of items
+        CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+        context.setRootWindow(root);
+        root->setSize(CEGUI::USize(cegui_absdim(1000), cegui_absdim(1000)));
+        const unsigned int panel_columns = 8;
+        const unsigned int item_columns = 10;
+        for (unsigned int i = 0; i < d_panelCount; ++i)
+        {
+            CEGUI::Window* panel = root->createChild("DefaultWindow");
+            panel->setArea(CEGUI::URect(
+                cegui_absdim(static_cast<float>(i % panel_columns) * 120.0f),
+                cegui_absdim(static_cast<float>(i / panel_columns) * 120.0f),
+                cegui_absdim(static_cast<float>(i % panel_columns) * 120.0f + 110.0f),
+                cegui_absdim(static_cast<float>(i / panel_columns) * 120.0f + 110.0f)));
+
+            for (unsigned int j = 0; j < d_itemCount; ++j)
+            {
+                CEGUI::Window* item = panel->createChild("DefaultWindow");
+                item->setArea(CEGUI::URect(
+                    cegui_absdim(static_cast<float>(j % item_columns) * 11.0f),
+                    cegui_absdim(static_cast<float>(j / item_columns) * 11.0f),
+                    cegui_absdim(static_cast<float>(j % item_columns) * 11.0f + 10.0f),
+                    cegui_absdim(static_cast<float>(j / item_columns) * 11.0f + 10.0f)));
+            }
+        }
+
+        unsigned int hits = 0;
+        for (unsigned int i = 0; i < 100000; ++i)
+        {
+            const glm::vec2 position(static_cast<float>((i * 7) % 1000),
+                                     static_cast<float>((i * 13) % 1000));
+            if (root->getChildAtPosition(position))
+                ++hits;
+        }
+        BOOST_CHECK(hits > 0);
+
+        context.setRootWindow(nullptr);
+        wmgr.destroyWindow(root);
+        wmgr.cleanDeadPool();
+        system.destroyGUIContext(context);
+    }
+
+    unsigned int d_panelCount;
+    unsigned int d_itemCount;
+};
+
+class ScrolledItemsPerformanceTest : public PerformanceTest
+{
+public:
+    ScrolledItemsPerformanceTest(unsigned int item_count, CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_itemCount(item_count)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::System& system = CEGUI::System::getSingleton();
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        system.notifyDisplaySizeChanged(CEGUI::Sizef(1000, 1000));
+        CEGUI::GUIContext& context = system.createGUIContext(
+            system.getRenderer()->getDefaultRenderTarget());
+
+        CEGUI::Window* pane = wmgr.createWindow("TaharezLook/ScrollablePane");
+        pane->setSize(CEGUI::USize(cegui_absdim(300), cegui_absdim(400)));
+        context.setRootWindow(pane);
+
+        for (unsigned int i = 0; i < d_itemCount; ++i)
+        {
+            CEGUI::Window* item = wmgr.createWindow("TaharezLook/Button");
+            item->setText("Item");
+            item->setArea(CEGUI::URect(
+                cegui_absdim(0), cegui_absdim(static_cast<float>(i) * 30.0f),
+                cegui_absdim(250), cegui_absdim(static_cast<float>(i) * 30.0f + 25.0f)));
+            pane->addChild(item);
+        }
+
+        // redraw everything, as a change of the look would
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            pane->invalidate(true);
+            context.draw();
+        }
+
+        context.setRootWindow(nullptr);
+        wmgr.destroyWindow(pane);
+        wmgr.cleanDeadPool();
+        system.destroyGUIContext(context);
+    }
+
+    unsigned int d_itemCount;
+};
+
 BOOST_AUTO_TEST_SUITE(WindowPerformance)
 
 BOOST_AUTO_TEST_CASE(MoveToBack)
@@ -80,4 +265,39 @@ BOOST_AUTO_TEST_CASE(MoveToFront)
     test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(CreateAndDestroyHierarchy)
+{
+    WindowHierarchyPerformanceTest test(200, 100,
+        "20000 windows created and destroyed (200 children of 100 children)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(CreateAndDestroyButtons)
+{
+    WindowRecyclingPerformanceTest test(0,
+        "1000x 10 buttons created and destroyed");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(CreateAndDestroyPooledButtons)
+{
+    WindowRecyclingPerformanceTest test(10,
+        "1000x 10 pooled buttons created and destroyed");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(HitTestWindows)
+{
+    WindowHitTestPerformanceTest test(60, 50,
+        "100000x hit test of 60 panels with 50 items each");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(RedrawScrolledItems)
+{
+    ScrolledItemsPerformanceTest test(500,
+        "100x redraw of a ScrollablePane with 500 buttons");
+    test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -29,9 +29,40 @@
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/AnimationManager.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/TypedProperty.h"
 
 #include <boost/test/unit_test.hpp>
 
+//! float property keeping the last written value in the property itself
+class StoredFloatProperty : public CEGUI::TypedProperty<float>
+{
+public:
+    StoredFloatProperty(const CEGUI::String& name) :
+        CEGUI::TypedProperty<float>(name, "", "Test"),
+        d_value(0.0f)
+    {}
+
+    float d_value;
+
+protected:
+    void setNative_impl(CEGUI::PropertyReceiver*, float value) override
+    {
+        d_value = value;
+    }
+
+    float getNative_impl(const CEGUI::PropertyReceiver*) const override
+    {
+        return d_value;
+    }
+
+    CEGUI::Property* clone() const override
+    {
+        return new StoredFloatProperty(*this);
+    }
+};
+
 struct SampleAnimationSetupFixture
 {
     SampleAnimationSetupFixture()
@@ -179,4 +210,100 @@ BOOST_AUTO_TEST_CASE(ZeroDurationReplayModes)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TypedAffector_AppliesInterpolatedValues)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(d_zeroToOne);
+    d_zeroToOne->setReplayMode(CEGUI::Animation::ReplayMode::PlayOnce);
+    instance->setTargetWindow(window);
+
+    instance->start(false);
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+
+    // changing a key frame must be picked up by the parsed values
+    d_zeroToOne->getAffectorAtIndex(0)->getKeyFrameAtIndex(1)->setValue("0.5");
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+
+    // interpolator not matching the property type falls back to strings
+    CEGUI::Affector* affector = d_zeroToOne->getAffectorAtIndex(0);
+    affector->setInterpolator("String");
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+
+    affector->setInterpolator("float");
+    affector->getKeyFrameAtIndex(1)->setValue("1");
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(TypedAffector_RelativeAndSourceProperty)
+{
+    CEGUI::Animation* animation = CEGUI::AnimationManager::getSingleton().createAnimation("TypedRelative");
+    animation->setDuration(1.0f);
+    animation->setReplayMode(CEGUI::Animation::ReplayMode::PlayOnce);
+
+    CEGUI::Affector* slide = animation->createAffector("Position", "UVector2");
+    slide->setApplicationMethod(CEGUI::Affector::ApplicationMethod::ApplyRelative);
+    slide->createKeyFrame(0.0f, "{{0,0},{0,0}}");
+    slide->createKeyFrame(1.0f, "{{0,100},{0,40}}");
+
+    CEGUI::Affector* fade = animation->createAffector("Alpha", "float");
+    fade->createKeyFrame(0.0f, "", CEGUI::KeyFrame::Progression::Linear, "Alpha");
+    fade->createKeyFrame(1.0f, "0");
+
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    window->setPosition(CEGUI::UVector2(cegui_absdim(10), cegui_absdim(20)));
+    window->setAlpha(0.8f);
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(animation);
+    instance->setTargetWindow(window);
+    instance->start(false);
+    instance->step(0.5f);
+
+    BOOST_CHECK_CLOSE(window->getPosition().d_x.d_offset, 60.0f, 0.0001f);
+    BOOST_CHECK_CLOSE(window->getPosition().d_y.d_offset, 40.0f, 0.0001f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.4f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(animation);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(TypedAffector_FollowsReplacedProperty)
+{
+    CEGUI::Animation* animation = CEGUI::AnimationManager::getSingleton().createAnimation("TypedReplaced");
+    animation->setDuration(1.0f);
+    animation->setReplayMode(CEGUI::Animation::ReplayMode::PlayOnce);
+
+    CEGUI::Affector* affector = animation->createAffector("Level", "float");
+    affector->createKeyFrame(0.0f, "0");
+    affector->createKeyFrame(1.0f, "1");
+
+    StoredFloatProperty first("Level");
+    StoredFloatProperty second("Level");
+
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    window->addProperty(&first);
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(animation);
+    instance->setTargetWindow(window);
+    instance->start(false);
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(first.d_value, 0.25f, 0.0001f);
+
+    // the cached property must not outlive its removal from the target
+    window->removeProperty("Level");
+    window->addProperty(&second);
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(first.d_value, 0.25f, 0.0001f);
+    BOOST_CHECK_CLOSE(second.d_value, 0.5f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(animation);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
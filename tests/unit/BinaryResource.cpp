@@ -0,0 +1,165 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/BinaryResource.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLParser.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+const CEGUI::String Layout(
+    "<GUILayout version=\"4\">\n"
+    "  <Window type=\"TaharezLook/FrameWindow\" name=\"Dialog\">\n"
+    "    <Property name=\"Area\" value=\"{{0,10},{0,20},{0.5,0},{0.5,0}}\" />\n"
+    "    <Property name=\"Text\">First line\n\xc3\xa9t\xc3\xa9</Property>\n"
+    "    <Window type=\"TaharezLook/Button\" name=\"Ok\">\n"
+    "      <Property name=\"Text\" value=\"Ok\" />\n"
+    "    </Window>\n"
+    "  </Window>\n"
+    "</GUILayout>\n");
+
+//! Writes down everything it is given.
+class RecordingHandler : public CEGUI::XMLHandler
+{
+public:
+    const CEGUI::String& getDefaultResourceGroup() const override
+    {
+        static const CEGUI::String ret;
+        return ret;
+    }
+
+    void elementStart(const CEGUI::String& element,
+                      const CEGUI::XMLAttributes& attributes) override
+    {
+        flushText();
+
+        // attributes come in no particular order
+        std::vector<CEGUI::String> pairs;
+        for (size_t i = 0; i < attributes.getCount(); ++i)
+            pairs.push_back(attributes.getName(i) + "=" + attributes.getValue(i));
+        std::sort(pairs.begin(), pairs.end());
+
+        d_log += "<" + element;
+        for (const CEGUI::String& pair : pairs)
+            d_log += " " + pair;
+        d_log += ">";
+    }
+
+    void elementEnd(const CEGUI::String& element) override
+    {
+        flushText();
+        d_log += "</" + element + ">";
+    }
+
+    void text(const CEGUI::String& text) override { d_text += text; }
+
+    void flushText()
+    {
+        if (!d_text.empty())
+            d_log += "[" + d_text + "]";
+        d_text.clear();
+    }
+
+    CEGUI::String d_log;
+    CEGUI::String d_text;
+};
+
+std::vector<std::uint8_t> convert(const CEGUI::String& xml)
+{
+    CEGUI::BinaryResourceWriter writer;
+    CEGUI::System::getSingleton().getXMLParser()->parseXMLString(writer, xml, "");
+    return writer.getData();
+}
+}
+
+BOOST_AUTO_TEST_SUITE(BinaryResource)
+
+BOOST_AUTO_TEST_CASE(Replay_MatchesXMLParsing)
+{
+    RecordingHandler from_xml;
+    CEGUI::System::getSingleton().getXMLParser()->parseXMLString(from_xml, Layout, "");
+    from_xml.flushText();
+
+    const std::vector<std::uint8_t> data(convert(Layout));
+    BOOST_REQUIRE(CEGUI::BinaryResource::isBinaryResource(data.data(), data.size()));
+
+    RecordingHandler from_binary;
+    CEGUI::BinaryResource::parse(from_binary, data.data(), data.size());
+    from_binary.flushText();
+
+    BOOST_CHECK_EQUAL(from_binary.d_log, from_xml.d_log);
+}
+
+BOOST_AUTO_TEST_CASE(CorruptData_Throws)
+{
+    std::vector<std::uint8_t> data(convert(Layout));
+    RecordingHandler handler;
+
+    data.resize(data.size() - 3);
+    BOOST_CHECK_THROW(CEGUI::BinaryResource::parse(handler, data.data(), data.size()),
+                      CEGUI::InvalidRequestException);
+
+    const std::uint8_t xml[] = "<GUILayout/>";
+    BOOST_CHECK(!CEGUI::BinaryResource::isBinaryResource(xml, sizeof(xml)));
+}
+
+BOOST_AUTO_TEST_CASE(BinaryLayoutFile_LoadsLikeXML)
+{
+    const std::vector<std::uint8_t> data(convert(Layout));
+    const char* const filename = "BinaryResourceTest.layout";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    static_cast<CEGUI::DefaultResourceProvider*>(
+        CEGUI::System::getSingleton().getResourceProvider())->
+            setResourceGroupDirectory("binary_resources", "./");
+
+    CEGUI::WindowManager& wm = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* window = nullptr;
+    BOOST_CHECK_NO_THROW(window = wm.loadLayoutFromFile(filename, "binary_resources"));
+    std::remove(filename);
+
+    BOOST_REQUIRE(window != nullptr);
+    BOOST_CHECK_EQUAL(window->getName(), "Dialog");
+    BOOST_CHECK_EQUAL(window->getText(), CEGUI::String("First line\n\xc3\xa9t\xc3\xa9"));
+    BOOST_CHECK_EQUAL(window->getChild("Ok")->getText(), "Ok");
+
+    wm.destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/falagard/Dimensions.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct DimensionsFixture
+{
+    DimensionsFixture()
+    {
+        d_root = WindowManager::getSingleton().createWindow("DefaultWindow", "root");
+        d_root->setSize(USize(cegui_absdim(200), cegui_absdim(100)));
+        d_root->addChild(createChild("child", 0.5f, 30.0f));
+    }
+
+    ~DimensionsFixture()
+    {
+        WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    static Window* createChild(const String& name, float alpha, float width)
+    {
+        Window* child = WindowManager::getSingleton().createWindow("DefaultWindow", name);
+        child->setAlpha(alpha);
+        child->setSize(USize(cegui_absdim(width), cegui_absdim(10)));
+        return child;
+    }
+
+    Window* d_root;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Dimensions, DimensionsFixture)
+
+BOOST_AUTO_TEST_CASE(PropertyDim_FollowsReplacedChild)
+{
+    const PropertyDim dim("child", "Alpha", DimensionType::Invalid);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 0.5f);
+
+    // values are read each time, only the references are cached
+    d_root->getChild("child")->setAlpha(0.25f);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 0.25f);
+
+    WindowManager::getSingleton().destroyWindow(d_root->getChild("child"));
+    d_root->addChild(createChild("child", 0.75f, 30.0f));
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 0.75f);
+
+    d_root->getChild("child")->setName("renamed");
+    BOOST_CHECK_THROW(dim.getValue(*d_root), UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(WidgetDim_FollowsReplacedChild)
+{
+    WidgetDim dim("child", DimensionType::Width);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 30.0f);
+
+    d_root->addChild(createChild("other", 1.0f, 50.0f));
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 30.0f);
+
+    dim.setWidgetName("other");
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 50.0f);
+
+    WindowManager::getSingleton().destroyWindow(d_root->getChild("other"));
+    BOOST_CHECK_THROW(dim.getValue(*d_root), InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(PropertyDim_FollowsReplacedGrandchild)
+{
+    Window* child = d_root->getChild("child");
+    child->addChild(createChild("grandchild", 0.5f, 20.0f));
+
+    const PropertyDim dim("child/grandchild", "Alpha", DimensionType::Invalid);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 0.5f);
+
+    // replacing a window deeper down invalidates the ancestors' references
+    WindowManager::getSingleton().destroyWindow(child->getChild("grandchild"));
+    child->addChild(createChild("grandchild", 0.75f, 20.0f));
+    BOOST_CHECK_EQUAL(dim.getValue(*d_root), 0.75f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -453,4 +453,74 @@ BOOST_AUTO_TEST_CASE(Subscribing)
     }
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(EventIdInterning)
+{
+    const CEGUI::EventId id(CEGUI::String("InternedTestEvent"));
+
+    BOOST_CHECK(id.isValid());
+    BOOST_CHECK_EQUAL(id.getName(), "InternedTestEvent");
+    BOOST_CHECK(CEGUI::EventId(CEGUI::String("InternedTestEvent")) == id);
+    BOOST_CHECK(CEGUI::EventId::find("InternedTestEvent") == id);
+    BOOST_CHECK(!CEGUI::EventId::find("NeverInternedTestEvent").isValid());
+}
+
+BOOST_AUTO_TEST_CASE(SubscribingWithEventId)
+{
+    CEGUI::EventSet set;
+
+    const CEGUI::EventId eventId(CEGUI::String("EventIdTestEvent"));
+
+    TestEventArgs args;
+
+    CEGUI::Event::Connection connection = set.subscribeEvent(eventId, &freeFunctionSubscriber);
+    BOOST_CHECK(set.isEventPresent(eventId.getName()));
+
+    args.d_targetValue = 50;
+    set.fireEvent(eventId, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 50);
+
+    // firing by name reaches the same event
+    args.d_targetValue = 51;
+    set.fireEvent(eventId.getName(), args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 51);
+
+    set.setMutedState(true);
+    args.d_targetValue = 52;
+    set.fireEvent(eventId, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 51);
+    set.setMutedState(false);
+
+    set.removeEvent(eventId.getName());
+    args.d_targetValue = 53;
+    set.fireEvent(eventId, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 51);
+
+    connection->disconnect();
+}
+
+BOOST_AUTO_TEST_CASE(GlobalSubscribingWithEventId)
+{
+    CEGUI::GlobalEventSet& globalSet = CEGUI::GlobalEventSet::getSingleton();
+    CEGUI::EventSet set;
+
+    const CEGUI::EventId eventId(CEGUI::String("GlobalEventIdTestEvent"));
+    BOOST_CHECK(!globalSet.isEventNameUsed(eventId));
+
+    CEGUI::Event::Connection connection = globalSet.subscribeEvent(
+        "TestNamespace/GlobalEventIdTestEvent", &freeFunctionSubscriber);
+    BOOST_CHECK(globalSet.isEventNameUsed(eventId));
+
+    TestEventArgs args;
+    args.d_targetValue = 60;
+    set.fireEvent(eventId, args, "TestNamespace");
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 60);
+
+    args.d_targetValue = 61;
+    set.fireEvent(eventId, args, "OtherNamespace");
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 60);
+
+    connection->disconnect();
+    globalSet.removeEvent("TestNamespace/GlobalEventIdTestEvent");
+}
 BOOST_AUTO_TEST_SUITE_END()
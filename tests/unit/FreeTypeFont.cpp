@@ -0,0 +1,114 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+float drawText(const CEGUI::Font& font, const CEGUI::String& text)
+{
+    float next_pen_x = 0.0f;
+    std::vector<CEGUI::GeometryBuffer*> buffers = font.createTextRenderGeometry(
+        text, next_pen_x, glm::vec2(0, 0), nullptr, false, CEGUI::ColourRect(),
+        CEGUI::DefaultParagraphDirection::LeftToRight);
+
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+        renderer->destroyGeometryBuffer(*buffer);
+
+    return next_pen_x;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(FreeTypeFont)
+
+BOOST_AUTO_TEST_CASE(ShapedRunCache_RedrawnText_IsLaidOutOnce)
+{
+    CEGUI::FreeTypeFont* font = dynamic_cast<CEGUI::FreeTypeFont*>(
+        &CEGUI::FontManager::getSingleton().get("DejaVuSans-12"));
+    BOOST_REQUIRE(font != nullptr);
+
+    font->clearShapedRunCache();
+
+    const float first_width = drawText(*font, "Static label text");
+    BOOST_CHECK_EQUAL(font->getShapedRunCacheSize(), 1u);
+
+    BOOST_CHECK_EQUAL(drawText(*font, "Static label text"), first_width);
+    BOOST_CHECK_EQUAL(font->getShapedRunCacheSize(), 1u);
+
+    // the cached run must match a fresh layout
+    font->setShapedRunCacheCapacity(0);
+    BOOST_CHECK_EQUAL(drawText(*font, "Static label text"), first_width);
+    BOOST_CHECK_EQUAL(font->getShapedRunCacheSize(), 0u);
+
+    // a full cache only drops the least recently drawn run
+    font->setShapedRunCacheCapacity(2);
+    drawText(*font, "one");
+    drawText(*font, "two");
+    const float one_width = drawText(*font, "one");
+    drawText(*font, "three");
+    BOOST_CHECK_EQUAL(font->getShapedRunCacheSize(), 2u);
+    BOOST_CHECK_EQUAL(drawText(*font, "one"), one_width);
+    BOOST_CHECK_EQUAL(font->getShapedRunCacheSize(), 2u);
+
+    font->setShapedRunCacheCapacity(1);
+    BOOST_CHECK_EQUAL(font->getShapedRunCacheSize(), 1u);
+
+    font->setShapedRunCacheCapacity(512);
+}
+
+BOOST_AUTO_TEST_CASE(TextGeometry_GlyphsOfOnePage_ShareOneBuffer)
+{
+    const CEGUI::Font& font =
+        CEGUI::FontManager::getSingleton().get("DejaVuSans-12");
+
+    // make sure all glyphs are rasterised, so they all live in the first page
+    drawText(font, "abcabc");
+
+    float next_pen_x = 0.0f;
+    std::vector<CEGUI::GeometryBuffer*> buffers = font.createTextRenderGeometry(
+        "abcabc", next_pen_x, glm::vec2(0, 0), nullptr, false,
+        CEGUI::ColourRect(), CEGUI::DefaultParagraphDirection::LeftToRight);
+
+    BOOST_CHECK_EQUAL(buffers.size(), 1u);
+
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+        renderer->destroyGeometryBuffer(*buffer);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,183 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct DeferredLayoutFixture
+{
+    DeferredLayoutFixture()
+    {
+        context = &System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget());
+
+        WindowManager& wm = WindowManager::getSingleton();
+        root = wm.createWindow("DefaultWindow", "root");
+        root->setArea(URect(cegui_absdim(0), cegui_absdim(0),
+                            cegui_absdim(200), cegui_absdim(100)));
+        parent = wm.createWindow("DefaultWindow", "parent");
+        parent->setArea(URect(cegui_absdim(10), cegui_absdim(10),
+                              cegui_absdim(110), cegui_absdim(60)));
+        child = wm.createWindow("DefaultWindow", "child");
+        child->setArea(URect(cegui_reldim(0.5f), cegui_reldim(0),
+                             cegui_reldim(1), cegui_reldim(1)));
+        parent->addChild(child);
+        root->addChild(parent);
+        context->setRootWindow(root);
+
+        child->subscribeEvent(Element::EventSized,
+            Event::Subscriber(&DeferredLayoutFixture::childSized, this));
+    }
+
+    ~DeferredLayoutFixture()
+    {
+        context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(root);
+        System::getSingleton().destroyGUIContext(*context);
+    }
+
+    bool childSized(const EventArgs&)
+    {
+        ++childSizedCount;
+        return true;
+    }
+
+    GUIContext* context;
+    Window* root;
+    Window* parent;
+    Window* child;
+    int childSizedCount = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GUIContext, DeferredLayoutFixture)
+
+BOOST_AUTO_TEST_CASE(DeferredLayout_Disabled_LaysOutImmediately)
+{
+    BOOST_CHECK(!context->isDeferredLayoutEnabled());
+
+    parent->setSize(USize(cegui_absdim(200), cegui_absdim(50)));
+
+    BOOST_CHECK(!parent->isLayoutPending());
+    BOOST_CHECK_EQUAL(child->getPixelSize().d_width, 100.0f);
+    BOOST_CHECK_EQUAL(childSizedCount, 1);
+}
+
+BOOST_AUTO_TEST_CASE(DeferredLayout_CoalescesAreaChanges)
+{
+    context->setDeferredLayoutEnabled(true);
+
+    parent->setSize(USize(cegui_absdim(200), cegui_absdim(50)));
+    parent->setSize(USize(cegui_absdim(300), cegui_absdim(50)));
+    parent->setPosition(UVector2(cegui_absdim(20), cegui_absdim(10)));
+
+    // the sized window itself is up to date, its children are not
+    BOOST_CHECK(parent->isLayoutPending());
+    BOOST_CHECK_EQUAL(parent->getPixelSize().d_width, 300.0f);
+    BOOST_CHECK_EQUAL(parent->getUnclippedOuterRect().get().left(), 20.0f);
+    BOOST_CHECK_EQUAL(child->getPixelSize().d_width, 50.0f);
+    BOOST_CHECK_EQUAL(childSizedCount, 0);
+
+    context->flushLayout();
+
+    BOOST_CHECK(!parent->isLayoutPending());
+    BOOST_CHECK_EQUAL(child->getPixelSize().d_width, 150.0f);
+    BOOST_CHECK_EQUAL(child->getUnclippedOuterRect().get().left(), 170.0f);
+    BOOST_CHECK_EQUAL(childSizedCount, 1);
+}
+
+BOOST_AUTO_TEST_CASE(DeferredLayout_FlushedBeforeDraw)
+{
+    context->setDeferredLayoutEnabled(true);
+
+    parent->setSize(USize(cegui_absdim(200), cegui_absdim(50)));
+    BOOST_CHECK_EQUAL(child->getPixelSize().d_width, 50.0f);
+
+    context->draw();
+
+    BOOST_CHECK(!parent->isLayoutPending());
+    BOOST_CHECK_EQUAL(child->getPixelSize().d_width, 100.0f);
+}
+
+BOOST_AUTO_TEST_CASE(DeferredLayout_ReattachedWindow_KeepsPendingLayout)
+{
+    context->setDeferredLayoutEnabled(true);
+
+    parent->setSize(USize(cegui_absdim(200), cegui_absdim(50)));
+    root->removeChild(parent);
+    context->flushLayout();
+    BOOST_CHECK(parent->isLayoutPending());
+
+    root->addChild(parent);
+    context->flushLayout();
+
+    BOOST_CHECK(!parent->isLayoutPending());
+    BOOST_CHECK_EQUAL(child->getPixelSize().d_width, 100.0f);
+
+    // disabling flushes whatever is still pending
+    parent->setSize(USize(cegui_absdim(100), cegui_absdim(50)));
+    context->setDeferredLayoutEnabled(false);
+    BOOST_CHECK_EQUAL(child->getPixelSize().d_width, 50.0f);
+}
+
+BOOST_AUTO_TEST_CASE(HitTest_FollowsAreaVisibilityAndHierarchyChanges)
+{
+    System::getSingleton().notifyDisplaySizeChanged(Sizef(800, 600));
+
+    BOOST_CHECK_EQUAL(root->getChildAtPosition(glm::vec2(80, 30)), child);
+    BOOST_CHECK_EQUAL(root->getChildAtPosition(glm::vec2(20, 30)), parent);
+    BOOST_CHECK(root->getChildAtPosition(glm::vec2(150, 30)) == nullptr);
+
+    // a child outside of its parent must still be found through the parent
+    child->setClippedByParent(false);
+    child->setPosition(UVector2(cegui_absdim(130), cegui_absdim(0)));
+    BOOST_CHECK_EQUAL(root->getChildAtPosition(glm::vec2(150, 30)), child);
+    BOOST_CHECK_EQUAL(root->getChildAtPosition(glm::vec2(80, 30)), parent);
+
+    child->hide();
+    BOOST_CHECK(root->getChildAtPosition(glm::vec2(150, 30)) == nullptr);
+    child->show();
+    BOOST_CHECK_EQUAL(root->getChildAtPosition(glm::vec2(150, 30)), child);
+
+    Window* other = WindowManager::getSingleton().createWindow("DefaultWindow", "other");
+    other->setClippedByParent(false);
+    other->setArea(URect(cegui_absdim(0), cegui_absdim(70),
+                         cegui_absdim(50), cegui_absdim(80)));
+    parent->addChild(other);
+    BOOST_CHECK_EQUAL(root->getChildAtPosition(glm::vec2(20, 85)), other);
+
+    parent->removeChild(other);
+    BOOST_CHECK(root->getChildAtPosition(glm::vec2(20, 85)) == nullptr);
+    WindowManager::getSingleton().destroyWindow(other);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,7 @@
 #include <vector>
 #include <iostream>
 #include <map>
+#include <thread>
 
 #include "CEGUI/CEGUI.h"
 #include "CEGUI/PropertyHelper.h"
@@ -50,12 +51,14 @@ public:
     CEGUI::String d_text;
     float d_totalScroll;
     glm::vec2 d_cursorPosition;
+    int d_cursorMoveCount;
     std::vector<SemanticValue> d_semanticValues;
 
     MockInputEventReceiver() :
         d_text(""),
         d_totalScroll(0),
-        d_cursorPosition(0.0f, 0.0f)
+        d_cursorPosition(0.0f, 0.0f),
+        d_cursorMoveCount(0)
     {}
 
     ~MockInputEventReceiver()
@@ -98,6 +101,7 @@ public:
     {
         d_cursorPosition = glm::vec2(event.d_payload.array[0],
             event.d_payload.array[1]);
+        ++d_cursorMoveCount;
         return true;
     }
 
@@ -504,4 +508,88 @@ BOOST_AUTO_TEST_CASE(KeyDownLeftArrowAndControlToGoToPreviousWord)
         d_inputEventReceiver->d_semanticValues.end());
 }
 
+BOOST_AUTO_TEST_CASE(QueuedInput_ProcessedInOrderAndCoalesced)
+{
+    d_inputAggregator->setInputQueueingEnabled(true);
+
+    d_inputAggregator->injectMousePosition(1, 1);
+    d_inputAggregator->injectMousePosition(2, 2);
+    d_inputAggregator->injectMousePosition(3, 3);
+    d_inputAggregator->injectChar('a');
+    d_inputAggregator->injectMouseWheelChange(1);
+    d_inputAggregator->injectMouseWheelChange(2);
+    d_inputAggregator->injectMousePosition(4, 5);
+    d_inputAggregator->injectChar('b');
+
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorMoveCount, 0);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_text, "");
+
+    BOOST_CHECK_EQUAL(d_inputAggregator->processQueuedInput(), 5u);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorMoveCount, 2);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorPosition.x, 4);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorPosition.y, 5);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_totalScroll, 3);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_text, "ab");
+
+    BOOST_CHECK_EQUAL(d_inputAggregator->processQueuedInput(), 0u);
+
+    // disabling the queueing processes what is left
+    d_inputAggregator->injectChar('c');
+    d_inputAggregator->setInputQueueingEnabled(false);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_text, "abc");
+}
+
+BOOST_AUTO_TEST_CASE(QueuedInput_InjectedFromAnotherThread)
+{
+    d_inputAggregator->setInputQueueingEnabled(true);
+
+    const int count = 10000;
+    std::thread input_thread([this, count]()
+    {
+        for (int i = 1; i <= count; ++i)
+        {
+            // wait for room when the queue is full
+            while (!d_inputAggregator->injectMousePosition(
+                       static_cast<float>(i), 0.0f))
+                std::this_thread::yield();
+
+            while (!d_inputAggregator->injectMouseWheelChange(1))
+                std::this_thread::yield();
+        }
+    });
+
+    while (d_inputEventReceiver->d_totalScroll < count)
+        if (d_inputAggregator->processQueuedInput() == 0)
+            std::this_thread::yield();
+
+    input_thread.join();
+    d_inputAggregator->processQueuedInput();
+
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_totalScroll, count);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorPosition.x, count);
+}
+
+BOOST_AUTO_TEST_CASE(QueuedInput_TranslatedWhenProcessed)
+{
+    d_inputAggregator->setInputQueueingEnabled(true);
+
+    std::thread input_thread([this]()
+    {
+        d_inputAggregator->injectMousePosition(10, 10);
+        d_inputAggregator->injectMouseMove(5, 0);
+        d_inputAggregator->injectMouseButtonDown(MouseButton::Left);
+    });
+    input_thread.join();
+
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorMoveCount, 0);
+    BOOST_CHECK(d_inputEventReceiver->d_semanticValues.empty());
+
+    BOOST_CHECK_EQUAL(d_inputAggregator->processQueuedInput(), 2u);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorMoveCount, 1);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorPosition.x, 15);
+    BOOST_CHECK_EQUAL(d_inputEventReceiver->d_cursorPosition.y, 10);
+    BOOST_REQUIRE_EQUAL(d_inputEventReceiver->d_semanticValues.size(), 1u);
+    BOOST_CHECK(d_inputEventReceiver->d_semanticValues[0] == SemanticValue::CursorPressHold);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -39,7 +39,8 @@ struct InputInjectionFixture
     InputInjectionFixture() :
         d_buttonHandledCount(0),
         d_windowHandledCount(0),
-        d_guiContext(&System::getSingleton().getDefaultGUIContext()),
+        d_guiContext(&System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget())),
         d_inputAggregator(new InputAggregator(d_guiContext))
     {
         d_inputAggregator->initialise();
@@ -65,7 +66,7 @@ struct InputInjectionFixture
         d_window->addChild(d_editbox);
         d_window->addChild(d_button);
 
-        System::getSingleton().getDefaultGUIContext().setRootWindow(d_window);
+        d_guiContext->setRootWindow(d_window);
 
         d_windowConnections.push_back(
             d_window->subscribeEvent(Window::EventCursorActivate,
@@ -84,9 +85,10 @@ struct InputInjectionFixture
 
         delete d_inputAggregator;
 
-        System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        d_guiContext->setRootWindow(nullptr);
 
         WindowManager::getSingleton().destroyWindow(d_window);
+        System::getSingleton().destroyGUIContext(*d_guiContext);
     }
 
     bool handleButtonEvent(const EventArgs&)
@@ -33,6 +33,10 @@
 class ItemModelStub : public CEGUI::ItemModel
 {
 public:
+    // the indices point into d_items, so keep the items before a change in
+    // place like a real model does.
+    ItemModelStub() { d_items.reserve(1024); }
+
     bool isValidIndex(const CEGUI::ModelIndex& model_index) const override;
     CEGUI::ModelIndex makeIndex(size_t child, const CEGUI::ModelIndex& model_index) override;
     bool areIndicesEqual(const CEGUI::ModelIndex& index1, const CEGUI::ModelIndex& index2) const override;
@@ -0,0 +1,100 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/LayoutPrototype.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const CEGUI::String Layout(
+    "<GUILayout version=\"4\">"
+    "<Window type=\"TaharezLook/FrameWindow\" name=\"Bubble\">"
+    "<Property name=\"Area\" value=\"{{0,10},{0,20},{0.5,0},{0.5,0}}\" />"
+    "<Property name=\"Alpha\" value=\"0.5\" />"
+    "<Property name=\"Text\">Long\ntext</Property>"
+    "<UserString name=\"Kind\" value=\"chat\" />"
+    "<AutoWindow namePath=\"__auto_titlebar__\">"
+    "<Property name=\"Visible\" value=\"false\" />"
+    "</AutoWindow>"
+    "<Window type=\"TaharezLook/Label\" name=\"Message\">"
+    "<Property name=\"Text\" value=\"Hello\" />"
+    "<Property name=\"NoSuchProperty\" value=\"ignored\" />"
+    "</Window>"
+    "</Window>"
+    "</GUILayout>");
+
+void checkInstance(CEGUI::Window* wnd)
+{
+    BOOST_REQUIRE(wnd != nullptr);
+    BOOST_CHECK_EQUAL(wnd->getType(), "TaharezLook/FrameWindow");
+    BOOST_CHECK_EQUAL(wnd->getName(), "Bubble");
+    BOOST_CHECK_EQUAL(wnd->getArea(), CEGUI::URect(
+        CEGUI::UDim(0, 10), CEGUI::UDim(0, 20),
+        CEGUI::UDim(0.5f, 0), CEGUI::UDim(0.5f, 0)));
+    BOOST_CHECK_EQUAL(wnd->getAlpha(), 0.5f);
+    BOOST_CHECK_EQUAL(wnd->getText(), "Long\ntext");
+    BOOST_CHECK_EQUAL(wnd->getUserString("Kind"), "chat");
+    BOOST_CHECK(!wnd->getChild("__auto_titlebar__")->isVisible());
+    BOOST_CHECK_EQUAL(wnd->getChild("Message")->getText(), "Hello");
+}
+}
+
+BOOST_AUTO_TEST_SUITE(LayoutPrototype)
+
+BOOST_AUTO_TEST_CASE(Instances_MatchLoadedLayout)
+{
+    CEGUI::WindowManager& wm = CEGUI::WindowManager::getSingleton();
+
+    CEGUI::Window* loaded = wm.loadLayoutFromString(Layout);
+    checkInstance(loaded);
+
+    CEGUI::LayoutPrototype prototype;
+    BOOST_CHECK(!prototype.isLoaded());
+    prototype.loadFromString(Layout);
+    BOOST_CHECK(prototype.isLoaded());
+
+    // the second instance sets the values prepared by the first one
+    CEGUI::Window* first = prototype.instantiate();
+    checkInstance(first);
+    CEGUI::Window* second = prototype.instantiate();
+    checkInstance(second);
+    BOOST_CHECK(first != second);
+
+    wm.destroyWindow(loaded);
+    wm.destroyWindow(first);
+    wm.destroyWindow(second);
+}
+
+BOOST_AUTO_TEST_CASE(Instantiate_WithoutLayout_Throws)
+{
+    CEGUI::LayoutPrototype prototype;
+    BOOST_CHECK_THROW(prototype.instantiate(), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
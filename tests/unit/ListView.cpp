@@ -28,6 +28,9 @@
 
 #include "ItemModelStub.h"
 #include "CEGUI/Font.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/widgets/Scrollbar.h"
 
@@ -51,12 +54,25 @@ struct ListViewFixture
     {
         System::getSingleton().notifyDisplaySizeChanged(Sizef(100, 100));
 
+        context = &System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget());
+
         view = static_cast<ListView*>(WindowManager::getSingleton().createWindow("TaharezLook/ListView", "lv"));
         view->setWindowRenderer("Core/ListView");
+        context->setRootWindow(view);
         view->setModel(&model);
         font_height = view->getFont()->getFontHeight();
     }
 
+    ~ListViewFixture()
+    {
+        view->setModel(nullptr);
+        context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(view);
+        System::getSingleton().destroyGUIContext(*context);
+    }
+
+    GUIContext* context;
     ListView* view;
     ItemModelStub model;
     float font_height;
@@ -234,14 +250,14 @@ BOOST_AUTO_TEST_CASE(ItemNameChanged_UpdatesRenderedString)
 {
     model.d_items.push_back(ITEM1);
     view->prepareForRender();
-    BOOST_CHECK_EQUAL(1, view->getItems().at(0)->d_string.getLineCount());
+    BOOST_CHECK_EQUAL(1, view->getItems().at(0)->d_string->getLineCount());
 
     model.notifyChildrenDataWillChange(model.getRootIndex(), 0, 1);
     model.d_items.at(0) = ITEM_WITH_6LINES;
     model.notifyChildrenDataChanged(model.getRootIndex(), 0, 1);
 
     view->prepareForRender();
-    BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_string.getLineCount());
+    BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_string->getLineCount());
 }
 
 //----------------------------------------------------------------------------//
@@ -283,4 +299,225 @@ BOOST_AUTO_TEST_CASE(SortEnabled_IsEnabled_ListIsSorted)
     BOOST_REQUIRE_EQUAL(ITEM3, *(static_cast<String*>(index.d_modelData)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IndexAt_ScrolledToBottom_ReturnsLastIndex)
+{
+    for (std::int32_t i = 0; i < 100; ++i)
+        model.d_items.push_back(" item .." + PropertyHelper<std::int32_t>::toString(i));
+    model.d_items.push_back(ITEM1);
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->prepareForRender();
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
+
+    Rectf render_area(view->getViewRenderer()->getViewRenderArea());
+    ModelIndex index = view->indexAt(glm::vec2(
+        render_area.left() + 1, render_area.bottom() - 1));
+
+    BOOST_REQUIRE(index.d_modelData != nullptr);
+    BOOST_REQUIRE_EQUAL(ITEM1, *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetIndexRect_SortEnabled_ReturnsRectOfSortedPosition)
+{
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM2);
+    model.d_items.push_back(ITEM1);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    float item_height = view->getRenderedTotalHeight() / 3;
+    Rectf rect = static_cast<ItemView*>(view)->getIndexRect(
+        ModelIndex(&model.d_items.at(0)));
+
+    BOOST_CHECK_CLOSE(item_height * 2, rect.top(), 0.01f);
+    BOOST_CHECK_CLOSE(item_height, rect.getHeight(), 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemAdded_SortEnabled_ItemIsInsertedAtSortedPosition)
+{
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM1);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    model.d_items.push_back(ITEM2);
+    model.notifyChildrenAdded(model.getRootIndex(), 2, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(3, view->getItems().size());
+    BOOST_REQUIRE_EQUAL(ITEM1, view->getItems().at(0)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM2, view->getItems().at(1)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM3, view->getItems().at(2)->d_text);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, font_height + font_height / 2.0f));
+    BOOST_REQUIRE_EQUAL(ITEM2, *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemAdded_SortEnabled_FollowingOffsetsAreShifted)
+{
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM_WITH_6LINES);
+    model.d_items.push_back(ITEM1);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    const float item_height = view->getItemOffset(1);
+
+    model.d_items.push_back(ITEM2);
+    model.notifyChildrenAdded(model.getRootIndex(), 3, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(ITEM_WITH_6LINES, view->getItems().at(3)->d_text);
+    BOOST_CHECK_CLOSE(item_height * 3, view->getItemOffset(3), 0.01f);
+    BOOST_CHECK_CLOSE(view->getRenderedTotalHeight(), view->getItemOffset(4), 0.01f);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, item_height * 3 + font_height * 2.5f));
+    BOOST_REQUIRE_EQUAL(ITEM_WITH_6LINES, *(static_cast<String*>(index.d_modelData)));
+
+    // a larger batch is merged in at once
+    for (std::int32_t i = 0; i < 10; ++i)
+        model.d_items.push_back("ITEM 0" + PropertyHelper<std::int32_t>::toString(i));
+    model.notifyChildrenAdded(model.getRootIndex(), 4, 10);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(ITEM_WITH_6LINES, view->getItems().at(13)->d_text);
+    BOOST_CHECK_CLOSE(item_height * 13, view->getItemOffset(13), 0.01f);
+    BOOST_CHECK_CLOSE(view->getRenderedTotalHeight(), view->getItemOffset(14), 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemNameChanged_SortEnabled_ItemIsMovedToSortedPosition)
+{
+    static const String ITEM4 = "ITEM 4";
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM2);
+    model.d_items.push_back(ITEM3);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    model.notifyChildrenDataWillChange(model.getRootIndex(), 0, 1);
+    model.d_items.at(0) = ITEM4;
+    model.notifyChildrenDataChanged(model.getRootIndex(), 0, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(ITEM2, view->getItems().at(0)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM3, view->getItems().at(1)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM4, view->getItems().at(2)->d_text);
+
+    model.notifyChildrenWillBeRemoved(model.getRootIndex(), 1, 1);
+    model.d_items.erase(model.d_items.begin() + 1);
+    model.notifyChildrenRemoved(model.getRootIndex(), 1, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(2, view->getItems().size());
+    BOOST_REQUIRE_EQUAL(ITEM3, view->getItems().at(0)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM4, view->getItems().at(1)->d_text);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemsRemoved_SortEnabled_ScatteredItemsAreRemoved)
+{
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM2);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    // the first two children are displayed first and last
+    model.notifyChildrenWillBeRemoved(model.getRootIndex(), 0, 2);
+    model.d_items.erase(model.d_items.begin(), model.d_items.begin() + 2);
+    model.notifyChildrenRemoved(model.getRootIndex(), 0, 2);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(1, view->getItems().size());
+    BOOST_REQUIRE_EQUAL(ITEM2, view->getItems().at(0)->d_text);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, font_height / 2.0f));
+    BOOST_REQUIRE_EQUAL(ITEM2, *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemsRemoved_SortEnabled_FollowingOffsetsAreShifted)
+{
+    for (std::int32_t i = 0; i < 10; ++i)
+        model.d_items.push_back("ITEM 0" + PropertyHelper<std::int32_t>::toString(i));
+    model.d_items.push_back(ITEM_WITH_6LINES);
+    model.d_items.push_back(ITEM1);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    const float item_height = view->getItemOffset(1);
+
+    // remove every other one of the leading children
+    for (size_t i = 0; i < 5; ++i)
+    {
+        model.notifyChildrenWillBeRemoved(model.getRootIndex(), i, 1);
+        model.d_items.erase(model.d_items.begin() + i);
+        model.notifyChildrenRemoved(model.getRootIndex(), i, 1);
+    }
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(7, view->getItems().size());
+    BOOST_REQUIRE_EQUAL(ITEM_WITH_6LINES, view->getItems().at(6)->d_text);
+    BOOST_CHECK_CLOSE(item_height * 6, view->getItemOffset(6), 0.01f);
+    BOOST_CHECK_CLOSE(view->getRenderedTotalHeight(), view->getItemOffset(7), 0.01f);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, item_height * 5 + item_height / 2.0f));
+    BOOST_REQUIRE_EQUAL(ITEM1, *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_Enabled_OnlyVisibleItemsAreFormatted)
+{
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualizationEnabled(true);
+
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(1000, view->getItems().size());
+    BOOST_REQUIRE(view->getItems().at(0)->d_formattedString != nullptr);
+    BOOST_REQUIRE(view->getItems().at(999)->d_formattedString == nullptr);
+    BOOST_REQUIRE(view->getRenderedTotalHeight() >
+        999 * view->getFont()->getLineSpacing());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_Scrolled_LeastRecentlyVisibleItemsAreReleased)
+{
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualizationEnabled(true);
+    view->setFormattedItemCacheSize(20);
+    view->prepareForRender();
+
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(0.5f);
+    view->prepareForRender();
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
+    view->prepareForRender();
+
+    BOOST_REQUIRE(view->getItems().at(0)->d_formattedString == nullptr);
+    BOOST_REQUIRE(view->getItems().at(999)->d_formattedString != nullptr);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_ItemNameChanged_UpdatesRenderedString)
+{
+    model.d_items.push_back(ITEM1);
+    view->setVirtualizationEnabled(true);
+    view->prepareForRender();
+
+    model.notifyChildrenDataWillChange(model.getRootIndex(), 0, 1);
+    model.d_items.at(0) = ITEM_WITH_6LINES;
+    model.notifyChildrenDataChanged(model.getRootIndex(), 0, 1);
+
+    view->prepareForRender();
+    BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_string->getLineCount());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
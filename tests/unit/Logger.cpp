@@ -0,0 +1,112 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/DefaultLogger.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace
+{
+int messagesBuilt = 0;
+
+CEGUI::String buildMessage()
+{
+    ++messagesBuilt;
+    return "built message";
+}
+
+//! Restores the logging level and log file of the test run.
+struct LoggerFixture
+{
+    LoggerFixture() :
+        logger(CEGUI::Logger::getSingleton()),
+        level(logger.getLoggingLevel())
+    {
+    }
+
+    ~LoggerFixture()
+    {
+        logger.setLoggingLevel(level);
+    }
+
+    CEGUI::Logger& logger;
+    CEGUI::LoggingLevel level;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(Logger, LoggerFixture)
+
+BOOST_AUTO_TEST_CASE(FilteredMessage_IsNotBuilt)
+{
+    logger.setLoggingLevel(CEGUI::LoggingLevel::Warning);
+    BOOST_CHECK(logger.isLoggingLevelEnabled(CEGUI::LoggingLevel::Error));
+    BOOST_CHECK(!logger.isLoggingLevelEnabled(CEGUI::LoggingLevel::Standard));
+
+    messagesBuilt = 0;
+    CEGUI_LOG(CEGUI::LoggingLevel::Informative, buildMessage());
+    BOOST_CHECK_EQUAL(messagesBuilt, 0);
+
+    CEGUI_LOG(CEGUI::LoggingLevel::Warning, buildMessage());
+    BOOST_CHECK_EQUAL(messagesBuilt, 1);
+}
+
+BOOST_AUTO_TEST_CASE(AsynchronousWriting_WritesAllEvents)
+{
+    CEGUI::DefaultLogger* default_logger =
+        dynamic_cast<CEGUI::DefaultLogger*>(&logger);
+    if (!default_logger)
+        return;
+
+    default_logger->setLogFilename("LoggerTest.log");
+    default_logger->setAsynchronousWriting(true);
+    BOOST_CHECK(default_logger->isAsynchronousWriting());
+
+    for (int i = 0; i < 100; ++i)
+        default_logger->logEvent("asynchronous event");
+    default_logger->logEvent("filtered event", CEGUI::LoggingLevel::Insane);
+    default_logger->flush();
+
+    int written = 0;
+    int filtered = 0;
+    std::ifstream file("LoggerTest.log");
+    std::string line;
+    while (std::getline(file, line))
+    {
+        written += line.find("asynchronous event") != std::string::npos;
+        filtered += line.find("filtered event") != std::string::npos;
+    }
+    BOOST_CHECK_EQUAL(written, 100);
+    BOOST_CHECK_EQUAL(filtered, 0);
+
+    default_logger->setAsynchronousWriting(false);
+    default_logger->setLogFilename("CEGUI.log", true);
+    std::remove("LoggerTest.log");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
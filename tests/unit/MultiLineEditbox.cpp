@@ -0,0 +1,196 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/MultiLineEditbox.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/Clipboard.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct MultiLineEditboxFixture
+{
+    MultiLineEditboxFixture()
+    {
+        context = &System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget());
+
+        editbox = static_cast<MultiLineEditbox*>(WindowManager::getSingleton().
+            createWindow("TaharezLook/MultiLineEditbox", "editbox"));
+        editbox->setFont("DejaVuSans-12");
+        editbox->setSize(USize(cegui_absdim(200.0f), cegui_absdim(300.0f)));
+        context->setRootWindow(editbox);
+    }
+
+    ~MultiLineEditboxFixture()
+    {
+        context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(editbox);
+        System::getSingleton().destroyGUIContext(*context);
+    }
+
+    //! Checks the current lines match those of a full formatting pass.
+    void checkLinesMatchFullFormat()
+    {
+        // read the lines one by one first, so any pending shift is still there
+        MultiLineEditbox::LineList lines;
+        for (size_t i = 0; i < editbox->getFormattedLineCount(); ++i)
+            lines.push_back(editbox->getFormattedLine(i));
+        const float widestExtent = editbox->getHorzScrollbar()->getDocumentSize();
+
+        editbox->formatText(true);
+        const MultiLineEditbox::LineList& expected = editbox->getFormattedLines();
+
+        BOOST_REQUIRE_EQUAL(lines.size(), expected.size());
+        for (size_t i = 0; i < lines.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(lines[i].d_startIdx, expected[i].d_startIdx);
+            BOOST_CHECK_EQUAL(lines[i].d_length, expected[i].d_length);
+            BOOST_CHECK_EQUAL(lines[i].d_extent, expected[i].d_extent);
+        }
+        BOOST_CHECK_EQUAL(widestExtent, editbox->getHorzScrollbar()->getDocumentSize());
+    }
+
+    //! Inserts \a text at \a index the way a paste does.
+    void insertText(size_t index, const String& text)
+    {
+        editbox->setSelection(index, index);
+        editbox->setCaretIndex(index);
+        clipboard.setText(text);
+        editbox->performPaste(clipboard);
+    }
+
+    //! Erases \a length characters at \a index the way a cut does.
+    void eraseText(size_t index, size_t length)
+    {
+        editbox->setSelection(index, index + length);
+        editbox->performCut(clipboard);
+    }
+
+    GUIContext* context;
+    MultiLineEditbox* editbox;
+    Clipboard clipboard;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiLineEditbox, MultiLineEditboxFixture)
+
+BOOST_AUTO_TEST_CASE(EditedText_IsFormattedLikeFullText)
+{
+    String paragraph;
+    for (int i = 0; i < 60; ++i)
+        paragraph += "words to wrap ";
+
+    String text;
+    for (int i = 0; i < 20; ++i)
+        text += paragraph + "\n";
+
+    editbox->setText(text);
+    BOOST_CHECK(editbox->getFormattedLines().size() > 40u);
+    checkLinesMatchFullFormat();
+
+    // insert within a paragraph
+    insertText(100, "some inserted words ");
+    checkLinesMatchFullFormat();
+
+    // split a paragraph in two
+    insertText(1000, "\n");
+    checkLinesMatchFullFormat();
+
+    // join paragraphs by removing the line breaks between them
+    eraseText(editbox->getText().find('\n', 2000), 1);
+    eraseText(editbox->getText().find('\n', 3000), 1);
+    checkLinesMatchFullFormat();
+
+    // remove a range spanning several paragraphs
+    eraseText(50, 1200);
+    checkLinesMatchFullFormat();
+
+    // edit the first and last paragraphs
+    insertText(0, "Start ");
+    checkLinesMatchFullFormat();
+
+    insertText(editbox->getText().length() - 1, " end");
+    checkLinesMatchFullFormat();
+
+    // a text set as a whole is formatted as a whole
+    text = editbox->getText();
+    text.insert(500, "replaced words\n");
+    editbox->setText(text);
+    checkLinesMatchFullFormat();
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedEdits_KeepLinesAndWidestExtent)
+{
+    editbox->setWordWrapping(false);
+
+    String text;
+    for (int i = 0; i < 30; ++i)
+        text += "line of some text\n";
+    text.insert(text.find('\n', 200), " which is the widest of them all");
+    editbox->setText(text);
+    checkLinesMatchFullFormat();
+
+    // typing in a paragraph, then further up and further down
+    for (size_t i = 0; i < 10; ++i)
+        insertText(300 + i, "x");
+    for (size_t i = 0; i < 5; ++i)
+        insertText(40 + i, "yy");
+    insertText(450, "z\n");
+    checkLinesMatchFullFormat();
+
+    // shrinking the widest line must narrow the document
+    const size_t widest = editbox->getText().find(" which");
+    eraseText(widest, 32);
+    checkLinesMatchFullFormat();
+
+    for (size_t i = 0; i < 3; ++i)
+        eraseText(100, 1);
+    eraseText(20, 1);
+    checkLinesMatchFullFormat();
+}
+
+BOOST_AUTO_TEST_CASE(TextExtentOfSpan_MatchesExtentOfCopy)
+{
+    const Font* font = editbox->getFont();
+    BOOST_REQUIRE(font != nullptr);
+
+    const String text("Some text to measure");
+    BOOST_CHECK_EQUAL(font->getTextExtent(text, 5, 4),
+                      font->getTextExtent(text.substr(5, 4)));
+    BOOST_CHECK_EQUAL(font->getTextAdvance(text, 5, 4),
+                      font->getTextAdvance(text.substr(5, 4)));
+    BOOST_CHECK_EQUAL(font->getTextExtent(text, 5, String::npos),
+                      font->getTextExtent(text.substr(5)));
+    BOOST_CHECK_EQUAL(font->getTextExtent(text, 100, 4), 0.0f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
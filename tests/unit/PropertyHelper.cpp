@@ -26,9 +26,13 @@
  ***************************************************************************/
 
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+#include <limits>
+
 BOOST_AUTO_TEST_SUITE(PropertyHelper)
 
 BOOST_AUTO_TEST_CASE(Integer)
@@ -63,6 +67,42 @@ BOOST_AUTO_TEST_CASE(Float)
     BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("-123.1"), -123.1f);
 }
 
+BOOST_AUTO_TEST_CASE(Float_RoundTripIsExact)
+{
+    // the shortest text that reads back as the same float
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.1f), "0.1");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(1.0f / 3.0f), "0.33333334");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(16777216.0f), "16777216");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(1e10f), "1e+10");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.00001f), "1e-05");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(-0.0f), "-0");
+
+    const float values[] = { std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::min(), std::numeric_limits<float>::denorm_min(),
+        std::numeric_limits<float>::epsilon(), 123456.789f, -0.000123456789f };
+    for (float value : values)
+        BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString(
+            CEGUI::PropertyHelper<float>::toString(value)), value);
+
+    // the floats following 1, which need 9 significant digits
+    float value = 1.0f;
+    for (int i = 0; i < 1000; ++i)
+    {
+        value = std::nextafter(value, 2.0f);
+        BOOST_REQUIRE_EQUAL(CEGUI::PropertyHelper<float>::fromString(
+            CEGUI::PropertyHelper<float>::toString(value)), value);
+    }
+
+    // exponents and lenient input
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString(" 1.5e3"), 1500.0f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("+.5"), 0.5f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("2.5px"), 2.5f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("0.000000000000000000000000000001"), 1e-30f);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<float>::fromString("abc"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<float>::fromString("1e"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<float>::fromString("1e39"), CEGUI::InvalidRequestException);
+}
+
 BOOST_AUTO_TEST_CASE(Double)
 {
     // --- toString
@@ -83,6 +123,37 @@ BOOST_AUTO_TEST_CASE(Double)
 }
 
 
+BOOST_AUTO_TEST_CASE(Double_RoundTripIsExact)
+{
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(0.1), "0.1");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(1234567.125), "1234567.125");
+
+    const double values[] = { 1.0 / 3.0, 0.1 + 0.2, 1e300, -2.5e-300,
+        std::numeric_limits<double>::max(), std::numeric_limits<double>::min() };
+    for (double value : values)
+        BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::fromString(
+            CEGUI::PropertyHelper<double>::toString(value)), value);
+}
+
+BOOST_AUTO_TEST_CASE(Integer_Limits)
+{
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int64_t>::toString(std::numeric_limits<std::int64_t>::min()),
+        "-9223372036854775808");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::uint64_t>::toString(std::numeric_limits<std::uint64_t>::max()),
+        "18446744073709551615");
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int64_t>::fromString("-9223372036854775808"),
+        std::numeric_limits<std::int64_t>::min());
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::uint64_t>::fromString("18446744073709551615"),
+        std::numeric_limits<std::uint64_t>::max());
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<std::int16_t>::fromString(" -32768"), -32768);
+
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<std::int16_t>::fromString("32768"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<std::uint64_t>::fromString("18446744073709551616"),
+        CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<std::int32_t>::fromString("x1"), CEGUI::InvalidRequestException);
+}
+
 BOOST_AUTO_TEST_CASE(Colour)
 {
     // to string
@@ -258,4 +329,21 @@ BOOST_AUTO_TEST_CASE(Sizef)
     BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::Sizef>::fromString(CEGUI::PropertyHelper<CEGUI::Sizef>::toString(CEGUI::Sizef(-123456.25f, 1234567))), CEGUI::Sizef(-123456.25f, 1234567));
 }
 
+BOOST_AUTO_TEST_CASE(UBox)
+{
+    const CEGUI::UBox box(CEGUI::UDim(0, 1), CEGUI::UDim(0.5f, -2), CEGUI::UDim(1, 3), CEGUI::UDim(0.0078125f, 4));
+
+    // to string
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::UBox>::toString(box),
+        "{top:{0,1},left:{0.5,-2},bottom:{1,3},right:{0.0078125,4}}");
+
+    // from string
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::UBox>::fromString(
+        "{top:{0,1},left:{0.5,-2},bottom:{1,3},right:{0.0078125,4}}"), box);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::UBox>::fromString(
+        " top : { 0 1 } left : { 0.5 -2 } bottom : { 1 3 } right : { 0.0078125 4 } "), box);
+    BOOST_CHECK_THROW(CEGUI::PropertyHelper<CEGUI::UBox>::fromString("{top:{0,1},left:{0.5,-2}}"),
+        CEGUI::InvalidRequestException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,169 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RenderStats.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct RenderStatsFixture
+{
+    RenderStatsFixture() :
+        stats(System::getSingleton().getRenderStats())
+    {
+        context = &System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget());
+
+        // windows that are clipped away entirely are not drawn
+        System::getSingleton().notifyDisplaySizeChanged(Sizef(800, 600));
+        root = WindowManager::getSingleton().createWindow("DefaultWindow", "root");
+        root->setSize(USize(cegui_absdim(200), cegui_absdim(100)));
+        label = WindowManager::getSingleton().createWindow("TaharezLook/Label", "label");
+        label->setText("Some text");
+        root->addChild(label);
+        context->setRootWindow(root);
+
+        stats.setEnabled(true);
+        stats.setWindowStatsEnabled(true);
+    }
+
+    ~RenderStatsFixture()
+    {
+        stats.setWindowStatsEnabled(false);
+        stats.setEnabled(false);
+
+        context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(root);
+        System::getSingleton().destroyGUIContext(*context);
+    }
+
+    RenderStats& stats;
+    GUIContext* context;
+    Window* root;
+    Window* label;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderStats, RenderStatsFixture)
+
+BOOST_AUTO_TEST_CASE(RenderedFrame_CountsDrawnAndRebufferedWindows)
+{
+    System::getSingleton().renderAllGUIContexts();
+
+    const CEGUI::RenderStats::FrameStats& frame = stats.getLastFrameStats();
+    BOOST_CHECK_EQUAL(frame.d_windowsDrawn, 2u);
+    BOOST_CHECK_EQUAL(frame.d_windowsRebuffered, 2u);
+    BOOST_CHECK(frame.d_geometryBuffersDrawn > 0);
+    BOOST_CHECK(frame.d_verticesDrawn > 0);
+    BOOST_CHECK(frame.getTime(RenderStatsTimer::WindowDraw) >= 0.0);
+    BOOST_CHECK(frame.getTime(RenderStatsTimer::WindowDraw) <= frame.d_frameTime);
+
+    const CEGUI::RenderStats::WindowStatsMap& windows = stats.getLastFrameWindowStats();
+    BOOST_REQUIRE(windows.find(label) != windows.end());
+    BOOST_CHECK_EQUAL(windows.find(label)->second.d_namePath, label->getNamePath());
+    BOOST_CHECK(windows.find(label)->second.d_vertexCount > 0);
+}
+
+BOOST_AUTO_TEST_CASE(UnchangedFrame_RebuffersNothing)
+{
+    System::getSingleton().renderAllGUIContexts();
+
+    // redraw only the label
+    label->invalidate();
+    System::getSingleton().renderAllGUIContexts();
+
+    const CEGUI::RenderStats::FrameStats& frame = stats.getLastFrameStats();
+    BOOST_CHECK_EQUAL(frame.d_windowsRebuffered, 1u);
+    BOOST_CHECK_EQUAL(stats.getLastFrameWindowStats().size(), 1u);
+    BOOST_CHECK(stats.getLastFrameWindowStats().count(label) == 1);
+
+    System::getSingleton().renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(stats.getLastFrameStats().d_windowsRebuffered, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ClippedAwayWindow_IsBufferedOnceInView)
+{
+    label->setSize(USize(cegui_absdim(50), cegui_absdim(20)));
+    label->setPosition(UVector2(cegui_reldim(1.0f), cegui_absdim(0)));
+    System::getSingleton().renderAllGUIContexts();
+
+    BOOST_CHECK_EQUAL(stats.getLastFrameStats().d_windowsRebuffered, 1u);
+    BOOST_CHECK(stats.getLastFrameWindowStats().count(label) == 0);
+
+    label->setPosition(UVector2(cegui_absdim(0), cegui_absdim(0)));
+    System::getSingleton().renderAllGUIContexts();
+
+    BOOST_CHECK(stats.getLastFrameWindowStats().count(label) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(ClippedAwayWindow_IsDrawnOnceItsLookDrawsUnclipped)
+{
+    WidgetLookManager& wlMgr = WidgetLookManager::getSingleton();
+    wlMgr.parseLookNFeelSpecificationFromString(
+        "<Falagard version=\"7\"><WidgetLook name=\"Test/Culling\">"
+        "<StateImagery name=\"Enabled\" /><StateImagery name=\"Disabled\" />"
+        "</WidgetLook></Falagard>");
+
+    Window* window = WindowManager::getSingleton().createWindow("DefaultWindow");
+    window->setWindowRenderer("Core/Default");
+    window->setLookNFeel("Test/Culling");
+    window->setSize(USize(cegui_absdim(50), cegui_absdim(20)));
+    window->setPosition(UVector2(cegui_reldim(1.0f), cegui_absdim(0)));
+    root->addChild(window);
+    System::getSingleton().renderAllGUIContexts();
+
+    BOOST_CHECK(stats.getLastFrameWindowStats().count(window) == 0);
+
+    // the redefined look draws outside of the window
+    wlMgr.parseLookNFeelSpecificationFromString(
+        "<Falagard version=\"7\"><WidgetLook name=\"Test/Culling\">"
+        "<StateImagery name=\"Enabled\" clipped=\"false\" />"
+        "<StateImagery name=\"Disabled\" clipped=\"false\" />"
+        "</WidgetLook></Falagard>");
+    window->invalidate();
+    System::getSingleton().renderAllGUIContexts();
+
+    BOOST_CHECK(stats.getLastFrameWindowStats().count(window) == 1);
+
+    WindowManager::getSingleton().destroyWindow(window);
+    wlMgr.eraseWidgetLook("Test/Culling");
+}
+
+BOOST_AUTO_TEST_CASE(Disabled_RecordsNothing)
+{
+    stats.setEnabled(false);
+    System::getSingleton().renderAllGUIContexts();
+    BOOST_CHECK_EQUAL(stats.getCurrentFrameStats().d_windowsDrawn, 0u);
+    BOOST_CHECK_EQUAL(stats.getCurrentFrameStats().d_geometryBuffersDrawn, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
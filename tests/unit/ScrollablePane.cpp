@@ -0,0 +1,149 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/RenderStats.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/widgets/ScrollablePane.h"
+#include "CEGUI/widgets/ScrolledContainer.h"
+#include "CEGUI/widgets/Scrollbar.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct ScrollablePaneFixture
+{
+    ScrollablePaneFixture() :
+        stats(System::getSingleton().getRenderStats())
+    {
+        System::getSingleton().notifyDisplaySizeChanged(Sizef(800, 600));
+        context = &System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget());
+
+        pane = static_cast<ScrollablePane*>(
+            WindowManager::getSingleton().createWindow("TaharezLook/ScrollablePane"));
+        pane->setSize(USize(cegui_absdim(300), cegui_absdim(400)));
+        context->setRootWindow(pane);
+
+        // a column of items, 30 pixels apart
+        for (int i = 0; i < 50; ++i)
+        {
+            Window* item = WindowManager::getSingleton().createWindow("TaharezLook/Button");
+            item->setArea(URect(cegui_absdim(0), cegui_absdim(i * 30.0f),
+                                cegui_absdim(250), cegui_absdim(i * 30.0f + 25.0f)));
+            pane->addChild(item);
+            items.push_back(item);
+        }
+
+        stats.setEnabled(true);
+        stats.setWindowStatsEnabled(true);
+    }
+
+    ~ScrollablePaneFixture()
+    {
+        stats.setWindowStatsEnabled(false);
+        stats.setEnabled(false);
+
+        context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(pane);
+        System::getSingleton().destroyGUIContext(*context);
+    }
+
+    void render()
+    {
+        stats.beginFrame();
+        context->draw();
+        stats.endFrame();
+    }
+
+    bool isRebuffered(const Window* window) const
+    {
+        return stats.getLastFrameWindowStats().count(window) == 1;
+    }
+
+    RenderStats& stats;
+    GUIContext* context;
+    ScrollablePane* pane;
+    std::vector<Window*> items;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ScrollablePane, ScrollablePaneFixture)
+
+BOOST_AUTO_TEST_CASE(ChildExtents_FollowChildChanges)
+{
+    const ScrolledContainer* container = pane->getContentPane();
+    BOOST_CHECK_EQUAL(container->getChildExtentsArea(), Rectf(0, 0, 250, 1495));
+
+    items[49]->setYPosition(cegui_absdim(2000));
+    BOOST_CHECK_EQUAL(container->getChildExtentsArea(), Rectf(0, 0, 250, 2025));
+
+    // the bottom edge moves back up to the item that is now the lowest one
+    items[49]->setYPosition(cegui_absdim(0));
+    BOOST_CHECK_EQUAL(container->getChildExtentsArea(), Rectf(0, 0, 250, 1465));
+
+    items[0]->setWidth(cegui_absdim(400));
+    BOOST_CHECK_EQUAL(container->getChildExtentsArea(), Rectf(0, 0, 400, 1465));
+
+    pane->removeChild(items[0]);
+    WindowManager::getSingleton().destroyWindow(items[0]);
+    BOOST_CHECK_EQUAL(container->getChildExtentsArea(), Rectf(0, 0, 250, 1465));
+    BOOST_CHECK_EQUAL(pane->getContentSize(), USize(cegui_absdim(250), cegui_absdim(1465)));
+}
+
+BOOST_AUTO_TEST_CASE(Scrolling_DrawsOnlyTheItemsInView)
+{
+    render();
+    BOOST_CHECK(isRebuffered(items[0]));
+    BOOST_CHECK(!isRebuffered(items[30]));
+    BOOST_CHECK(stats.getLastFrameStats().d_windowsDrawn < 30u);
+
+    const Rectf first_item_area(items[0]->getUnclippedOuterRect().get());
+
+    pane->getVertScrollbar()->setScrollPosition(900.0f);
+    render();
+    BOOST_CHECK(isRebuffered(items[30]));
+    BOOST_CHECK(!isRebuffered(items[0]));
+    BOOST_CHECK(stats.getLastFrameStats().d_windowsDrawn < 30u);
+    BOOST_CHECK_EQUAL(items[30]->getUnclippedOuterRect().get(), first_item_area);
+    BOOST_CHECK_EQUAL(items[0]->getUnclippedOuterRect().get().top(),
+                      first_item_area.top() - 900.0f);
+
+    // the cached geometry of the first item is moved back when it is queued
+    pane->getVertScrollbar()->setScrollPosition(0.0f);
+    render();
+    BOOST_CHECK(!isRebuffered(items[0]));
+    BOOST_REQUIRE(!items[0]->getGeometryBuffers().empty());
+    BOOST_CHECK_EQUAL(items[0]->getGeometryBuffers()[0]->getModelMatrix()[3].y,
+                      first_item_area.top());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,7 @@
  ***************************************************************************/
 
 #include "CEGUI/String.h"
+#include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -56,6 +57,45 @@ BOOST_AUTO_TEST_CASE(Operators)
     BOOST_CHECK(a != b);
 }
 
+BOOST_AUTO_TEST_CASE(Utf8Utf32Conversion_EveryLengthAndEncodedSize)
+{
+    // code points of all encoded sizes, placed at every offset of the
+    // vectorised blocks, surrounded by ASCII runs of varying length
+    const char32_t codePoints[] = { U'a', 0xE9, 0x65E5, 0x1F600 };
+    const char* const encodings[] =
+        { "a", "\xC3\xA9", "\xE6\x97\xA5", "\xF0\x9F\x98\x80" };
+
+    for (size_t kind = 0; kind < 4; ++kind)
+    {
+        for (size_t length = 0; length < 70; ++length)
+        {
+            std::u32string utf32;
+            std::string utf8;
+            for (size_t i = 0; i < length; ++i)
+            {
+                const bool ascii = (i % 23) < 17;
+                utf32 += ascii ? static_cast<char32_t>('0' + i % 10) : codePoints[kind];
+                utf8 += ascii ? std::string(1, static_cast<char>('0' + i % 10))
+                              : std::string(encodings[kind]);
+            }
+
+            BOOST_CHECK(CEGUI::String::convertUtf32ToUtf8(utf32) == utf8);
+            BOOST_CHECK(CEGUI::String::convertUtf8ToUtf32(utf8) == utf32);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Utf8Utf32Conversion_InvalidUtf8_Throws)
+{
+    // invalid initial code unit
+    BOOST_CHECK_THROW(CEGUI::String::convertUtf8ToUtf32(
+        std::string("0123456789abcdef\x80")), CEGUI::UnicodeStringException);
+
+    // truncated code point
+    BOOST_CHECK_THROW(CEGUI::String::convertUtf8ToUtf32(
+        std::string("0123456789abcdef\xE6\x97")), CEGUI::UnicodeStringException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
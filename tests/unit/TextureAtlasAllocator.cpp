@@ -0,0 +1,141 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/TextureAtlasAllocator.h"
+#include "CEGUI/GlyphAtlas.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+namespace
+{
+struct AllocatedArea
+{
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+bool areasOverlap(const AllocatedArea& a, const AllocatedArea& b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+        a.y < b.y + b.height && b.y < a.y + a.height;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(TextureAtlasAllocator)
+
+BOOST_AUTO_TEST_CASE(Skyline_AllocatedAreas_AreInsidePageAndDisjoint)
+{
+    CEGUI::SkylineTextureAtlasAllocator allocator(128, 128);
+
+    // glyph-like rectangles of varying heights
+    std::vector<AllocatedArea> areas;
+    for (int i = 0; ; ++i)
+    {
+        AllocatedArea area = { 0, 0, 5 + i % 7, 8 + (i * 5) % 11 };
+        if (!allocator.allocate(area.width, area.height, area.x, area.y))
+            break;
+
+        areas.push_back(area);
+    }
+
+    BOOST_REQUIRE(!areas.empty());
+
+    for (size_t i = 0; i < areas.size(); ++i)
+    {
+        BOOST_CHECK(areas[i].x >= 0 && areas[i].x + areas[i].width <= 128);
+        BOOST_CHECK(areas[i].y >= 0 && areas[i].y + areas[i].height <= 128);
+
+        for (size_t j = i + 1; j < areas.size(); ++j)
+            BOOST_CHECK(!areasOverlap(areas[i], areas[j]));
+    }
+
+    // a shelf packer fills about 70% of the page with this sequence
+    BOOST_CHECK_GT(allocator.getOccupancy(), 0.8f);
+}
+
+BOOST_AUTO_TEST_CASE(Skyline_TooLargeArea_IsRejected)
+{
+    CEGUI::SkylineTextureAtlasAllocator allocator(64, 64);
+    int x = 0;
+    int y = 0;
+
+    BOOST_CHECK(!allocator.allocate(65, 10, x, y));
+    BOOST_CHECK(!allocator.allocate(10, 65, x, y));
+    BOOST_CHECK(allocator.allocate(64, 64, x, y));
+    BOOST_CHECK(!allocator.allocate(1, 1, x, y));
+
+    allocator.reset();
+    BOOST_CHECK_EQUAL(allocator.getOccupancy(), 0.0f);
+    BOOST_CHECK(allocator.allocate(1, 1, x, y));
+}
+
+BOOST_AUTO_TEST_CASE(GlyphAtlas_FullPage_AddsNewPage)
+{
+    CEGUI::GlyphAtlas atlas("GlyphAtlasTest", 32);
+    int x = 0;
+    int y = 0;
+
+    CEGUI::Texture& first = atlas.allocate(32, 32, x, y);
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 1u);
+
+    CEGUI::Texture& second = atlas.allocate(8, 8, x, y);
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 2u);
+    BOOST_CHECK(&first != &second);
+    BOOST_CHECK_EQUAL(first.getSize().d_width, 32.0f);
+
+    // an area larger than the page size gets a larger page of its own
+    CEGUI::Texture& large = atlas.allocate(40, 40, x, y);
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 3u);
+    BOOST_CHECK_EQUAL(large.getSize().d_width, 64.0f);
+
+    atlas.clear();
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(GlyphAtlas_AlphaSupported_PagesAreSingleChannel)
+{
+    CEGUI::GlyphAtlas atlas("GlyphAtlasTest", 32);
+    int x = 0;
+    int y = 0;
+
+    CEGUI::Texture& page = atlas.allocate(4, 2, x, y);
+
+    // the null renderer supports every pixel format
+    BOOST_REQUIRE(page.isPixelFormatSupported(CEGUI::Texture::PixelFormat::Alpha));
+    BOOST_CHECK(atlas.getPixelFormat() == CEGUI::Texture::PixelFormat::Alpha);
+
+    const std::uint8_t coverage[8] = { 0, 32, 64, 96, 128, 160, 192, 255 };
+    atlas.blitCoverage(page, coverage, CEGUI::Rectf(
+        static_cast<float>(x), static_cast<float>(y),
+        static_cast<float>(x + 4), static_cast<float>(y + 2)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,9 @@
 #include "InventoryModel.h"
 #include "CEGUI/Event.h"
 #include "CEGUI/Font.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 
 // Yup. We need this in order to easily inject/call event handlers without having
@@ -46,8 +49,12 @@ struct TreeViewFixture
     {
         System::getSingleton().notifyDisplaySizeChanged(Sizef(100, 100));
 
+        context = &System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget());
+
         view = static_cast<TreeView*>(
             WindowManager::getSingleton().createWindow("TaharezLook/TreeView", "tv"));
+        context->setRootWindow(view);
         view->setModel(&model);
         view->setItemTooltipsEnabled(true);
         font_height = view->getFont()->getFontHeight();
@@ -59,6 +66,14 @@ struct TreeViewFixture
             Event::Subscriber(&TreeViewFixture::onSubtreeCollapsed, this));
     }
 
+    ~TreeViewFixture()
+    {
+        view->setModel(nullptr);
+        context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(view);
+        System::getSingleton().destroyGUIContext(*context);
+    }
+
     bool onSubtreeExpanded(const EventArgs& args)
     {
         expanded_nodes.push_back(
@@ -74,6 +89,7 @@ struct TreeViewFixture
     }
 
 
+    GUIContext* context;
     TreeView* view;
     InventoryModel model;
     float font_height;
@@ -163,6 +179,50 @@ BOOST_AUTO_TEST_CASE(IndexAt_PositionInsideSingleObjectTreeWithScrollbar_Returns
 
 #endif
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IndexAt_ScrolledToBottom_ReturnsLastIndex)
+{
+    for (int i = 0; i < 50; ++i)
+        model.addRandomItemWithChildren(model.getRootIndex(), 0);
+
+    view->setSize(USize(cegui_absdim(200), cegui_absdim(font_height * 10)));
+    view->prepareForRender();
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
+
+    Rectf render_area(view->getViewRenderer()->getViewRenderArea());
+    ModelIndex index = view->indexAt(glm::vec2(
+        render_area.left() + expander_width * 2, render_area.bottom() - 1));
+
+    BOOST_REQUIRE(index.d_modelData != nullptr);
+    BOOST_REQUIRE_EQUAL(
+        model.getRoot().getChildren().at(49),
+        static_cast<InventoryItem*>(index.d_modelData));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetIndexRect_ItemAfterExpandedSubtree_AccountsForSubtree)
+{
+    ModelIndex root_index = model.getRootIndex();
+    model.addRandomItemWithChildren(root_index, 0);
+    model.addRandomItemWithChildren(root_index, 0, 2);
+    view->prepareForRender();
+
+    ModelIndex first = model.makeIndex(0, root_index);
+    ModelIndex first_child = model.makeIndex(0, first);
+    ModelIndex second = model.makeIndex(1, root_index);
+    float item_height = view->getTreeViewItemForIndex(first)->d_size.d_height;
+    ItemView* item_view = view;
+
+    BOOST_CHECK_CLOSE(item_height, item_view->getIndexRect(second).top(), 0.01f);
+    BOOST_CHECK_EQUAL(0.0f, item_view->getIndexRect(first_child).getHeight());
+
+    view->toggleSubtree(*view->getTreeViewItemForIndex(first));
+    view->prepareForRender();
+
+    BOOST_CHECK_CLOSE(item_height, item_view->getIndexRect(first_child).top(), 0.01f);
+    BOOST_CHECK_CLOSE(item_height * 3, item_view->getIndexRect(second).top(), 0.01f);
+}
+
 //----------------------------------------------------------------------------//
 BOOST_AUTO_TEST_CASE(IndexAt_PositionOutsideObject_ReturnsInvalidIndex)
 {
@@ -25,6 +25,9 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/WindowManager.h"
 
@@ -54,17 +57,21 @@ struct LayoutSetupFixture
         d_insideInsideRoot->setSize(CEGUI::USize(CEGUI::UDim(0.5f, 0), CEGUI::UDim(0.5f, 0)));
         d_insideRoot->addChild(d_insideInsideRoot);
 
-        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        d_context = &CEGUI::System::getSingleton().createGUIContext(
+            CEGUI::System::getSingleton().getRenderer()->getDefaultRenderTarget());
+        d_context->setRootWindow(d_root);
         CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
     }
 
     ~LayoutSetupFixture()
     {
-        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(nullptr);
+        d_context->setRootWindow(nullptr);
 
         CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::System::getSingleton().destroyGUIContext(*d_context);
     }
 
+    CEGUI::GUIContext* d_context;
     CEGUI::Window* d_root;
     CEGUI::Window* d_insideRoot;
     CEGUI::Window* d_insideInsideRoot;
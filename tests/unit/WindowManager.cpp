@@ -0,0 +1,205 @@
+/***********************************************************************
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/widgets/ListHeader.h"
+#include "CEGUI/widgets/ListWidget.h"
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/Tooltip.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct WindowPoolFixture
+{
+    WindowPoolFixture() :
+        wmgr(CEGUI::WindowManager::getSingleton())
+    {
+        wmgr.setWindowPoolCapacity("TaharezLook/Button", 2);
+    }
+
+    ~WindowPoolFixture()
+    {
+        wmgr.setWindowPoolCapacity("TaharezLook/Button", 0);
+        wmgr.cleanDeadPool();
+    }
+
+    CEGUI::WindowManager& wmgr;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(WindowManager, WindowPoolFixture)
+
+BOOST_AUTO_TEST_CASE(PooledWindow_IsReusedInInitialState)
+{
+    CEGUI::Window* parent = wmgr.createWindow("DefaultWindow");
+    CEGUI::Window* button = wmgr.createWindow("TaharezLook/Button", "first");
+    const CEGUI::String initial_alpha = button->getProperty("Alpha");
+    const size_t child_count = button->getChildCount();
+
+    parent->addChild(button);
+    button->setText("Changed");
+    button->setProperty("Alpha", "0.5");
+    button->setUserString("key", "value");
+    button->createChild("DefaultWindow");
+
+    wmgr.destroyWindow(button);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount("TaharezLook/Button"), 1u);
+    BOOST_CHECK(!wmgr.isAlive(button));
+    BOOST_CHECK_EQUAL(parent->getChildCount(), 0u);
+
+    CEGUI::Window* reused = wmgr.createWindow("TaharezLook/Button", "second");
+    BOOST_CHECK_EQUAL(reused, button);
+    BOOST_CHECK(wmgr.isAlive(reused));
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount("TaharezLook/Button"), 0u);
+    BOOST_CHECK_EQUAL(reused->getName(), "second");
+    BOOST_CHECK_EQUAL(reused->getText(), "");
+    BOOST_CHECK_EQUAL(reused->getProperty("Alpha"), initial_alpha);
+    BOOST_CHECK(!reused->isUserStringDefined("key"));
+    BOOST_CHECK_EQUAL(reused->getChildCount(), child_count);
+    BOOST_CHECK(reused->getParent() == nullptr);
+
+    wmgr.destroyWindow(reused);
+    wmgr.destroyWindow(parent);
+}
+
+BOOST_AUTO_TEST_CASE(SubscribedWindow_IsPooledWithoutSubscriptions)
+{
+    CEGUI::Window* button = wmgr.createWindow("TaharezLook/Button");
+    int sized_count = 0;
+    int destruction_count = 0;
+    const CEGUI::Event::Connection sized = button->subscribeEvent(
+        CEGUI::Window::EventSized,
+        [&sized_count]() { ++sized_count; });
+    button->subscribeEvent(CEGUI::Window::EventDestructionStarted,
+        [&destruction_count]() { ++destruction_count; });
+
+    wmgr.destroyWindow(button);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount("TaharezLook/Button"), 1u);
+    BOOST_CHECK_EQUAL(destruction_count, 1);
+    BOOST_CHECK(!sized->connected());
+
+    CEGUI::Window* reused = wmgr.createWindow("TaharezLook/Button");
+    BOOST_CHECK_EQUAL(reused, button);
+    reused->setSize(CEGUI::USize(cegui_absdim(40), cegui_absdim(20)));
+    BOOST_CHECK_EQUAL(sized_count, 0);
+
+    wmgr.destroyWindow(reused);
+    BOOST_CHECK_EQUAL(destruction_count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(PooledListWidget_HasNoItems)
+{
+    wmgr.setWindowPoolCapacity("TaharezLook/ListWidget", 1);
+
+    CEGUI::ListWidget* list = static_cast<CEGUI::ListWidget*>(
+        wmgr.createWindow("TaharezLook/ListWidget"));
+    list->addItem("first");
+    list->addItem("second");
+
+    wmgr.destroyWindow(list);
+    CEGUI::ListWidget* reused = static_cast<CEGUI::ListWidget*>(
+        wmgr.createWindow("TaharezLook/ListWidget"));
+    BOOST_CHECK_EQUAL(reused, list);
+    BOOST_CHECK_EQUAL(reused->getItemCount(), 0u);
+    reused->addItem("third");
+    BOOST_CHECK_EQUAL(reused->getItemCount(), 1u);
+
+    wmgr.destroyWindow(reused);
+    wmgr.setWindowPoolCapacity("TaharezLook/ListWidget", 0);
+}
+
+BOOST_AUTO_TEST_CASE(PooledMultiColumnList_HasNoRowsOrColumns)
+{
+    wmgr.setWindowPoolCapacity("TaharezLook/MultiColumnList", 1);
+
+    CEGUI::MultiColumnList* list = static_cast<CEGUI::MultiColumnList*>(
+        wmgr.createWindow("TaharezLook/MultiColumnList"));
+    list->addColumn("Name", 0, cegui_reldim(0.5f));
+    list->addColumn("Value", 1, cegui_reldim(0.5f));
+    list->addRow();
+
+    wmgr.destroyWindow(list);
+    CEGUI::MultiColumnList* reused = static_cast<CEGUI::MultiColumnList*>(
+        wmgr.createWindow("TaharezLook/MultiColumnList"));
+    BOOST_CHECK_EQUAL(reused, list);
+    BOOST_CHECK_EQUAL(reused->getColumnCount(), 0u);
+    BOOST_CHECK_EQUAL(reused->getRowCount(), 0u);
+    BOOST_CHECK_EQUAL(reused->getListHeader()->getColumnCount(), 0u);
+
+    wmgr.destroyWindow(reused);
+    wmgr.setWindowPoolCapacity("TaharezLook/MultiColumnList", 0);
+}
+
+BOOST_AUTO_TEST_CASE(PooledWindow_IsNoLongerTooltipTarget)
+{
+    CEGUI::System& system = CEGUI::System::getSingleton();
+    CEGUI::GUIContext& context = system.createGUIContext(
+        system.getRenderer()->getDefaultRenderTarget());
+    CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+    context.setRootWindow(root);
+
+    CEGUI::Window* button = wmgr.createWindow("TaharezLook/Button");
+    root->addChild(button);
+    CEGUI::Tooltip* tooltip = static_cast<CEGUI::Tooltip*>(
+        wmgr.createWindow("TaharezLook/Tooltip"));
+    button->setTooltip(tooltip);
+    tooltip->setTargetWindow(button);
+
+    wmgr.destroyWindow(button);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount("TaharezLook/Button"), 1u);
+    BOOST_CHECK(tooltip->getTargetWindow() == nullptr);
+
+    context.setRootWindow(nullptr);
+    wmgr.destroyWindow(root);
+    wmgr.destroyWindow(tooltip);
+    system.destroyGUIContext(context);
+}
+
+BOOST_AUTO_TEST_CASE(PoolCapacity_LimitsPooledWindows)
+{
+    CEGUI::Window* buttons[3];
+    for (CEGUI::Window*& button : buttons)
+        button = wmgr.createWindow("TaharezLook/Button");
+    for (CEGUI::Window* button : buttons)
+        wmgr.destroyWindow(button);
+
+    BOOST_CHECK_EQUAL(wmgr.getWindowPoolCapacity("TaharezLook/Button"), 2u);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount("TaharezLook/Button"), 2u);
+
+    wmgr.setWindowPoolCapacity("TaharezLook/Button", 1);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount("TaharezLook/Button"), 1u);
+
+    wmgr.clearWindowPools();
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount("TaharezLook/Button"), 0u);
+    BOOST_CHECK_EQUAL(wmgr.getWindowPoolCapacity("TaharezLook/Button"), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()